@@ -0,0 +1,175 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file bench_runner.c
+ ** @brief Mediciones del costo de los caminos críticos del reloj en el host - Electrónica 4 2025
+ **
+ ** Ejecuta las mediciones de benchmark.h con el contador de ciclos en nanosegundos reales, escribe una línea JSON por
+ ** operación y muestra un resumen. Con -c compara la mediana de cada operación con la de una ejecución anterior y
+ ** termina con 1 si alguna empeoró más que el porcentaje indicado con -p, 25 % si no se indica.
+ **
+ ** Uso: benchmark [-o resultados] [-c referencia] [-p porcentaje]
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "benchmark.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! Cantidad máxima de operaciones en una referencia
+#define BENCHMARK_MAX_REFERENCES 32
+
+//! Largo máximo de una línea de resultados
+#define BENCHMARK_LINE_SIZE      256
+
+/* === Private data type declarations ============================================================================== */
+
+//! Mediana de una operación en una ejecución anterior
+typedef struct reference_s {
+    char name[64]; //!< nombre de la operación
+    double median; //!< mediana en la unidad del contador
+} reference_t;
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Función que lee las medianas de un archivo de resultados
+ *
+ * @param path archivo de resultados
+ * @return true si se pudo leer
+ */
+static bool LoadReferences(const char * path);
+
+/**
+ * @brief Función que escribe, muestra y compara el resultado de una medición
+ *
+ * @param result resultado de la medición
+ */
+static void Report(const benchmark_result_t * result);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Medianas de la ejecución de referencia
+static reference_t references[BENCHMARK_MAX_REFERENCES];
+
+//! Cantidad de operaciones de la referencia
+static unsigned references_count = 0;
+
+//! Porcentaje de empeoramiento tolerado
+static double tolerance = 25.0;
+
+//! Archivo donde se escriben los resultados
+static FILE * output;
+
+//! Cantidad de operaciones que empeoraron
+static unsigned regressions = 0;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static bool LoadReferences(const char * path) {
+    FILE * file = fopen(path, "r");
+    char line[BENCHMARK_LINE_SIZE];
+    const char * median;
+    reference_t * reference;
+
+    while (file != NULL && fgets(line, sizeof(line), file) != NULL && references_count < BENCHMARK_MAX_REFERENCES) {
+        reference = &references[references_count];
+        median = strstr(line, "\"median\":");
+        if (sscanf(line, "{\"name\":\"%63[^\"]\"", reference->name) == 1 && median != NULL) {
+            reference->median = strtod(median + strlen("\"median\":"), NULL);
+            references_count++;
+        }
+    }
+    if (file != NULL) {
+        fclose(file);
+    }
+
+    return file != NULL;
+}
+
+static void Report(const benchmark_result_t * result) {
+    char line[BENCHMARK_LINE_SIZE];
+    double median = result->median / 1000.0;
+    double change;
+    unsigned index;
+
+    BenchmarkFormat(result, "ns", line, sizeof(line));
+    fputs(line, output);
+
+    fprintf(stderr, "%-24s %9.3f ns/op  min %9.3f  max %9.3f  desvío %7.3f", result->name, median,
+            result->min / 1000.0, result->max / 1000.0, result->stddev / 1000.0);
+    for (index = 0; index < references_count; index++) {
+        if (strcmp(references[index].name, result->name) == 0 && references[index].median > 0) {
+            change = (median - references[index].median) * 100.0 / references[index].median;
+            fprintf(stderr, "  %+6.1f %%%s", change, (change > tolerance) ? "  EMPEORÓ" : "");
+            if (change > tolerance) {
+                regressions++;
+            }
+        }
+    }
+    fputc('\n', stderr);
+}
+
+/* === Public function definitions ================================================================================= */
+
+int main(int argc, char * argv[]) {
+    int option;
+    int result = 0;
+
+    output = stdout;
+    for (option = 1; option < argc && result == 0; option++) {
+        if (strcmp(argv[option], "-o") == 0 && option + 1 < argc) {
+            output = fopen(argv[++option], "w");
+            result = (output == NULL) ? 2 : 0;
+        } else if (strcmp(argv[option], "-c") == 0 && option + 1 < argc) {
+            result = LoadReferences(argv[++option]) ? 0 : 2;
+        } else if (strcmp(argv[option], "-p") == 0 && option + 1 < argc) {
+            tolerance = strtod(argv[++option], NULL);
+        } else {
+            result = 2;
+        }
+    }
+    if (result != 0) {
+        fprintf(stderr, "uso: %s [-o resultados] [-c referencia] [-p porcentaje]\n", argv[0]);
+    }
+
+    if (result == 0) {
+        result = (BenchmarkSuiteRun(Report) == 0) ? 0 : 2;
+    }
+    if (result == 0 && regressions != 0) {
+        fprintf(stderr, "%u operaciones empeoraron más del %.0f %%\n", regressions, tolerance);
+        result = 1;
+    }
+
+    if (output != NULL && output != stdout) {
+        fclose(output);
+    }
+
+    return result;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,238 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file fleet.c
+ ** @brief Simulador de una flota de placas independientes ejecutadas en paralelo - Electrónica 4 2025
+ **
+ ** Cada placa ejecuta el firmware completo con su propio reloj, display y entradas, combinando un guion, una
+ ** frecuencia de la interrupción periódica y un tiempo de posposición de la alarma. Las placas se reparten entre todos
+ ** los núcleos con un grupo de hilos con robo de trabajo y al final se informa el rendimiento total en segundos
+ ** simulados por segundo real.
+ **
+ ** Uso: fleet [-n placas] [-j hilos] [-t duración] [-s guion]... [-r frecuencias] [-z posposiciones]
+ **
+ ** Las listas de frecuencias y posposiciones se separan con comas, por ejemplo `-r 1000,500 -z 300,60`. La placa i usa
+ ** el guion i % guiones, y las demás combinaciones se recorren de la misma manera.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "sim_board.h"
+#include "work_pool.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! Cantidad máxima de guiones y de valores de cada lista
+#define FLEET_MAX_OPTIONS 8
+
+//! Cantidad máxima de placas con errores que se informan
+#define FLEET_MAX_REPORTED 10
+
+/* === Private data type declarations ============================================================================== */
+
+//! Descripción de la flota
+typedef struct fleet_s {
+    sim_script_p scripts[FLEET_MAX_OPTIONS]; //!< guiones
+    const char * names[FLEET_MAX_OPTIONS];   //!< nombres de los archivos de los guiones
+    unsigned scripts_count;                  //!< cantidad de guiones
+    uint16_t rates[FLEET_MAX_OPTIONS];       //!< frecuencias de la interrupción periódica
+    unsigned rates_count;                    //!< cantidad de frecuencias
+    uint32_t snoozes[FLEET_MAX_OPTIONS];     //!< segundos que se pospone la alarma
+    unsigned snoozes_count;                  //!< cantidad de posposiciones
+    uint64_t duration;                       //!< tiempo simulado máximo de cada placa en milisegundos
+    sim_result_t * results;                  //!< resultado de cada placa
+} fleet_t;
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Función que interpreta una lista de números separados por comas
+ *
+ * @param text texto de la lista
+ * @param values valores leídos
+ * @param count cantidad de valores leídos
+ * @return true si la lista es válida
+ */
+static bool ParseList(const char * text, uint32_t * values, unsigned * count);
+
+/**
+ * @brief Función que arma la configuración de una placa a partir de su índice
+ *
+ * @param fleet descripción de la flota
+ * @param index índice de la placa
+ * @param config configuración de la aplicación
+ * @return guion de la placa
+ */
+static sim_script_p BoardConfig(const fleet_t * fleet, size_t index, app_config_t * config);
+
+/**
+ * @brief Trabajo que simula una placa completa en el hilo que lo ejecuta
+ *
+ */
+static void SimulateBoard(size_t index, void * context);
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static bool ParseList(const char * text, uint32_t * values, unsigned * count) {
+    char * end;
+    bool result = true;
+
+    *count = 0;
+    while (result && *text != 0) {
+        values[*count] = (uint32_t)strtoul(text, &end, 10);
+        result = (end != text) && (*end == ',' || *end == 0) && (*count < FLEET_MAX_OPTIONS);
+        (*count)++;
+        text = (*end == ',') ? end + 1 : end;
+    }
+
+    return result && (*count > 0);
+}
+
+static sim_script_p BoardConfig(const fleet_t * fleet, size_t index, app_config_t * config) {
+    size_t variant = index / fleet->scripts_count;
+
+    config->ticks_per_second = fleet->rates[variant % fleet->rates_count];
+    config->seconds_snoozed = fleet->snoozes[(variant / fleet->rates_count) % fleet->snoozes_count];
+
+    return fleet->scripts[index % fleet->scripts_count];
+}
+
+static void SimulateBoard(size_t index, void * context) {
+    fleet_t * fleet = context;
+    app_config_t config;
+    sim_board_p board = SimBoardCreate(BoardConfig(fleet, index, &config), NULL);
+
+    if (board != NULL) {
+        SimBoardRun(board, &config, fleet->duration, &fleet->results[index]);
+        SimBoardDestroy(board);
+    }
+}
+
+/* === Public function definitions ================================================================================= */
+
+int main(int argc, char * argv[]) {
+    fleet_t fleet = {.scripts_count = 0, .rates = {1000}, .rates_count = 1, .snoozes = {300}, .snoozes_count = 1};
+    uint32_t rates[FLEET_MAX_OPTIONS];
+    size_t boards = 1000;
+    long workers = sysconf(_SC_NPROCESSORS_ONLN);
+    work_pool_stats_t stats;
+    struct timespec start, stop;
+    double wall, simulated = 0;
+    uint64_t ticks = 0;
+    uint64_t skipped = 0;
+    unsigned failed = 0;
+    app_config_t config;
+    unsigned i;
+    size_t board;
+    int option;
+    int result = 0;
+
+    fleet.duration = 3600ULL * 1000ULL;
+    for (option = 1; option < argc && result == 0; option++) {
+        if (strcmp(argv[option], "-n") == 0 && option + 1 < argc) {
+            boards = strtoul(argv[++option], NULL, 10);
+        } else if (strcmp(argv[option], "-j") == 0 && option + 1 < argc) {
+            workers = strtol(argv[++option], NULL, 10);
+        } else if (strcmp(argv[option], "-t") == 0 && option + 1 < argc) {
+            result = SimParseTime(argv[++option], &fleet.duration) ? 0 : 2;
+        } else if (strcmp(argv[option], "-s") == 0 && option + 1 < argc && fleet.scripts_count < FLEET_MAX_OPTIONS) {
+            fleet.names[fleet.scripts_count] = argv[++option];
+            fleet.scripts[fleet.scripts_count] = SimScriptLoad(argv[option]);
+            result = (fleet.scripts[fleet.scripts_count++] == NULL) ? 2 : 0;
+        } else if (strcmp(argv[option], "-r") == 0 && option + 1 < argc) {
+            result = ParseList(argv[++option], rates, &fleet.rates_count) ? 0 : 2;
+            for (i = 0; i < fleet.rates_count && result == 0; i++) {
+                // La aplicación cuenta milisegundos enteros por interrupción
+                result = (rates[i] > 0 && rates[i] <= 1000 && 1000 % rates[i] == 0) ? 0 : 2;
+                fleet.rates[i] = (uint16_t)rates[i];
+            }
+        } else if (strcmp(argv[option], "-z") == 0 && option + 1 < argc) {
+            result = ParseList(argv[++option], fleet.snoozes, &fleet.snoozes_count) ? 0 : 2;
+        } else {
+            result = 2;
+        }
+    }
+    if (result != 0 || boards == 0 || workers <= 0) {
+        fprintf(stderr, "uso: %s [-n placas] [-j hilos] [-t duración] [-s guion]... [-r frecuencias] [-z posposiciones]\n",
+                argv[0]);
+        result = 2;
+    }
+
+    if (result == 0) {
+        // Sin guion las placas solo cuentan el tiempo
+        if (fleet.scripts_count == 0) {
+            fleet.names[0] = "-";
+            fleet.scripts_count = 1;
+        }
+        fleet.results = calloc(boards, sizeof(sim_result_t));
+        result = (fleet.results == NULL) ? 2 : 0;
+    }
+
+    if (result == 0) {
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        result = (WorkPoolRun((unsigned)workers, boards, SimulateBoard, &fleet, &stats) == 0) ? 0 : 2;
+        clock_gettime(CLOCK_MONOTONIC, &stop);
+    }
+
+    if (result == 0) {
+        for (board = 0; board < boards; board++) {
+            simulated += (double)fleet.results[board].simulated_ms / 1000.0;
+            ticks += fleet.results[board].ticks;
+            skipped += fleet.results[board].deadlines.loop_skipped;
+            if (fleet.results[board].failures != 0) {
+                if (failed < FLEET_MAX_REPORTED) {
+                    BoardConfig(&fleet, board, &config);
+                    fprintf(stderr, "placa %zu: guion %s, %u ticks/s, posposición %u s, %u comparaciones fallidas\n",
+                            board, fleet.names[board % fleet.scripts_count], config.ticks_per_second,
+                            config.seconds_snoozed, fleet.results[board].failures);
+                }
+                failed++;
+            }
+        }
+
+        wall = (double)(stop.tv_sec - start.tv_sec) + (double)(stop.tv_nsec - start.tv_nsec) / 1e9;
+        printf("placas: %zu en %ld hilos, %llu robos de trabajo\n", boards, workers, (unsigned long long)stats.steals);
+        printf("simulados: %.0f s, %llu ticks en %.3f s\n", simulated, (unsigned long long)ticks, wall);
+        printf("rendimiento: %.0f s simulados por segundo real, %.1f Mticks/s\n", simulated / wall,
+               (double)ticks / wall / 1e6);
+        printf("periodos del lazo salteados: %llu\n", (unsigned long long)skipped);
+        printf("placas con errores: %u\n", failed);
+        result = (failed == 0) ? 0 : 1;
+    }
+
+    for (i = 0; i < fleet.scripts_count; i++) {
+        SimScriptDestroy(fleet.scripts[i]);
+    }
+    free(fleet.results);
+
+    return result;
+}
+
+/* === End of documentation ======================================================================================== */
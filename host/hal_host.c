@@ -0,0 +1,593 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file hal_host.c
+ ** @brief Implementación de la capa de abstracción del hardware para compilar en Linux - Electrónica 4 2025
+ **
+ ** Si se define HAL_HOST_REALTIME cada interrupción periódica espera el tiempo real correspondiente y el contador de
+ ** ciclos cuenta nanosegundos de un reloj monotónico. En caso contrario el tiempo simulado avanza tan rápido como lo
+ ** permite el procesador y el contador de ciclos se deriva del tiempo simulado, sin llamadas al sistema operativo.
+ **
+ ** El puerto serie con tiempo real es una pseudo terminal, cuyo nombre se informa al iniciarlo, y se lee en cada
+ ** interrupción periódica como lo haría el DMA. Con tiempo simulado los bytes se reciben con
+ ** @ref HalHostSerialReceive() y los enviados se entregan a la función indicada con @ref HalHostSetSerialOutput().
+ **
+ ** El RTC suma los segundos transcurridos a la última hora escrita. Con tiempo real cuenta con el reloj del sistema y
+ ** empieza con la hora UTC del host, con tiempo simulado cuenta los ticks simulados y empieza sin hora. Su alarma y
+ ** los cambios de las entradas vigiladas se revisan en cada interrupción periódica, aunque esté detenida.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#define _XOPEN_SOURCE 700
+
+#include "hal_host.h"
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef HAL_HOST_REALTIME
+#include <fcntl.h>
+#include <stdlib.h>
+#include <unistd.h>
+#endif
+
+/* === Macros definitions ========================================================================================== */
+
+//! Tamaño del almacenamiento no volátil, el mismo que la EEPROM usable de la placa
+#define HAL_HOST_STORAGE_SIZE (127U * 128U)
+
+//! Valor de los bytes del almacenamiento borrado
+#define HAL_HOST_STORAGE_ERASED 0xFF
+
+/* === Private data type declarations ============================================================================== */
+
+//! Registros de un puerto GPIO
+typedef struct gpio_port_s {
+    uint32_t direction; //!< bits configurados como salida
+    uint32_t output;    //!< valor escrito en los bits de salida
+    uint32_t input;     //!< nivel eléctrico de los bits de entrada
+} gpio_port_t;
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Función que devuelve el tiempo de un reloj monotónico en nanosegundos
+ *
+ * @return tiempo en nanosegundos
+ */
+static uint64_t MonotonicNs(void);
+
+/**
+ * @brief Función que devuelve el tiempo con el que cuenta el RTC en nanosegundos
+ *
+ * @return tiempo real del sistema o tiempo simulado, en nanosegundos
+ */
+static uint64_t RtcNs(void);
+
+/**
+ * @brief Función que devuelve los segundos que cuenta el RTC
+ *
+ * @return segundos UTC desde 1970
+ */
+static uint32_t RtcSeconds(void);
+
+#ifdef HAL_HOST_REALTIME
+/**
+ * @brief Función que espera hasta que el tiempo real alcance al tiempo simulado
+ *
+ */
+static void WaitRealTime(void);
+
+/**
+ * @brief Función que copia al buffer de recepción lo que se escribió en la pseudo terminal
+ *
+ */
+static void SerialPoll(void);
+#endif
+
+/* === Private variable definitions ================================================================================ */
+
+//! Registros en memoria de los puertos GPIO
+static HAL_BOARD_LOCAL gpio_port_t ports[HAL_GPIO_PORTS] = {0};
+
+//! Función que atiende la interrupción periódica
+static HAL_BOARD_LOCAL hal_handler_p tick_handler = NULL;
+
+//! Función que realiza el trabajo diferido
+static HAL_BOARD_LOCAL hal_handler_p deferred_handler = NULL;
+
+//! Función que se llama al terminar cada interrupción periódica
+static HAL_BOARD_LOCAL hal_handler_p tick_hook = NULL;
+
+//! Indica que se pidió el trabajo diferido
+static HAL_BOARD_LOCAL bool deferred_pending = false;
+
+//! Cantidad de interrupciones periódicas simuladas
+static HAL_BOARD_LOCAL uint64_t ticks = 0;
+
+//! Duración de una interrupción periódica en nanosegundos
+static HAL_BOARD_LOCAL uint64_t tick_period_ns = 1000000;
+
+//! Tiempo real al que corresponde la primera interrupción periódica
+static HAL_BOARD_LOCAL uint64_t start_ns = 0;
+
+//! Indica si la interrupción periódica está habilitada
+static HAL_BOARD_LOCAL bool tick_enabled = true;
+
+#ifdef HAL_HOST_REALTIME
+//! Indica si el RTC conserva la hora, con tiempo real empieza con la del sistema
+static HAL_BOARD_LOCAL bool rtc_valid = true;
+#else
+//! Indica si el RTC conserva la hora
+static HAL_BOARD_LOCAL bool rtc_valid = false;
+#endif
+
+//! Segundos del RTC en el instante @ref rtc_origin_ns
+static HAL_BOARD_LOCAL uint32_t rtc_base = 0;
+
+//! Tiempo de @ref RtcNs() en el que el RTC tenía los segundos @ref rtc_base
+static HAL_BOARD_LOCAL uint64_t rtc_origin_ns = 0;
+
+//! Instante de la alarma del RTC, @ref HAL_RTC_NO_ALARM si no está programada
+static HAL_BOARD_LOCAL uint32_t rtc_alarm = HAL_RTC_NO_ALARM;
+
+//! Función que atiende la alarma del RTC
+static HAL_BOARD_LOCAL hal_handler_p rtc_handler = NULL;
+
+//! Función que atiende el cambio de las entradas vigiladas, NULL si no se vigila ninguna
+static HAL_BOARD_LOCAL hal_handler_p wake_handler = NULL;
+
+//! Puerto GPIO de las entradas vigiladas
+static HAL_BOARD_LOCAL uint8_t wake_gpio = 0;
+
+//! Bits vigilados del puerto
+static HAL_BOARD_LOCAL uint32_t wake_mask = 0;
+
+//! Niveles de los bits vigilados al empezar a vigilarlos
+static HAL_BOARD_LOCAL uint32_t wake_levels = 0;
+
+//! Contenido del almacenamiento no volátil
+static HAL_BOARD_LOCAL uint8_t storage[HAL_HOST_STORAGE_SIZE];
+
+//! Archivo que respalda el almacenamiento, NULL si se pierde al reiniciar
+static HAL_BOARD_LOCAL FILE * storage_file = NULL;
+
+//! Buffer circular de recepción del puerto serie, NULL si no se inició
+static HAL_BOARD_LOCAL uint8_t * serial_buffer = NULL;
+
+//! Tamaño del buffer de recepción
+static HAL_BOARD_LOCAL size_t serial_size = 0;
+
+//! Posición en la que se escribe el próximo byte recibido
+static HAL_BOARD_LOCAL size_t serial_head = 0;
+
+//! Función que recibe los bytes enviados
+static HAL_BOARD_LOCAL hal_host_serial_p serial_output = NULL;
+
+#ifdef HAL_HOST_REALTIME
+//! Lado maestro de la pseudo terminal del puerto serie, -1 si no se abrió
+static int serial_terminal = -1;
+#endif
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static uint64_t MonotonicNs(void) {
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+}
+
+static uint64_t RtcNs(void) {
+#ifdef HAL_HOST_REALTIME
+    struct timespec now;
+
+    clock_gettime(CLOCK_REALTIME, &now);
+    return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+#else
+    return ticks * tick_period_ns;
+#endif
+}
+
+static uint32_t RtcSeconds(void) {
+    return rtc_base + (uint32_t)((RtcNs() - rtc_origin_ns) / 1000000000ULL);
+}
+
+#ifdef HAL_HOST_REALTIME
+static void WaitRealTime(void) {
+    uint64_t target = start_ns + ticks * tick_period_ns;
+    uint64_t now = MonotonicNs();
+    struct timespec wait;
+
+    if (target > now) {
+        wait.tv_sec = (time_t)((target - now) / 1000000000ULL);
+        wait.tv_nsec = (long)((target - now) % 1000000000ULL);
+        nanosleep(&wait, NULL);
+    }
+}
+
+static void SerialPoll(void) {
+    ssize_t count = 1;
+
+    // Sin nadie conectado al lado esclavo la lectura falla, como una línea serie sin datos
+    while (serial_terminal >= 0 && serial_buffer != NULL && count > 0) {
+        count = read(serial_terminal, &serial_buffer[serial_head], serial_size - serial_head);
+        if (count > 0) {
+            serial_head = (serial_head + (size_t)count) % serial_size;
+        }
+    }
+}
+#endif
+
+/* === Public function definitions ================================================================================= */
+
+void HalPinMux(uint8_t port, uint8_t pin, hal_pin_mode_t mode, uint8_t function) {
+    // En el host no hay multiplexado de pines, los niveles de las entradas se fijan con HalHostSetInput
+    (void)port;
+    (void)pin;
+    (void)mode;
+    (void)function;
+}
+
+void HalGpioSetDirection(uint8_t gpio, uint8_t bit, bool output) {
+    if (output) {
+        ports[gpio].direction |= (1UL << bit);
+    } else {
+        ports[gpio].direction &= ~(1UL << bit);
+    }
+}
+
+bool HalGpioReadBit(uint8_t gpio, uint8_t bit) {
+    return (HalGpioReadPort(gpio) & (1UL << bit)) != 0;
+}
+
+void HalGpioWriteBit(uint8_t gpio, uint8_t bit, bool state) {
+    if (state) {
+        HalGpioSetBits(gpio, 1UL << bit);
+    } else {
+        HalGpioClearBits(gpio, 1UL << bit);
+    }
+}
+
+void HalGpioToggleBit(uint8_t gpio, uint8_t bit) {
+    ports[gpio].output ^= (1UL << bit);
+}
+
+uint32_t HalGpioReadPort(uint8_t gpio) {
+    // Igual que en el LPC43xx, los bits de salida se leen con el valor escrito
+    return (ports[gpio].output & ports[gpio].direction) | (ports[gpio].input & ~ports[gpio].direction);
+}
+
+void HalGpioSetBits(uint8_t gpio, uint32_t mask) {
+    ports[gpio].output |= mask;
+}
+
+void HalGpioClearBits(uint8_t gpio, uint32_t mask) {
+    ports[gpio].output &= ~mask;
+}
+
+void HalGpioWriteMasked(uint8_t gpio, uint32_t mask, uint32_t value) {
+    ports[gpio].output = (ports[gpio].output & ~mask) | (value & mask);
+}
+
+void HalTickStart(uint32_t ticks_per_second, hal_handler_p handler) {
+    tick_handler = handler;
+    tick_period_ns = 1000000000ULL / ticks_per_second;
+    start_ns = MonotonicNs();
+}
+
+void HalTickEnable(bool enabled) {
+    tick_enabled = enabled;
+}
+
+void HalDeferredStart(hal_handler_p handler) {
+    deferred_handler = handler;
+}
+
+void HalDeferredRequest(void) {
+    deferred_pending = true;
+}
+
+void HalCycleCounterStart(void) {
+}
+
+uint32_t HalCycleCounter(void) {
+#ifdef HAL_HOST_REALTIME
+    return (uint32_t)MonotonicNs();
+#else
+    return (uint32_t)(ticks * tick_period_ns);
+#endif
+}
+
+uint32_t HalCycleCounterFrequency(void) {
+    // El contador cuenta nanosegundos, reales o simulados
+    return 1000000000UL;
+}
+
+uint32_t HalTimestamp(void) {
+    return (uint32_t)MonotonicNs();
+}
+
+uint32_t HalTickLatency(void) {
+    uint32_t result = 0;
+
+#ifdef HAL_HOST_REALTIME
+    uint64_t now = MonotonicNs();
+    uint64_t due = start_ns + ticks * tick_period_ns;
+
+    result = (now > due) ? (uint32_t)(now - due) : 0;
+#endif
+    // Con tiempo simulado la interrupción se atiende siempre en el instante en que se dispara
+
+    return result;
+}
+
+bool HalTickOverrun(void) {
+    bool result = false;
+
+#ifdef HAL_HOST_REALTIME
+    result = MonotonicNs() >= start_ns + (ticks + 1) * tick_period_ns;
+#endif
+
+    return result;
+}
+
+void HalInterruptsDisable(void) {
+}
+
+void HalInterruptsEnable(void) {
+}
+
+void HalSleep(void) {
+    HalHostTick();
+}
+
+uint32_t HalStorageSize(void) {
+    return sizeof(storage);
+}
+
+void HalStorageRead(uint32_t address, void * data, size_t size) {
+    memcpy(data, &storage[address], size);
+}
+
+bool HalStorageWrite(uint32_t address, const void * data, size_t size) {
+    bool result = ((address | size) & (sizeof(uint32_t) - 1)) == 0 && address <= sizeof(storage) &&
+                  size <= sizeof(storage) - address;
+
+    if (result) {
+        memcpy(&storage[address], data, size);
+        // Se escribe de inmediato, de modo que el archivo queda como si se cortara la alimentación en cualquier momento
+        if (storage_file != NULL) {
+            result = fseek(storage_file, (long)address, SEEK_SET) == 0 &&
+                     fwrite(data, 1, size, storage_file) == size && fflush(storage_file) == 0;
+        }
+    }
+    return result;
+}
+
+void HalSerialStart(uint32_t baud_rate, uint8_t * buffer, size_t size) {
+    (void)baud_rate;
+    serial_buffer = buffer;
+    serial_size = size;
+    serial_head = 0;
+#ifdef HAL_HOST_REALTIME
+    if (serial_terminal < 0) {
+        serial_terminal = posix_openpt(O_RDWR | O_NOCTTY | O_NONBLOCK);
+        if (serial_terminal >= 0 && (grantpt(serial_terminal) != 0 || unlockpt(serial_terminal) != 0)) {
+            close(serial_terminal);
+            serial_terminal = -1;
+        }
+        if (serial_terminal >= 0) {
+            fprintf(stderr, "consola serie en %s\n", ptsname(serial_terminal));
+        }
+    }
+#endif
+}
+
+size_t HalSerialReceived(void) {
+    return serial_head;
+}
+
+bool HalSerialSend(const void * data, size_t size) {
+#ifdef HAL_HOST_REALTIME
+    ssize_t written;
+
+    // Si nadie lee la pseudo terminal los bytes se pierden, como en una línea serie desconectada
+    if (serial_terminal >= 0) {
+        written = write(serial_terminal, data, size);
+        (void)written;
+    }
+#endif
+    if (serial_output != NULL) {
+        serial_output(data, size);
+    }
+    return true;
+}
+
+bool HalSerialBusy(void) {
+    // El envío termina en el mismo llamado
+    return false;
+}
+
+void HalRtcStart(hal_handler_p handler) {
+    rtc_handler = handler;
+    rtc_alarm = HAL_RTC_NO_ALARM;
+}
+
+bool HalRtcRead(uint32_t * seconds) {
+    if (rtc_valid) {
+        *seconds = RtcSeconds();
+    }
+    return rtc_valid;
+}
+
+void HalRtcWrite(uint32_t seconds) {
+    rtc_base = seconds;
+    rtc_origin_ns = RtcNs();
+    rtc_valid = true;
+}
+
+void HalRtcSetAlarm(uint32_t seconds) {
+    rtc_alarm = seconds;
+}
+
+void HalWakeOnChange(uint8_t gpio, uint32_t mask, hal_handler_p handler) {
+    wake_handler = handler;
+    wake_gpio = gpio;
+    wake_mask = mask;
+    wake_levels = HalGpioReadPort(gpio);
+}
+
+void HalHostReset(void) {
+    memset(ports, 0, sizeof(ports));
+    tick_handler = NULL;
+    deferred_handler = NULL;
+    tick_hook = NULL;
+    deferred_pending = false;
+    ticks = 0;
+    tick_period_ns = 1000000;
+    serial_buffer = NULL;
+    serial_size = 0;
+    serial_head = 0;
+    tick_enabled = true;
+    rtc_valid = false;
+    rtc_base = 0;
+    rtc_origin_ns = 0;
+    rtc_alarm = HAL_RTC_NO_ALARM;
+    rtc_handler = NULL;
+    wake_handler = NULL;
+
+    // Al encender la placa el almacenamiento conserva lo que tiene el archivo, sin archivo empieza borrado
+    memset(storage, HAL_HOST_STORAGE_ERASED, sizeof(storage));
+    if (storage_file != NULL) {
+        rewind(storage_file);
+        if (fread(storage, 1, sizeof(storage), storage_file) < sizeof(storage)) {
+            clearerr(storage_file);
+        }
+    }
+}
+
+bool HalHostStorageFile(const char * path) {
+    bool result = true;
+
+    if (storage_file != NULL) {
+        fclose(storage_file);
+        storage_file = NULL;
+    }
+    if (path != NULL) {
+        storage_file = fopen(path, "r+b");
+        if (storage_file == NULL) {
+            // Un archivo nuevo representa un almacenamiento borrado
+            storage_file = fopen(path, "w+b");
+            memset(storage, HAL_HOST_STORAGE_ERASED, sizeof(storage));
+            if (storage_file != NULL && fwrite(storage, 1, sizeof(storage), storage_file) != sizeof(storage)) {
+                fclose(storage_file);
+                storage_file = NULL;
+            }
+        }
+        result = (storage_file != NULL);
+    }
+    return result;
+}
+
+void HalHostSetRtc(uint32_t seconds) {
+    HalRtcWrite(seconds);
+}
+
+void HalHostSetInput(uint8_t gpio, uint8_t bit, bool state) {
+    if (state) {
+        ports[gpio].input |= (1UL << bit);
+    } else {
+        ports[gpio].input &= ~(1UL << bit);
+    }
+}
+
+uint32_t HalHostGetOutput(uint8_t gpio) {
+    return ports[gpio].output;
+}
+
+uint32_t HalHostGetDirection(uint8_t gpio) {
+    return ports[gpio].direction;
+}
+
+void HalHostTick(void) {
+    hal_handler_p handler;
+
+    ticks++;
+#ifdef HAL_HOST_REALTIME
+    WaitRealTime();
+    SerialPoll();
+#endif
+    // La alarma y el cambio de las entradas se piden una sola vez, se desarman antes de llamar a la función
+    if (rtc_alarm != HAL_RTC_NO_ALARM && RtcSeconds() >= rtc_alarm) {
+        rtc_alarm = HAL_RTC_NO_ALARM;
+        if (rtc_handler != NULL) {
+            rtc_handler();
+        }
+    }
+    if (wake_handler != NULL && ((HalGpioReadPort(wake_gpio) ^ wake_levels) & wake_mask) != 0) {
+        handler = wake_handler;
+        wake_handler = NULL;
+        handler();
+    }
+    if (tick_enabled && tick_handler != NULL) {
+        tick_handler();
+    }
+    // El trabajo diferido tiene menor prioridad, se ejecuta cuando termina la interrupción periódica
+    if (deferred_pending && (deferred_handler != NULL)) {
+        deferred_pending = false;
+        deferred_handler();
+    }
+    if (tick_hook != NULL) {
+        tick_hook();
+    }
+}
+
+void HalHostSetTickHook(hal_handler_p hook) {
+    tick_hook = hook;
+}
+
+uint64_t HalHostGetTicks(void) {
+    return ticks;
+}
+
+uint64_t HalHostGetMilliseconds(void) {
+    return ticks * tick_period_ns / 1000000;
+}
+
+void HalHostSerialReceive(const void * data, size_t size) {
+    const uint8_t * bytes = data;
+    size_t index;
+
+    // Igual que el DMA, si el buffer se llena se pisan los bytes más viejos
+    for (index = 0; serial_buffer != NULL && index < size; index++) {
+        serial_buffer[serial_head] = bytes[index];
+        serial_head = (serial_head + 1) % serial_size;
+    }
+}
+
+void HalHostSetSerialOutput(hal_host_serial_p output) {
+    serial_output = output;
+}
+
+/* === End of documentation ======================================================================================== */
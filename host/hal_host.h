@@ -0,0 +1,168 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef HAL_HOST_H_
+#define HAL_HOST_H_
+
+/** @file hal_host.h
+ ** @brief Declaraciones propias de la capa de abstracción del hardware para compilar en Linux - Electrónica 4 2025
+ **
+ ** Los puertos GPIO son registros en memoria y el tiempo es simulado: cada vez que el firmware duerme esperando una
+ ** interrupción se ejecuta una interrupción periódica y, si se pidió, el trabajo diferido. Estas funciones permiten
+ ** cambiar las entradas y observar las salidas desde el programa que ejecuta el firmware. Los registros son locales a
+ ** cada hilo, de modo que varios hilos pueden simular placas independientes.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "hal.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* === Public data type declarations =============================================================================== */
+
+/**
+ * @brief Función que recibe los bytes que el firmware envía por el puerto serie
+ *
+ * @param data bytes enviados
+ * @param size cantidad de bytes
+ */
+typedef void (*hal_host_serial_p)(const void * data, size_t size);
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Función que vuelve los registros y el tiempo simulado a su estado inicial
+ *
+ * El almacenamiento no volátil se vuelve a leer del archivo que lo respalda o se borra si no hay ninguno. El RTC
+ * pierde la hora, como en una placa sin batería de respaldo, salvo que se indique una con @ref HalHostSetRtc().
+ *
+ */
+void HalHostReset(void);
+
+/**
+ * @brief Función para poner en hora el RTC, como si la batería lo hubiera mantenido contando con la placa apagada
+ *
+ * Se llama después de @ref HalHostReset() y antes de iniciar el firmware.
+ *
+ * @param seconds segundos UTC desde 1970
+ */
+void HalHostSetRtc(uint32_t seconds);
+
+/**
+ * @brief Función para fijar el nivel eléctrico de un bit de entrada de un puerto GPIO
+ *
+ * @param gpio puerto GPIO
+ * @param bit bit dentro del puerto
+ * @param state nivel del bit
+ */
+void HalHostSetInput(uint8_t gpio, uint8_t bit, bool state);
+
+/**
+ * @brief Función que devuelve el valor escrito en el registro de salida de un puerto GPIO
+ *
+ * @param gpio puerto GPIO
+ * @return valor del registro de salida
+ */
+uint32_t HalHostGetOutput(uint8_t gpio);
+
+/**
+ * @brief Función que devuelve los bits de un puerto GPIO configurados como salida
+ *
+ * @param gpio puerto GPIO
+ * @return registro de dirección
+ */
+uint32_t HalHostGetDirection(uint8_t gpio);
+
+/**
+ * @brief Función que ejecuta una interrupción periódica y el trabajo diferido pendiente
+ *
+ */
+void HalHostTick(void);
+
+/**
+ * @brief Función para registrar una función que se llama al terminar cada interrupción periódica
+ *
+ * Permite a un simulador cambiar las entradas y observar las salidas sincronizado con el tiempo simulado.
+ *
+ * @param hook función que se llama, NULL para no llamar ninguna
+ */
+void HalHostSetTickHook(hal_handler_p hook);
+
+/**
+ * @brief Función que devuelve la cantidad de interrupciones periódicas simuladas desde el inicio
+ *
+ * @return cantidad de interrupciones
+ */
+uint64_t HalHostGetTicks(void);
+
+/**
+ * @brief Función que devuelve el tiempo simulado desde el inicio
+ *
+ * @return tiempo en milisegundos
+ */
+uint64_t HalHostGetMilliseconds(void);
+
+/**
+ * @brief Función para respaldar el almacenamiento no volátil en un archivo
+ *
+ * Cada escritura se guarda de inmediato en el archivo y @ref HalHostReset() vuelve a leerlo, como si se apagara y
+ * encendiera la placa. Si el archivo no existe se crea con el almacenamiento borrado. Sin archivo el almacenamiento
+ * empieza borrado en cada reinicio.
+ *
+ * @param path archivo que respalda el almacenamiento, NULL para cerrar el archivo actual
+ * @return true si se pudo abrir o crear el archivo
+ */
+bool HalHostStorageFile(const char * path);
+
+/**
+ * @brief Función que escribe bytes en el buffer de recepción del puerto serie, como lo haría el DMA
+ *
+ * No hace nada si el firmware todavía no inició el puerto serie.
+ *
+ * @param data bytes recibidos
+ * @param size cantidad de bytes
+ */
+void HalHostSerialReceive(const void * data, size_t size);
+
+/**
+ * @brief Función para registrar la función que recibe los bytes que el firmware envía por el puerto serie
+ *
+ * @param output función que recibe los bytes, NULL para descartarlos
+ */
+void HalHostSetSerialOutput(hal_host_serial_p output);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HAL_HOST_H_ */
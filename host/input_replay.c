@@ -0,0 +1,131 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file input_replay.c
+ ** @brief Grabación y reproducción de las entradas en el host - Electrónica 4 2025
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "input_replay.h"
+#include "digital_input.h"
+#include "hal_host.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+//! Estado de la grabación y la reproducción de una placa
+typedef struct input_replay_s {
+    input_trace_p recording;  //!< registro que se está grabando, NULL si no se graba
+    bool overflow;            //!< algún cambio no entró en el registro grabado
+    input_trace_p playing;    //!< registro que se está reproduciendo, NULL si no se reproduce
+    input_trace_event_t next; //!< próximo cambio a reproducir
+    bool pending;             //!< hay un cambio leído que todavía no se reprodujo
+} input_replay_t;
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Función que recibe los cambios de nivel leídos por las entradas digitales y los graba
+ *
+ */
+static void Observer(uint8_t port, uint32_t pin, bool level);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Estado de la placa que ejecuta este hilo
+static HAL_BOARD_LOCAL input_replay_t replay;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void Observer(uint8_t port, uint32_t pin, bool level) {
+    if (!InputTraceRecord(replay.recording, HalHostGetTicks(), port, (uint8_t)pin, level)) {
+        replay.overflow = true;
+    }
+}
+
+/* === Public function definitions ================================================================================= */
+
+void InputReplayRecord(input_trace_p trace) {
+    replay.recording = trace;
+    replay.overflow = false;
+    DigitalInputSetObserver(Observer);
+}
+
+size_t InputReplayStopRecording(void) {
+    size_t result = 0;
+
+    DigitalInputSetObserver(NULL);
+    if (replay.recording != NULL) {
+        result = InputTraceFinish(replay.recording, HalHostGetTicks());
+        if (replay.overflow) {
+            result = 0;
+        }
+        replay.recording = NULL;
+    }
+
+    return result;
+}
+
+void InputReplayPlay(input_trace_p trace) {
+    replay.playing = trace;
+    replay.pending = (trace != NULL) && InputTraceNext(trace, &replay.next);
+    InputReplayTick();
+}
+
+void InputReplayTick(void) {
+    uint64_t now = HalHostGetTicks();
+
+    while (replay.pending && replay.next.ticks <= now) {
+        HalHostSetInput(replay.next.gpio, replay.next.bit, replay.next.level);
+        replay.pending = InputTraceNext(replay.playing, &replay.next);
+    }
+}
+
+uint8_t * InputReplayLoad(const char * path, size_t * size) {
+    FILE * file = fopen(path, "rb");
+    uint8_t * result = NULL;
+    long length = -1;
+
+    if (file != NULL && fseek(file, 0, SEEK_END) == 0) {
+        length = ftell(file);
+        rewind(file);
+    }
+    if (length > 0) {
+        result = malloc((size_t)length);
+    }
+    if (result != NULL && fread(result, 1, (size_t)length, file) != (size_t)length) {
+        free(result);
+        result = NULL;
+    }
+    if (file != NULL) {
+        fclose(file);
+    }
+    *size = (result != NULL) ? (size_t)length : 0;
+
+    return result;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,98 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+#ifndef INPUT_REPLAY_H_
+#define INPUT_REPLAY_H_
+
+/** @file input_replay.h
+ ** @brief Declaraciones de la grabación y reproducción de las entradas en el host - Electrónica 4 2025
+ **
+ ** La grabación observa las lecturas de todas las entradas digitales y guarda en un registro cada cambio de nivel con
+ ** la cantidad de ticks del host. La reproducción pone cada nivel en el registro de entrada del host al terminar la
+ ** interrupción periódica de ese tick, antes de que el lazo principal vuelva a leer las entradas, por lo que el
+ ** firmware lee los mismos valores en los mismos ticks que durante la grabación. El estado es local a cada hilo.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "input_trace.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* === Public data type declarations =============================================================================== */
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Función que empieza a grabar las entradas, se debe llamar antes de crear las entradas digitales
+ *
+ * @param trace registro creado con @ref InputTraceCreate()
+ */
+void InputReplayRecord(input_trace_p trace);
+
+/**
+ * @brief Función que termina la grabación con la cantidad de ticks actual del host
+ *
+ * @return tamaño del registro en bytes, 0 si el buffer se llenó durante la grabación
+ */
+size_t InputReplayStopRecording(void);
+
+/**
+ * @brief Función que empieza a reproducir un registro y pone los niveles del tick 0
+ *
+ * Se debe llamar después de @ref HalHostReset() y antes de crear las entradas digitales.
+ *
+ * @param trace registro abierto con @ref InputTraceOpen()
+ */
+void InputReplayPlay(input_trace_p trace);
+
+/**
+ * @brief Función que pone los niveles hasta el tick actual del host, se llama al final de cada interrupción periódica
+ *
+ */
+void InputReplayTick(void);
+
+/**
+ * @brief Función que carga un archivo completo en memoria
+ *
+ * @param path archivo a leer
+ * @param size tamaño del archivo
+ * @return contenido del archivo que se libera con free, NULL si no se puede leer
+ */
+uint8_t * InputReplayLoad(const char * path, size_t * size);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INPUT_REPLAY_H_ */
@@ -0,0 +1,728 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file sim_board.c
+ ** @brief Placa simulada que ejecuta el firmware completo con tiempo virtual - Electrónica 4 2025
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "sim_board.h"
+#include "hal_host.h"
+#include "input_replay.h"
+#include "display.h"
+#include "shield_config.h"
+#include "telemetry.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! Duración por defecto de una pulsación en milisegundos
+#define SIM_DEFAULT_PRESS   100
+
+//! Tiempo sin actividad en milisegundos para considerar que el zumbador se apagó, mayor al período del PWM
+#define SIM_BUZZER_RELEASE  50
+
+//! Cantidad de dígitos del display del poncho
+#define SIM_DIGITS          4
+
+//! Largo máximo del texto del display
+#define SIM_TEXT_SIZE       16
+
+//! Largo máximo de una línea enviada o recibida por el puerto serie
+#define SIM_SERIAL_SIZE     96
+
+/* === Private data type declarations ============================================================================== */
+
+//! Tipos de órdenes del guion
+typedef enum {
+    ACTION_PRESS,          //!< pone una tecla en el nivel activo
+    ACTION_RELEASE,        //!< pone una tecla en el nivel inactivo
+    ACTION_EXPECT_DISPLAY, //!< compara el display
+    ACTION_EXPECT_BUZZER,  //!< compara el zumbador
+    ACTION_SEND,           //!< envía una línea por el puerto serie
+    ACTION_EXPECT_SERIAL,  //!< compara la última línea recibida por el puerto serie
+    ACTION_EXPECT_DRIFT,   //!< compara la deriva de la última trama de estado de la telemetría
+    ACTION_END,            //!< termina la simulación
+} action_e;
+
+//! Orden del guion
+typedef struct action_s {
+    uint64_t at;                //!< tiempo simulado en milisegundos
+    uint32_t order;             //!< posición en el guion, ordena las acciones del mismo instante
+    action_e type;              //!< tipo de orden
+    uint8_t gpio;               //!< puerto GPIO de la tecla
+    uint8_t bit;                //!< bit de la tecla
+    bool on;                    //!< estado esperado del zumbador
+    uint32_t limit;             //!< máxima deriva esperada, en valor absoluto
+    char text[SIM_SERIAL_SIZE]; //!< texto esperado en el display o en el puerto serie, o línea a enviar
+    unsigned line;              //!< línea del guion, para informar errores
+} action_t;
+
+//! Tecla del poncho
+typedef struct sim_key_s {
+    const char * name; //!< nombre usado en el guion
+    uint8_t gpio;      //!< puerto GPIO
+    uint8_t bit;       //!< bit dentro del puerto
+} sim_key_t;
+
+//! Guion ya interpretado
+struct sim_script_s {
+    action_t * actions; //!< órdenes del guion ordenadas por tiempo
+    size_t count;       //!< cantidad de órdenes
+    size_t capacity;    //!< espacio reservado para las órdenes
+};
+
+//! Estado de una placa simulada
+struct sim_board_s {
+    sim_script_p script;                 //!< guion que se ejecuta
+    FILE * output;                       //!< archivo donde se registran las salidas
+    size_t next;                         //!< próxima orden a ejecutar
+    uint64_t end;                        //!< tiempo en que termina la simulación
+    bool finished;                       //!< la simulación terminó
+    uint32_t failures;                   //!< cantidad de comparaciones fallidas
+    uint32_t events;                     //!< cantidad de cambios de las salidas
+    uint8_t frame[SIM_DIGITS];           //!< segmentos de cada dígito en el último barrido
+    uint8_t steady[SIM_DIGITS];          //!< último dibujo de cada dígito con algún segmento prendido, sin punto
+    char recorded[SIM_TEXT_SIZE];        //!< último texto del display registrado
+    bool buzzer;                         //!< estado registrado del zumbador
+    uint32_t buzzer_idle;                //!< milisegundos que el zumbador está inactivo
+    input_trace_p record;                //!< registro donde se graban las entradas
+    input_trace_p replay;                //!< registro que se reproduce
+    char serial[SIM_SERIAL_SIZE];        //!< línea que el firmware está enviando por el puerto serie
+    size_t serial_length;                //!< largo de la línea que se está enviando
+    char answer[SIM_SERIAL_SIZE];        //!< última línea completa que envió el firmware
+    bool binary;                         //!< el puerto serie está enviando una trama de telemetría
+    uint8_t packet[TELEMETRY_MAX_FRAME]; //!< bytes de la trama de telemetría que se está enviando
+    size_t packet_length;                //!< bytes recibidos de la trama, más que el máximo si no es una trama válida
+    bool status_valid;                   //!< se recibió al menos una trama de estado
+    telemetry_status_t status;           //!< última trama de estado recibida
+    FILE * serial_log;                   //!< archivo donde se guardan los bytes enviados por el puerto serie
+    uint32_t dark;                       //!< interrupciones seguidas sin ningún dígito prendido
+    int64_t rtc;                         //!< segundos del RTC al iniciar la placa, negativo si está detenido
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Función que agrega una orden a un guion
+ *
+ * @param script referencia al guion
+ * @return referencia a la orden agregada, NULL si no hay memoria
+ */
+static action_t * AddAction(sim_script_p script);
+
+/**
+ * @brief Función que compara dos órdenes por tiempo y posición en el guion para qsort
+ *
+ */
+static int CompareActions(const void * a, const void * b);
+
+/**
+ * @brief Función que interpreta una línea del guion
+ *
+ * @param script referencia al guion
+ * @param line texto de la línea
+ * @param number número de línea
+ * @return true si la línea es válida
+ */
+static bool ParseLine(sim_script_p script, const char * line, unsigned number);
+
+/**
+ * @brief Función que copia el resto de una línea del guion después de saltear algunas palabras
+ *
+ * @param line texto de la línea
+ * @param words cantidad de palabras a saltear
+ * @param text texto resultante, sin los espacios ni el salto de línea del final
+ * @return true si el resto no está vacío y entra en @ref SIM_SERIAL_SIZE
+ */
+static bool RestOfLine(const char * line, int words, char * text);
+
+/**
+ * @brief Función que arma el texto que representa un display
+ *
+ * @param segments segmentos de cada dígito, el dígito 0 es el de la derecha
+ * @param text texto resultante
+ */
+static void FrameToText(const uint8_t * segments, char * text);
+
+/**
+ * @brief Función que registra un cambio de las salidas
+ *
+ * @param board referencia a la placa
+ * @param now tiempo simulado en milisegundos
+ * @param text descripción del cambio
+ */
+static void Record(sim_board_p board, uint64_t now, const char * text);
+
+/**
+ * @brief Función que ejecuta las órdenes del guion que vencieron
+ *
+ * @param board referencia a la placa
+ * @param now tiempo simulado en milisegundos
+ */
+static void RunActions(sim_board_p board, uint64_t now);
+
+/**
+ * @brief Función que recibe los bytes que el firmware envía por el puerto serie y registra cada línea completa
+ *
+ * @param data bytes enviados
+ * @param size cantidad de bytes
+ */
+static void SerialOutput(const void * data, size_t size);
+
+/**
+ * @brief Función que guarda el contenido de una trama de estado completa de la telemetría
+ *
+ * @param board referencia a la placa
+ */
+static void DecodeStatus(sim_board_p board);
+
+/**
+ * @brief Función que observa las salidas al final de cada interrupción periódica y ejecuta el guion
+ *
+ */
+static void TickHook(void);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Teclas del poncho que se pueden usar en el guion
+static const sim_key_t KEYS[] = {
+    {"accept", KEY_ACCEPT_GPIO, KEY_ACCEPT_BIT},  {"cancel", KEY_CANCEL_GPIO, KEY_CANCEL_BIT},
+    {"set_time", KEY_F1_GPIO, KEY_F1_BIT},        {"set_alarm", KEY_F2_GPIO, KEY_F2_BIT},
+    {"decrement", KEY_F3_GPIO, KEY_F3_BIT},       {"increment", KEY_F4_GPIO, KEY_F4_BIT},
+};
+
+//! Segmentos de cada número, igual que en el módulo display
+static const uint8_t NUMBERS[10] = {
+    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F,             // 0
+    SEGMENT_B | SEGMENT_C,                                                             // 1
+    SEGMENT_A | SEGMENT_B | SEGMENT_D | SEGMENT_E | SEGMENT_G,                         // 2
+    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_G,                         // 3
+    SEGMENT_B | SEGMENT_C | SEGMENT_F | SEGMENT_G,                                     // 4
+    SEGMENT_A | SEGMENT_C | SEGMENT_D | SEGMENT_F | SEGMENT_G,                         // 5
+    SEGMENT_A | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G,             // 6
+    SEGMENT_A | SEGMENT_B | SEGMENT_C,                                                 // 7
+    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G, // 8
+    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_F | SEGMENT_G,             // 9
+};
+
+//! Placa que se ejecuta en cada hilo
+static HAL_BOARD_LOCAL sim_board_p current = NULL;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static action_t * AddAction(sim_script_p script) {
+    action_t * action = NULL;
+    action_t * actions;
+
+    if (script->count == script->capacity) {
+        script->capacity = (script->capacity == 0) ? 64 : 2 * script->capacity;
+        actions = realloc(script->actions, script->capacity * sizeof(action_t));
+        if (actions != NULL) {
+            script->actions = actions;
+        } else {
+            script->capacity = script->count;
+        }
+    }
+    if (script->count < script->capacity) {
+        action = &script->actions[script->count];
+        memset(action, 0, sizeof(action_t));
+        action->order = (uint32_t)script->count;
+        script->count++;
+    }
+
+    return action;
+}
+
+static int CompareActions(const void * a, const void * b) {
+    const action_t * first = a;
+    const action_t * second = b;
+    int result = 0;
+
+    if (first->at != second->at) {
+        result = (first->at < second->at) ? -1 : 1;
+    } else if (first->order != second->order) {
+        result = (first->order < second->order) ? -1 : 1;
+    }
+
+    return result;
+}
+
+static bool ParseLine(sim_script_p script, const char * line, unsigned number) {
+    char at[32], command[16], argument[32], extra[SIM_TEXT_SIZE];
+    uint64_t hold = SIM_DEFAULT_PRESS;
+    action_t action = {.line = number};
+    action_t * added;
+    size_t key = 0;
+    char * end;
+    int fields = sscanf(line, "%31s %15s %31s %15s", at, command, argument, extra);
+    bool result = true;
+
+    if (fields > 0 && at[0] != '#') {
+        result = SimParseTime(at, &action.at) && (fields >= 2);
+        if (result && strcmp(command, "press") == 0 && fields >= 3) {
+            while (key < sizeof(KEYS) / sizeof(KEYS[0]) && strcmp(KEYS[key].name, argument) != 0) {
+                key++;
+            }
+            result = (key < sizeof(KEYS) / sizeof(KEYS[0])) && ((fields == 3) || SimParseTime(extra, &hold));
+            action.type = ACTION_PRESS;
+            action.gpio = result ? KEYS[key].gpio : 0;
+            action.bit = result ? KEYS[key].bit : 0;
+        } else if (result && strcmp(command, "expect") == 0 && fields == 4 && strcmp(argument, "display") == 0) {
+            action.type = ACTION_EXPECT_DISPLAY;
+            strcpy(action.text, extra);
+        } else if (result && strcmp(command, "expect") == 0 && fields == 4 && strcmp(argument, "buzzer") == 0) {
+            action.type = ACTION_EXPECT_BUZZER;
+            action.on = (strcmp(extra, "on") == 0);
+            result = action.on || (strcmp(extra, "off") == 0);
+        } else if (result && strcmp(command, "expect") == 0 && fields == 4 && strcmp(argument, "serial") == 0) {
+            action.type = ACTION_EXPECT_SERIAL;
+            result = RestOfLine(line, 3, action.text);
+        } else if (result && strcmp(command, "expect") == 0 && fields == 4 && strcmp(argument, "drift") == 0) {
+            action.type = ACTION_EXPECT_DRIFT;
+            action.limit = (uint32_t)strtoul(extra, &end, 10);
+            result = (*end == 0);
+        } else if (result && strcmp(command, "send") == 0 && fields >= 3) {
+            action.type = ACTION_SEND;
+            result = RestOfLine(line, 2, action.text);
+        } else if (result && strcmp(command, "end") == 0) {
+            action.type = ACTION_END;
+        } else {
+            result = false;
+        }
+
+        if (result) {
+            added = AddAction(script);
+            result = (added != NULL);
+            if (result) {
+                action.order = added->order;
+                *added = action;
+            }
+        }
+        // Una pulsación se guarda como dos órdenes, presionar y soltar
+        if (result && action.type == ACTION_PRESS) {
+            added = AddAction(script);
+            result = (added != NULL);
+            if (result) {
+                action.order = added->order;
+                action.type = ACTION_RELEASE;
+                action.at += hold;
+                *added = action;
+            }
+        }
+    }
+
+    return result;
+}
+
+static bool RestOfLine(const char * line, int words, char * text) {
+    size_t length;
+    int word;
+
+    for (word = 0; word < words; word++) {
+        line += strspn(line, " \t");
+        line += strcspn(line, " \t\r\n");
+    }
+    line += strspn(line, " \t");
+    length = strcspn(line, "\r\n");
+    while (length > 0 && (line[length - 1] == ' ' || line[length - 1] == '\t')) {
+        length--;
+    }
+    if (length > 0 && length < SIM_SERIAL_SIZE) {
+        memcpy(text, line, length);
+        text[length] = 0;
+    }
+
+    return length > 0 && length < SIM_SERIAL_SIZE;
+}
+
+static void FrameToText(const uint8_t * segments, char * text) {
+    int digit;
+    uint8_t number;
+
+    for (digit = SIM_DIGITS - 1; digit >= 0; digit--) {
+        if ((segments[digit] & SEGMENTS_MASK) == 0) {
+            *text++ = '_';
+        } else {
+            *text = '?';
+            for (number = 0; number < 10; number++) {
+                if ((segments[digit] & SEGMENTS_MASK) == NUMBERS[number]) {
+                    *text = (char)('0' + number);
+                }
+            }
+            text++;
+        }
+        if (segments[digit] & SEGMENT_DOT_MASK) {
+            *text++ = '.';
+        }
+    }
+    *text = 0;
+}
+
+static void Record(sim_board_p board, uint64_t now, const char * text) {
+    board->events++;
+    if (board->output != NULL) {
+        fprintf(board->output, "%llu %s\n", (unsigned long long)now, text);
+    }
+}
+
+static void RunActions(sim_board_p board, uint64_t now) {
+    const action_t * action;
+    char text[SIM_TEXT_SIZE];
+
+    while (board->script != NULL && board->next < board->script->count &&
+           board->script->actions[board->next].at <= now) {
+        action = &board->script->actions[board->next++];
+        switch (action->type) {
+        case ACTION_PRESS:
+            // Las teclas se crean sin invertir, el nivel alto es el activo
+            HalHostSetInput(action->gpio, action->bit, true);
+            break;
+        case ACTION_RELEASE:
+            HalHostSetInput(action->gpio, action->bit, false);
+            break;
+        case ACTION_EXPECT_DISPLAY:
+            FrameToText(board->steady, text);
+            if (strcmp(text, action->text) != 0) {
+                board->failures++;
+                if (board->output != NULL) {
+                    fprintf(stderr, "línea %u: se esperaba el display %s y se ve %s\n", action->line, action->text,
+                            text);
+                }
+            }
+            break;
+        case ACTION_EXPECT_BUZZER:
+            if (board->buzzer != action->on) {
+                board->failures++;
+                if (board->output != NULL) {
+                    fprintf(stderr, "línea %u: se esperaba el zumbador %s\n", action->line, action->on ? "on" : "off");
+                }
+            }
+            break;
+        case ACTION_SEND:
+            HalHostSerialReceive(action->text, strlen(action->text));
+            HalHostSerialReceive("\r\n", 2);
+            break;
+        case ACTION_EXPECT_SERIAL:
+            if (strcmp(board->answer, action->text) != 0) {
+                board->failures++;
+                if (board->output != NULL) {
+                    fprintf(stderr, "línea %u: se esperaba la respuesta %s y se recibió %s\n", action->line,
+                            action->text, board->answer);
+                }
+            }
+            break;
+        case ACTION_EXPECT_DRIFT:
+            if (!board->status_valid || board->status.tick_drift > (int64_t)action->limit ||
+                board->status.tick_drift < -(int64_t)action->limit) {
+                board->failures++;
+                if (board->output != NULL) {
+                    fprintf(stderr, "línea %u: se esperaba una deriva de hasta %lu y se recibió %ld\n", action->line,
+                            (unsigned long)action->limit, board->status_valid ? (long)board->status.tick_drift : 0L);
+                }
+            }
+            break;
+        case ACTION_END:
+            board->end = now;
+            break;
+        }
+    }
+}
+
+static void TickHook(void) {
+    sim_board_p board = current;
+    uint64_t now = HalHostGetMilliseconds();
+    uint32_t digits = HalHostGetOutput(DIGITS_GPIO) & DIGITS_MASK;
+    uint8_t segments;
+    uint8_t digit;
+    char text[SIM_TEXT_SIZE];
+    char line[SIM_TEXT_SIZE + 8];
+
+    // Dígito prendido en este barrido del display multiplexado
+    if (digits != 0) {
+        board->dark = 0;
+        digit = (uint8_t)__builtin_ctz(digits);
+        segments = (uint8_t)(HalHostGetOutput(SEGMENTS_GPIO) & SEGMENTS_MASK);
+        if (HalHostGetOutput(SEGMENT_DOT_GPIO) & (1UL << SEGMENT_DOT_BIT)) {
+            segments |= SEGMENT_DOT_MASK;
+        }
+        board->frame[digit] = segments;
+        if (segments & SEGMENTS_MASK) {
+            board->steady[digit] = segments & SEGMENTS_MASK;
+        }
+
+        // Se registra el display cuando se completa un barrido, el display lo empieza en el dígito 0
+        if (digit == SIM_DIGITS - 1) {
+            FrameToText(board->frame, text);
+            if (strcmp(text, board->recorded) != 0) {
+                strcpy(board->recorded, text);
+                strcpy(line, "display ");
+                strcat(line, text);
+                Record(board, now, line);
+            }
+        }
+    } else if (++board->dark == SIM_DIGITS) {
+        // El barrido prende un dígito en cada interrupción, sin ninguno en todo un barrido la pantalla está apagada
+        memset(board->frame, 0, sizeof(board->frame));
+        memset(board->steady, 0, sizeof(board->steady));
+        FrameToText(board->frame, text);
+        if (strcmp(text, board->recorded) != 0) {
+            strcpy(board->recorded, text);
+            strcpy(line, "display ");
+            strcat(line, text);
+            Record(board, now, line);
+        }
+    }
+
+    // El zumbador es activo en bajo
+    if ((HalHostGetOutput(RGB_RED_GPIO) & (1UL << RGB_RED_BIT)) == 0) {
+        board->buzzer_idle = 0;
+        if (!board->buzzer) {
+            board->buzzer = true;
+            Record(board, now, "buzzer on");
+        }
+    } else if (board->buzzer) {
+        board->buzzer_idle++;
+        if (board->buzzer_idle == SIM_BUZZER_RELEASE) {
+            board->buzzer = false;
+            Record(board, now - SIM_BUZZER_RELEASE, "buzzer off");
+        }
+    }
+
+    RunActions(board, now);
+    InputReplayTick();
+    if (now >= board->end) {
+        board->finished = true;
+    }
+}
+
+static void DecodeStatus(sim_board_p board) {
+    telemetry_frame_t frame;
+
+    if (TelemetryDecode(board->packet, board->packet_length, &frame) == 0 && frame.type == TELEMETRY_STATUS &&
+        frame.size == sizeof(board->status)) {
+        memcpy(&board->status, frame.payload.bytes, sizeof(board->status));
+        board->status_valid = true;
+    }
+}
+
+static void SerialOutput(const void * data, size_t size) {
+    sim_board_p board = current;
+    const char * bytes = data;
+    char line[SIM_SERIAL_SIZE + 8];
+    size_t index;
+
+    if (board->serial_log != NULL) {
+        fwrite(data, 1, size, board->serial_log);
+    }
+    // Las tramas de telemetría empiezan y terminan con un byte en cero, que no aparece en el texto de la consola
+    for (index = 0; index < size; index++) {
+        if (bytes[index] == 0) {
+            board->binary = !board->binary;
+            if (board->binary) {
+                board->packet_length = 0;
+            } else if (board->packet_length <= sizeof(board->packet)) {
+                DecodeStatus(board);
+            }
+        } else if (board->binary) {
+            // Un tramo más largo que una trama no se decodifica
+            if (board->packet_length < sizeof(board->packet)) {
+                board->packet[board->packet_length] = (uint8_t)bytes[index];
+            }
+            if (board->packet_length <= sizeof(board->packet)) {
+                board->packet_length++;
+            }
+        } else if (!board->binary && bytes[index] == '\n') {
+            board->serial[board->serial_length] = 0;
+            strcpy(board->answer, board->serial);
+            board->serial_length = 0;
+            strcpy(line, "serial ");
+            strcat(line, board->answer);
+            Record(board, HalHostGetMilliseconds(), line);
+        } else if (!board->binary && bytes[index] != '\r' && board->serial_length < SIM_SERIAL_SIZE - 1) {
+            board->serial[board->serial_length++] = bytes[index];
+        }
+    }
+}
+
+/* === Public function definitions ================================================================================= */
+
+bool SimParseTime(const char * text, uint64_t * value) {
+    bool result = (*text != 0);
+    uint64_t number;
+    char * end;
+
+    *value = 0;
+    while (result && *text != 0) {
+        number = strtoull(text, &end, 10);
+        if (end == text) {
+            result = false;
+        } else if (strncmp(end, "ms", 2) == 0) {
+            *value += number;
+            end += 2;
+        } else if (*end == 's') {
+            *value += number * 1000;
+            end++;
+        } else if (*end == 'm') {
+            *value += number * 60 * 1000;
+            end++;
+        } else if (*end == 'h') {
+            *value += number * 3600 * 1000;
+            end++;
+        } else if (*end == 'd') {
+            *value += number * 24 * 3600 * 1000;
+            end++;
+        } else if (*end == 0) {
+            *value += number;
+        } else {
+            result = false;
+        }
+        text = end;
+    }
+
+    return result;
+}
+
+sim_script_p SimScriptLoad(const char * path) {
+    sim_script_p script = calloc(1, sizeof(struct sim_script_s));
+    FILE * file = fopen(path, "r");
+    char line[128];
+    unsigned number = 0;
+    bool valid = (script != NULL) && (file != NULL);
+
+    if (file == NULL) {
+        fprintf(stderr, "no se puede abrir el guion %s\n", path);
+    }
+
+    while (valid && fgets(line, sizeof(line), file) != NULL) {
+        number++;
+        valid = ParseLine(script, line, number);
+        if (!valid) {
+            fprintf(stderr, "%s: orden inválida en la línea %u\n", path, number);
+        }
+    }
+
+    if (valid && script->count > 0) {
+        qsort(script->actions, script->count, sizeof(action_t), CompareActions);
+    }
+    if (file != NULL) {
+        fclose(file);
+    }
+    if (!valid) {
+        SimScriptDestroy(script);
+        script = NULL;
+    }
+
+    return script;
+}
+
+void SimScriptDestroy(sim_script_p script) {
+    if (script != NULL) {
+        free(script->actions);
+        free(script);
+    }
+}
+
+sim_board_p SimBoardCreate(sim_script_p script, FILE * output) {
+    sim_board_p self = calloc(1, sizeof(struct sim_board_s));
+
+    if (self != NULL) {
+        self->script = script;
+        self->output = output;
+        self->rtc = -1;
+    }
+
+    return self;
+}
+
+void SimBoardDestroy(sim_board_p board) {
+    free(board);
+}
+
+void SimBoardSetTraces(sim_board_p board, input_trace_p record, input_trace_p replay) {
+    board->record = record;
+    board->replay = replay;
+}
+
+void SimBoardSetSerialLog(sim_board_p board, FILE * log) {
+    board->serial_log = log;
+}
+
+void SimBoardSetRtc(sim_board_p board, int64_t seconds) {
+    board->rtc = seconds;
+}
+
+void SimBoardRun(sim_board_p board, const app_config_t * config, uint64_t duration, sim_result_t * result) {
+    uint64_t last;
+
+    board->next = 0;
+    board->end = duration;
+    board->finished = false;
+    board->failures = 0;
+    board->events = 0;
+    board->buzzer = false;
+    board->buzzer_idle = 0;
+    board->recorded[0] = 0;
+    memset(board->frame, 0, sizeof(board->frame));
+    memset(board->steady, 0, sizeof(board->steady));
+    board->serial_length = 0;
+    board->answer[0] = 0;
+    board->binary = false;
+    board->packet_length = 0;
+    board->status_valid = false;
+    board->dark = 0;
+
+    current = board;
+    HalHostReset();
+    if (board->rtc >= 0 && board->rtc <= UINT32_MAX) {
+        HalHostSetRtc((uint32_t)board->rtc);
+    }
+    HalHostSetTickHook(TickHook);
+    HalHostSetSerialOutput(SerialOutput);
+    InputReplayPlay(board->replay);
+    if (board->replay != NULL) {
+        last = InputTraceDuration(board->replay) * 1000 / InputTraceTicksPerSecond(board->replay);
+        board->end = (last < board->end) ? last : board->end;
+    }
+    if (board->record != NULL) {
+        InputReplayRecord(board->record);
+    }
+    AppInit(config);
+    result->boot_latency = AppGetBootLatency();
+    while (!board->finished) {
+        AppRun();
+    }
+    result->recorded = InputReplayStopRecording();
+    AppGetDeadlineStats(&result->deadlines);
+    InputReplayPlay(NULL);
+    HalHostSetTickHook(NULL);
+    HalHostSetSerialOutput(NULL);
+    current = NULL;
+
+    result->simulated_ms = HalHostGetMilliseconds();
+    result->ticks = HalHostGetTicks();
+    result->events = board->events;
+    result->failures = board->failures;
+}
+
+/* === End of documentation ======================================================================================== */
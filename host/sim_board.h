@@ -0,0 +1,183 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef SIM_BOARD_H_
+#define SIM_BOARD_H_
+
+/** @file sim_board.h
+ ** @brief Declaraciones de una placa simulada que ejecuta el firmware completo con tiempo virtual - Electrónica 4 2025
+ **
+ ** Una placa ejecuta la aplicación del reloj sobre la capa de abstracción del hardware del host. El tiempo avanza una
+ ** interrupción periódica cada vez que el lazo principal duerme, de modo que se simulan días de funcionamiento en
+ ** segundos. Un guion de texto indica cuando se presionan las teclas y que se espera ver en las salidas, y la placa
+ ** registra cada cambio del display y del zumbador.
+ **
+ ** Formato del guion, una orden por línea, los tiempos se escriben como 1d2h30m15s500ms:
+ ** \li `<tiempo> press <tecla> [<duración>]` mantiene presionada una tecla, 100 ms si no se indica la duración
+ ** \li `<tiempo> expect display <texto>` compara los números del display, por ejemplo `1234`
+ ** \li `<tiempo> expect buzzer on|off` compara el estado del zumbador
+ ** \li `<tiempo> send <texto>` envía una línea a la consola por el puerto serie, por ejemplo `time 12:30`
+ ** \li `<tiempo> expect serial <texto>` compara la última línea completa que respondió la consola
+ ** \li `<tiempo> expect drift <máximo>` compara el valor absoluto de la deriva de la última trama de estado de la
+ **     telemetría, falla si todavía no se recibió ninguna
+ ** \li `<tiempo> end` termina la simulación
+ **
+ ** Las teclas son accept, cancel, set_time, set_alarm, decrement e increment. En el registro un dígito apagado se
+ ** muestra como `_`, un dibujo que no es un número como `?` y un punto prendido como `.` después del dígito. Las
+ ** comparaciones del display usan el último dibujo de cada dígito sin los puntos, así el parpadeo no las afecta, y
+ ** la pantalla apagada se registra y se compara como `____`. Cada línea que responde la consola también se registra,
+ ** sin el retorno de carro. Las tramas binarias de telemetry.h que comparten el puerto serie no se registran, pero se
+ ** pueden guardar con todos los bytes enviados, ver SimBoardSetSerialLog.
+ **
+ ** Una placa también puede grabar las entradas que lee el firmware en un registro binario y reproducirlo después,
+ ** ver input_replay.h. Al reproducir conviene usar un guion que solo tenga comparaciones.
+ **
+ ** El estado del hardware es local a cada hilo, por lo que cada hilo puede ejecutar una placa a la vez.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "app.h"
+#include "input_trace.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* === Public data type declarations =============================================================================== */
+
+//! Referencia a un guion, se puede compartir entre placas porque no se modifica al ejecutarlo
+typedef struct sim_script_s * sim_script_p;
+
+//! Referencia a una placa simulada
+typedef struct sim_board_s * sim_board_p;
+
+//! Resultado de la ejecución de una placa
+typedef struct sim_result_s {
+    uint64_t simulated_ms;          //!< tiempo simulado en milisegundos
+    uint64_t ticks;                 //!< interrupciones periódicas simuladas
+    uint32_t events;                //!< cambios registrados del display y del zumbador
+    uint32_t failures;              //!< comparaciones del guion que fallaron
+    size_t recorded;                //!< bytes del registro grabado, 0 si no se grabó o se llenó el buffer
+    app_deadline_stats_t deadlines; //!< cumplimiento de los plazos del trabajo periódico
+    uint32_t boot_latency;          //!< cuentas de HalTimestamp hasta tener una hora válida, 0 si no había una guardada
+} sim_result_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Función que convierte un tiempo escrito como 1d2h30m15s500ms a milisegundos
+ *
+ * Un número sin unidad se interpreta en milisegundos.
+ *
+ * @param text texto a convertir
+ * @param value tiempo en milisegundos
+ * @return true si el texto es válido
+ */
+bool SimParseTime(const char * text, uint64_t * value);
+
+/**
+ * @brief Función que lee un guion y ordena sus órdenes por tiempo
+ *
+ * @param path archivo del guion
+ * @return referencia al guion, NULL si no se puede leer o tiene errores
+ */
+sim_script_p SimScriptLoad(const char * path);
+
+/**
+ * @brief Función que libera un guion
+ *
+ * @param script referencia al guion
+ */
+void SimScriptDestroy(sim_script_p script);
+
+/**
+ * @brief Función para crear una placa simulada
+ *
+ * @param script guion que se ejecuta, NULL para no presionar teclas
+ * @param output archivo donde se registran las salidas, NULL para no registrarlas
+ * @return referencia a la placa, NULL si no hay memoria
+ */
+sim_board_p SimBoardCreate(sim_script_p script, FILE * output);
+
+/**
+ * @brief Función que libera una placa simulada
+ *
+ * @param board referencia a la placa
+ */
+void SimBoardDestroy(sim_board_p board);
+
+/**
+ * @brief Función que indica los registros de entradas que usa la placa en la próxima ejecución
+ *
+ * Al reproducir, la simulación termina como máximo en el último tick grabado. La frecuencia de la interrupción
+ * periódica debe ser la misma que durante la grabación.
+ *
+ * @param board referencia a la placa
+ * @param record registro donde se graban las entradas, NULL para no grabar
+ * @param replay registro que se reproduce, NULL para no reproducir
+ */
+void SimBoardSetTraces(sim_board_p board, input_trace_p record, input_trace_p replay);
+
+/**
+ * @brief Función que indica el archivo donde se guardan todos los bytes que envía el puerto serie de la placa
+ *
+ * @param board referencia a la placa
+ * @param log archivo binario abierto, NULL para no guardarlos
+ */
+void SimBoardSetSerialLog(sim_board_p board, FILE * log);
+
+/**
+ * @brief Función que indica la hora del RTC al iniciar la próxima ejecución, como si hubiera seguido con la batería
+ *
+ * Sin llamarla el RTC arranca detenido y el firmware le escribe la hora al apagar la pantalla.
+ *
+ * @param board referencia a la placa
+ * @param seconds segundos UTC desde 1970, negativo para arrancar con el RTC detenido
+ */
+void SimBoardSetRtc(sim_board_p board, int64_t seconds);
+
+/**
+ * @brief Función que ejecuta el firmware en la placa hasta la orden end del guion o hasta el tiempo indicado
+ *
+ * Se ejecuta completa en el hilo que la llama.
+ *
+ * @param board referencia a la placa
+ * @param config parámetros de la aplicación, NULL para los valores por defecto
+ * @param duration tiempo simulado máximo en milisegundos
+ * @param result resultado de la ejecución
+ */
+void SimBoardRun(sim_board_p board, const app_config_t * config, uint64_t duration, sim_result_t * result);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SIM_BOARD_H_ */
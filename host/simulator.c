@@ -0,0 +1,281 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file simulator.c
+ ** @brief Simulador del firmware completo con tiempo virtual - Electrónica 4 2025
+ **
+ ** Ejecuta una placa simulada con un guion y registra los cambios del display y del zumbador. El formato del guion se
+ ** describe en sim_board.h. Termina con 1 si alguna comparación del guion falló.
+ **
+ ** Con -w graba en un archivo binario las entradas que lee el firmware y con -p reproduce una grabación con la misma
+ ** frecuencia de la interrupción periódica, el formato se describe en input_trace.h.
+ **
+ ** Con -P escribe al terminar una línea JSON por cada región medida de profiler.h. Las duraciones son nanosegundos
+ ** reales del host, no del tiempo simulado.
+ **
+ ** Con -T escribe al terminar una línea JSON por cada registro de event_trace.h que sigue en el buffer circular, con
+ ** los tiempos en milisegundos simulados.
+ **
+ ** Con -e el almacenamiento no volátil se guarda en un archivo, de modo que la próxima ejecución con el mismo archivo
+ ** arranca con la hora y la alarma que quedaron guardadas, como si se reiniciara la placa.
+ **
+ ** Con -Z el reloj muestra la hora local de una zona en formato POSIX TZ, por ejemplo `CET-1CEST,M3.5.0,M10.5.0/3`.
+ **
+ ** Con -S guarda todos los bytes que envía el puerto serie, incluidas las tramas de telemetría que se leen con
+ ** telemetry_decoder. La telemetría se activa desde el guion con la orden `send telemetry <segundos>`.
+ **
+ ** Con -R el RTC arranca con los segundos UTC desde 1970 indicados, como si hubiera seguido contando con la batería, y
+ ** el reloj arranca con esa hora. La pantalla se apaga desde el guion con la orden `send display <segundos>`.
+ **
+ ** Uso: simulator [-s guion] [-t duración] [-o salidas] [-r frecuencia] [-z posposición] [-w grabación] [-p grabación]
+ **                [-P mediciones] [-T eventos] [-e almacenamiento] [-Z zona] [-S puerto serie] [-R segundos]
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "sim_board.h"
+#include "input_replay.h"
+#include "profiler.h"
+#include "event_trace.h"
+#include "hal_host.h"
+#include "timezone.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! Tiempo simulado por defecto en milisegundos, si el guion no tiene la orden end
+#define SIMULATOR_DEFAULT_DURATION (24ULL * 3600ULL * 1000ULL)
+
+//! Tamaño del buffer de la grabación de las entradas
+#define SIMULATOR_TRACE_SIZE       (1024UL * 1024UL)
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+/* === Public function definitions ================================================================================= */
+
+int main(int argc, char * argv[]) {
+    sim_script_p script = NULL;
+    sim_board_p board = NULL;
+    sim_result_t stats;
+    app_config_t config = {.ticks_per_second = 1000, .seconds_snoozed = 300};
+    uint64_t duration = SIMULATOR_DEFAULT_DURATION;
+    FILE * output = stdout;
+    FILE * serial_log = NULL;
+    int64_t rtc = -1;
+    char * end;
+    const char * record_path = NULL;
+    uint8_t * record_buffer = NULL;
+    input_trace_p record = NULL;
+    uint8_t * replay_buffer = NULL;
+    size_t replay_size;
+    input_trace_p replay = NULL;
+    const char * profile_path = NULL;
+    profiler_region_t region;
+    const char * events_path = NULL;
+    event_trace_record_t event;
+    timezone_t zone;
+    uint32_t cursor = 0;
+    uint32_t sequence;
+    char line[512];
+    size_t index;
+    FILE * file;
+    struct timespec start, stop;
+    double wall;
+    int option;
+    int result = 0;
+
+    for (option = 1; option < argc && result == 0; option++) {
+        if (strcmp(argv[option], "-s") == 0 && option + 1 < argc) {
+            script = SimScriptLoad(argv[++option]);
+            result = (script == NULL) ? 2 : 0;
+        } else if (strcmp(argv[option], "-t") == 0 && option + 1 < argc) {
+            result = SimParseTime(argv[++option], &duration) ? 0 : 2;
+        } else if (strcmp(argv[option], "-o") == 0 && option + 1 < argc) {
+            output = fopen(argv[++option], "w");
+            if (output == NULL) {
+                fprintf(stderr, "no se puede crear el archivo de salidas %s\n", argv[option]);
+                result = 2;
+            }
+        } else if (strcmp(argv[option], "-r") == 0 && option + 1 < argc) {
+            config.ticks_per_second = (uint16_t)strtoul(argv[++option], NULL, 10);
+            // La aplicación cuenta milisegundos enteros por interrupción
+            result = (config.ticks_per_second > 0 && 1000 % config.ticks_per_second == 0) ? 0 : 2;
+        } else if (strcmp(argv[option], "-z") == 0 && option + 1 < argc) {
+            config.seconds_snoozed = (uint32_t)strtoul(argv[++option], NULL, 10);
+        } else if (strcmp(argv[option], "-P") == 0 && option + 1 < argc) {
+            profile_path = argv[++option];
+        } else if (strcmp(argv[option], "-T") == 0 && option + 1 < argc) {
+            events_path = argv[++option];
+        } else if (strcmp(argv[option], "-e") == 0 && option + 1 < argc) {
+            if (!HalHostStorageFile(argv[++option])) {
+                fprintf(stderr, "no se puede abrir el almacenamiento %s\n", argv[option]);
+                result = 2;
+            }
+        } else if (strcmp(argv[option], "-Z") == 0 && option + 1 < argc) {
+            config.timezone = argv[++option];
+            if (TimezoneParse(&zone, config.timezone) != 0) {
+                fprintf(stderr, "la zona %s no es válida\n", config.timezone);
+                result = 2;
+            }
+        } else if (strcmp(argv[option], "-S") == 0 && option + 1 < argc) {
+            serial_log = fopen(argv[++option], "wb");
+            if (serial_log == NULL) {
+                fprintf(stderr, "no se puede crear el archivo del puerto serie %s\n", argv[option]);
+                result = 2;
+            }
+        } else if (strcmp(argv[option], "-R") == 0 && option + 1 < argc) {
+            rtc = strtoll(argv[++option], &end, 10);
+            result = (*end == 0 && rtc >= 0 && rtc <= UINT32_MAX) ? 0 : 2;
+        } else if (strcmp(argv[option], "-w") == 0 && option + 1 < argc) {
+            record_path = argv[++option];
+        } else if (strcmp(argv[option], "-p") == 0 && option + 1 < argc) {
+            replay_buffer = InputReplayLoad(argv[++option], &replay_size);
+            replay = (replay_buffer != NULL) ? InputTraceOpen(replay_buffer, replay_size) : NULL;
+            if (replay == NULL) {
+                fprintf(stderr, "la grabación %s no es válida\n", argv[option]);
+                result = 2;
+            }
+        } else {
+            result = 2;
+        }
+    }
+    if (result != 0) {
+        fprintf(stderr, "uso: %s [-s guion] [-t duración] [-o salidas] [-r frecuencia] [-z posposición] [-w grabación] "
+                        "[-p grabación] [-P mediciones] [-T eventos] [-e almacenamiento] [-Z zona] [-S puerto serie] "
+                        "[-R segundos]\n",
+                argv[0]);
+    }
+
+    if (result == 0 && replay != NULL) {
+        config.ticks_per_second = InputTraceTicksPerSecond(replay);
+    }
+    if (result == 0 && record_path != NULL) {
+        record_buffer = malloc(SIMULATOR_TRACE_SIZE);
+        record = (record_buffer != NULL) ? InputTraceCreate(record_buffer, SIMULATOR_TRACE_SIZE,
+                                                            config.ticks_per_second)
+                                         : NULL;
+        result = (record == NULL) ? 2 : 0;
+    }
+
+    if (result == 0) {
+        board = SimBoardCreate(script, output);
+        result = (board == NULL) ? 2 : 0;
+    }
+
+    if (result == 0) {
+        SimBoardSetTraces(board, record, replay);
+        SimBoardSetSerialLog(board, serial_log);
+        SimBoardSetRtc(board, rtc);
+    }
+
+    if (result == 0) {
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        SimBoardRun(board, &config, duration, &stats);
+        clock_gettime(CLOCK_MONOTONIC, &stop);
+
+        wall = (double)(stop.tv_sec - start.tv_sec) + (double)(stop.tv_nsec - start.tv_nsec) / 1e9;
+        fprintf(stderr, "simulados %.3f s en %.3f s, %.0f veces el tiempo real, %u comparaciones fallidas\n",
+                (double)stats.simulated_ms / 1000.0, wall, (double)stats.simulated_ms / 1000.0 / wall,
+                stats.failures);
+        fprintf(stderr, "plazos: peor interrupción %u de %u ns, %u demoradas, peor atraso del lazo %u ms, "
+                        "%u periodos salteados\n",
+                stats.deadlines.tick_worst, stats.deadlines.tick_period, stats.deadlines.tick_overruns,
+                stats.deadlines.loop_worst, stats.deadlines.loop_skipped);
+        // El tiempo simulado no avanza mientras corren las tareas, el ciclo de trabajo solo se mide en la placa
+        fprintf(stderr, "lazo: %u despertares\n", stats.deadlines.loop_wakeups);
+        if (stats.boot_latency != 0) {
+            fprintf(stderr, "arranque: hora válida recuperada en %u ns\n", stats.boot_latency);
+        } else {
+            fprintf(stderr, "arranque: sin hora guardada\n");
+        }
+        result = (stats.failures == 0) ? 0 : 1;
+    }
+
+    if (result != 2 && profile_path != NULL) {
+        file = fopen(profile_path, "w");
+        for (index = 0; file != NULL && ProfilerSnapshot(index, &region) == 0; index++) {
+            ProfilerFormat(&region, line, sizeof(line));
+            fputs(line, file);
+        }
+        if (file == NULL) {
+            fprintf(stderr, "no se pueden guardar las mediciones en %s\n", profile_path);
+            result = 2;
+        } else {
+            fclose(file);
+        }
+    }
+
+    if (result != 2 && events_path != NULL) {
+        file = fopen(events_path, "w");
+        while (file != NULL && EventTraceRead(&cursor, &sequence, &event) == 0) {
+            EventTraceFormat(sequence, &event, line, sizeof(line));
+            fputs(line, file);
+        }
+        if (file == NULL) {
+            fprintf(stderr, "no se pueden guardar los eventos en %s\n", events_path);
+            result = 2;
+        } else {
+            fclose(file);
+        }
+    }
+
+    if (result != 2 && record != NULL) {
+        file = fopen(record_path, "wb");
+        if (stats.recorded == 0 || file == NULL || fwrite(record_buffer, 1, stats.recorded, file) != stats.recorded) {
+            fprintf(stderr, "no se puede guardar la grabación %s\n", record_path);
+            result = 2;
+        } else {
+            fprintf(stderr, "grabados %zu bytes en %s\n", stats.recorded, record_path);
+        }
+        if (file != NULL) {
+            fclose(file);
+        }
+    }
+
+    if (output != NULL && output != stdout) {
+        fclose(output);
+    }
+    if (serial_log != NULL) {
+        fclose(serial_log);
+    }
+    HalHostStorageFile(NULL);
+    SimBoardDestroy(board);
+    SimScriptDestroy(script);
+    InputTraceDestroy(record);
+    InputTraceDestroy(replay);
+    free(record_buffer);
+    free(replay_buffer);
+
+    return result;
+}
+
+/* === End of documentation ======================================================================================== */
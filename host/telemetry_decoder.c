@@ -0,0 +1,181 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file telemetry_decoder.c
+ ** @brief Decodificador de las tramas de telemetría que envía el reloj por el puerto serie - Electrónica 4 2025
+ **
+ ** Lee los bytes recibidos por el puerto serie desde un archivo o desde la entrada estándar, por ejemplo el que guarda
+ ** el simulador con -S o una captura de la placa, y escribe una línea JSON por cada trama válida. Los eventos se
+ ** escriben en el mismo formato que usa el simulador con -T. Los tramos que no se decodifican, como el texto de la
+ ** consola, se ignoran, y los saltos en el número de trama se informan como tramas perdidas.
+ **
+ ** Uso: telemetry_decoder [archivo]
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "telemetry.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+//! Contadores de la decodificación
+typedef struct decoder_stats_s {
+    uint32_t frames;  //!< tramas válidas
+    uint32_t ignored; //!< tramos que no son tramas válidas
+    uint32_t lost;    //!< tramas que faltan según los números de trama
+} decoder_stats_t;
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Función que escribe las estadísticas de una magnitud medida
+ *
+ * @param stats estadísticas
+ * @param count cantidad de mediciones
+ */
+static void PrintStats(const profiler_stats_t * stats, uint32_t count);
+
+/**
+ * @brief Función que escribe el contenido de una trama válida
+ *
+ * @param frame trama decodificada
+ */
+static void PrintFrame(const telemetry_frame_t * frame);
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void PrintStats(const profiler_stats_t * stats, uint32_t count) {
+    printf("{\"min\":%lu,\"max\":%lu,\"mean\":%lu}", (unsigned long)((count != 0) ? stats->min : 0),
+           (unsigned long)stats->max, (unsigned long)((count != 0) ? stats->total / count : 0));
+}
+
+static void PrintFrame(const telemetry_frame_t * frame) {
+    telemetry_status_t status;
+    telemetry_region_t region;
+    telemetry_event_t event;
+    char line[160];
+    size_t index;
+
+    if (frame->type == TELEMETRY_STATUS && frame->size == sizeof(status)) {
+        memcpy(&status, frame->payload.bytes, sizeof(status));
+        printf("{\"frame\":%u,\"uptime\":%lu,\"tick_drift\":%ld,\"tick_period\":%lu,\"tick_worst\":%lu,"
+               "\"tick_overruns\":%lu,\"loop_worst\":%lu,\"loop_skipped\":%lu,\"loop_wakeups\":%lu,"
+               "\"loop_busy\":%lu,\"alarm_rings\":%lu,\"alarm_snoozes\":%lu,\"frames_skipped\":%lu,\"buttons\":[",
+               frame->sequence, (unsigned long)status.uptime, (long)status.tick_drift,
+               (unsigned long)status.tick_period, (unsigned long)status.tick_worst,
+               (unsigned long)status.tick_overruns, (unsigned long)status.loop_worst,
+               (unsigned long)status.loop_skipped, (unsigned long)status.loop_wakeups,
+               (unsigned long)status.loop_busy, (unsigned long)status.alarm_rings,
+               (unsigned long)status.alarm_snoozes, (unsigned long)status.frames_skipped);
+        for (index = 0; index < TELEMETRY_BUTTONS; index++) {
+            printf("%s%lu", (index == 0) ? "" : ",", (unsigned long)status.buttons[index]);
+        }
+        printf("]}\n");
+    } else if (frame->type == TELEMETRY_REGION && frame->size == sizeof(region)) {
+        memcpy(&region, frame->payload.bytes, sizeof(region));
+        printf("{\"frame\":%u,\"name\":\"%.*s\",\"count\":%lu,\"duration\":", frame->sequence,
+               (int)strnlen(region.name, sizeof(region.name)), region.name, (unsigned long)region.count);
+        PrintStats(&region.duration, region.count);
+        printf(",\"latency\":");
+        PrintStats(&region.latency, region.count);
+        printf("}\n");
+    } else if (frame->type == TELEMETRY_EVENTS && frame->size % sizeof(event) == 0) {
+        for (index = 0; index < frame->size / sizeof(event); index++) {
+            memcpy(&event, &frame->payload.bytes[index * sizeof(event)], sizeof(event));
+            EventTraceFormat(event.sequence, &event.record, line, sizeof(line));
+            fputs(line, stdout);
+        }
+    } else {
+        printf("{\"frame\":%u,\"type\":%u,\"size\":%u}\n", frame->sequence, frame->type, frame->size);
+    }
+}
+
+/* === Public function definitions ================================================================================= */
+
+int main(int argc, char * argv[]) {
+    static telemetry_frame_t frame;
+    uint8_t chunk[TELEMETRY_MAX_FRAME];
+    decoder_stats_t stats = {0};
+    FILE * input = stdin;
+    size_t length = 0;
+    bool overflow = false;
+    uint8_t expected = 0;
+    int byte;
+    int result = 0;
+
+    if (argc > 2) {
+        fprintf(stderr, "uso: %s [archivo]\n", argv[0]);
+        result = 2;
+    } else if (argc == 2) {
+        input = fopen(argv[1], "rb");
+        if (input == NULL) {
+            fprintf(stderr, "no se puede abrir %s\n", argv[1]);
+            result = 2;
+        }
+    }
+
+    // Cada byte en cero termina un tramo, los tramos más largos que una trama no pueden ser tramas
+    while (result == 0 && (byte = fgetc(input)) != EOF) {
+        if (byte != 0) {
+            overflow = overflow || length == sizeof(chunk);
+            if (!overflow) {
+                chunk[length++] = (uint8_t)byte;
+            }
+        } else if (length > 0 || overflow) {
+            if (!overflow && TelemetryDecode(chunk, length, &frame) == 0) {
+                if (stats.frames > 0 && frame.sequence != expected) {
+                    stats.lost += (uint8_t)(frame.sequence - expected);
+                    fprintf(stderr, "faltan %u tramas antes de la %u\n", (uint8_t)(frame.sequence - expected),
+                            frame.sequence);
+                }
+                expected = (uint8_t)(frame.sequence + 1);
+                stats.frames++;
+                PrintFrame(&frame);
+            } else {
+                stats.ignored++;
+            }
+            length = 0;
+            overflow = false;
+        }
+    }
+
+    if (result == 0) {
+        fprintf(stderr, "%u tramas, %u perdidas, %u tramos ignorados\n", stats.frames, stats.lost, stats.ignored);
+        result = (stats.frames > 0) ? 0 : 1;
+    }
+    if (input != NULL && input != stdin) {
+        fclose(input);
+    }
+
+    return result;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,204 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file time_server.c
+ ** @brief Servidor de la hora para el firmware en tiempo real del host - Electrónica 4 2025
+ **
+ ** Se conecta a la pseudo terminal que informa el firmware al arrancar, `consola serie en /dev/pts/N`, y responde cada
+ ** pedido `sync <número>` con la hora UTC del host según time_sync.h. Las demás líneas que envía el firmware, como el
+ ** desplazamiento y la demora medidos, se escriben en la salida estándar y las tramas de telemetría se ignoran.
+ **
+ ** Con -p envía la orden sync cada tantos segundos, para que la placa pida la hora aunque no tenga un periodo
+ ** configurado. Con -o la hora que responde se corre los milisegundos indicados, para probar las correcciones.
+ **
+ ** Uso: time_server [-p segundos] [-o milisegundos] puerto
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#define _XOPEN_SOURCE 700
+
+#include <fcntl.h>
+#include <poll.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! Largo máximo de una línea que envía el firmware
+#define SERVER_LINE_SIZE 128
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Función que devuelve la hora UTC del host más el corrimiento indicado
+ *
+ * @param offset milisegundos que se suman a la hora
+ * @return milisegundos desde 1970
+ */
+static int64_t NowMilliseconds(int64_t offset);
+
+/**
+ * @brief Función que pone la pseudo terminal en modo crudo, sin eco ni conversión de los fines de línea
+ *
+ * @param port descriptor de la pseudo terminal
+ * @return true si se pudo configurar
+ */
+static bool RawMode(int port);
+
+/**
+ * @brief Función que atiende una línea completa que envió el firmware
+ *
+ * @param port descriptor de la pseudo terminal
+ * @param line línea sin el fin de línea
+ * @param received hora en la que llegó el último byte de la línea, en milisegundos desde 1970
+ * @param offset milisegundos que se suman a la hora del host
+ */
+static void HandleLine(int port, const char * line, int64_t received, int64_t offset);
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static int64_t NowMilliseconds(int64_t offset) {
+    struct timespec now;
+
+    clock_gettime(CLOCK_REALTIME, &now);
+    return (int64_t)now.tv_sec * 1000 + now.tv_nsec / 1000000 + offset;
+}
+
+static bool RawMode(int port) {
+    struct termios settings;
+    bool result = tcgetattr(port, &settings) == 0;
+
+    if (result) {
+        settings.c_iflag &= ~(tcflag_t)(IGNBRK | BRKINT | ICRNL | INLCR | IGNCR | ISTRIP | IXON);
+        settings.c_oflag &= ~(tcflag_t)OPOST;
+        settings.c_lflag &= ~(tcflag_t)(ECHO | ECHONL | ICANON | ISIG | IEXTEN);
+        result = tcsetattr(port, TCSANOW, &settings) == 0;
+    }
+
+    return result;
+}
+
+static void HandleLine(int port, const char * line, int64_t received, int64_t offset) {
+    char reply[SERVER_LINE_SIZE];
+    unsigned sequence;
+    char extra;
+    int length;
+
+    if (sscanf(line, "sync %u%c", &sequence, &extra) == 1) {
+        // La demora cuenta desde que llegó el pedido hasta justo antes de escribir la respuesta
+        length = snprintf(reply, sizeof(reply), "sync %u %lld %lld %lld\r\n", sequence, (long long)(received / 1000),
+                          (long long)(received % 1000), (long long)(NowMilliseconds(offset) - received));
+        if (write(port, reply, (size_t)length) != length) {
+            fprintf(stderr, "no se pudo responder el pedido %u\n", sequence);
+        }
+    } else if (line[0] != 0) {
+        printf("%s\n", line);
+        fflush(stdout);
+    }
+}
+
+/* === Public function definitions ================================================================================= */
+
+int main(int argc, char * argv[]) {
+    struct pollfd port = {.fd = -1, .events = POLLIN};
+    char line[SERVER_LINE_SIZE];
+    size_t length = 0;
+    bool binary = false;
+    uint8_t buffer[64];
+    ssize_t count;
+    ssize_t index;
+    int64_t offset = 0;
+    int64_t now;
+    int64_t next_poll = 0;
+    long period = 0;
+    int option;
+    int result = 0;
+
+    for (option = 1; option < argc - 1 && result == 0; option++) {
+        if (strcmp(argv[option], "-p") == 0 && option + 1 < argc - 1) {
+            period = strtol(argv[++option], NULL, 10);
+            result = (period > 0) ? 0 : 2;
+        } else if (strcmp(argv[option], "-o") == 0 && option + 1 < argc - 1) {
+            offset = strtoll(argv[++option], NULL, 10);
+        } else {
+            result = 2;
+        }
+    }
+    if (result == 0 && option == argc - 1) {
+        port.fd = open(argv[option], O_RDWR | O_NOCTTY);
+        if (port.fd < 0 || !RawMode(port.fd)) {
+            fprintf(stderr, "no se puede abrir el puerto %s\n", argv[option]);
+            result = 2;
+        }
+    } else {
+        fprintf(stderr, "uso: %s [-p segundos] [-o milisegundos] puerto\n", argv[0]);
+        result = 2;
+    }
+
+    while (result == 0) {
+        now = NowMilliseconds(0);
+        if (period > 0 && now >= next_poll) {
+            next_poll = now + period * 1000;
+            if (write(port.fd, "sync\r\n", 6) != 6) {
+                result = 1;
+            }
+        }
+        if (result == 0 && poll(&port, 1, 100) > 0) {
+            count = read(port.fd, buffer, sizeof(buffer));
+            now = NowMilliseconds(offset);
+            result = (count > 0) ? 0 : 1;
+            // Las tramas de telemetría van entre dos bytes en cero, que no aparecen en el texto de la consola
+            for (index = 0; index < count; index++) {
+                if (buffer[index] == 0) {
+                    binary = !binary;
+                } else if (!binary && buffer[index] == '\n') {
+                    line[length] = 0;
+                    HandleLine(port.fd, line, now, offset);
+                    length = 0;
+                } else if (!binary && buffer[index] != '\r' && length < sizeof(line) - 1) {
+                    line[length++] = (char)buffer[index];
+                }
+            }
+        }
+    }
+    if (result == 1) {
+        fprintf(stderr, "se cerró el puerto\n");
+    }
+    if (port.fd >= 0) {
+        close(port.fd);
+    }
+
+    return result;
+}
+
+/* === End of documentation ======================================================================================== */
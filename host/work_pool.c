@@ -0,0 +1,204 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file work_pool.c
+ ** @brief Grupo de hilos con robo de trabajo - Electrónica 4 2025
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "work_pool.h"
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+struct work_pool_s;
+
+//! Trabajos pendientes de un hilo, es un rango de índices
+typedef struct worker_s {
+    pthread_mutex_t lock;      //!< protege el rango de índices
+    size_t first;              //!< primer índice pendiente, desde acá roban los otros hilos
+    size_t last;               //!< índice siguiente al último pendiente, desde acá toma el dueño
+    uint64_t steals;           //!< robos que hizo este hilo
+    uint64_t attempts;         //!< intentos de robo de este hilo
+    unsigned id;               //!< número de hilo
+    pthread_t thread;          //!< hilo del sistema operativo
+    bool started;              //!< el hilo del sistema operativo se creó
+    struct work_pool_s * pool; //!< grupo al que pertenece
+} worker_t;
+
+//! Grupo de hilos
+typedef struct work_pool_s {
+    worker_t * workers; //!< hilos del grupo
+    unsigned count;     //!< cantidad de hilos
+    work_job_p job;     //!< función que ejecuta cada trabajo
+    void * context;     //!< contexto de los trabajos
+} work_pool_t;
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Función que toma el último trabajo pendiente de un hilo
+ *
+ * @param worker hilo dueño de los trabajos
+ * @param index índice del trabajo tomado
+ * @return true si había un trabajo pendiente
+ */
+static bool TakeJob(worker_t * worker, size_t * index);
+
+/**
+ * @brief Función que roba la mitad de los trabajos pendientes de otro hilo
+ *
+ * @param thief hilo que se quedó sin trabajos
+ * @return true si consiguió trabajos
+ */
+static bool StealJobs(worker_t * thief);
+
+/**
+ * @brief Función que ejecuta cada hilo del grupo
+ *
+ * @param argument referencia al hilo
+ * @return NULL
+ */
+static void * WorkerMain(void * argument);
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static bool TakeJob(worker_t * worker, size_t * index) {
+    bool result = false;
+
+    pthread_mutex_lock(&worker->lock);
+    if (worker->first < worker->last) {
+        worker->last--;
+        *index = worker->last;
+        result = true;
+    }
+    pthread_mutex_unlock(&worker->lock);
+
+    return result;
+}
+
+static bool StealJobs(worker_t * thief) {
+    work_pool_t * pool = thief->pool;
+    worker_t * victim;
+    size_t first, last;
+    unsigned i;
+    bool result = false;
+
+    // Recorre los demás hilos empezando por el siguiente, así los robos no se concentran en un único hilo
+    for (i = 1; i < pool->count && !result; i++) {
+        victim = &pool->workers[(thief->id + i) % pool->count];
+        thief->attempts++;
+
+        pthread_mutex_lock(&victim->lock);
+        first = victim->first;
+        last = first + (victim->last - victim->first + 1) / 2;
+        victim->first = last;
+        pthread_mutex_unlock(&victim->lock);
+
+        if (first < last) {
+            pthread_mutex_lock(&thief->lock);
+            thief->first = first;
+            thief->last = last;
+            pthread_mutex_unlock(&thief->lock);
+            thief->steals++;
+            result = true;
+        }
+    }
+
+    return result;
+}
+
+static void * WorkerMain(void * argument) {
+    worker_t * worker = argument;
+    size_t index;
+    bool pending = true;
+
+    // Los trabajos no crean trabajos nuevos, si no hay nada para robar en ningún hilo terminó la ejecución
+    while (pending) {
+        if (TakeJob(worker, &index)) {
+            worker->pool->job(index, worker->pool->context);
+        } else {
+            pending = StealJobs(worker);
+        }
+    }
+
+    return NULL;
+}
+
+/* === Public function definitions ================================================================================= */
+
+int WorkPoolRun(unsigned workers, size_t jobs, work_job_p job, void * context, work_pool_stats_t * stats) {
+    work_pool_t pool = {.count = (workers == 0) ? 1 : workers, .job = job, .context = context};
+    unsigned i;
+    int result = 0;
+
+    pool.workers = calloc(pool.count, sizeof(worker_t));
+    if (pool.workers == NULL) {
+        result = -1;
+    }
+
+    for (i = 0; i < pool.count && result == 0; i++) {
+        pthread_mutex_init(&pool.workers[i].lock, NULL);
+        pool.workers[i].first = jobs * i / pool.count;
+        pool.workers[i].last = jobs * (i + 1) / pool.count;
+        pool.workers[i].id = i;
+        pool.workers[i].pool = &pool;
+    }
+
+    // El hilo que llama ejecuta los trabajos del hilo 0. Si no se puede crear un hilo sus trabajos los roban los demás
+    for (i = 1; i < pool.count && result == 0; i++) {
+        pool.workers[i].started = (pthread_create(&pool.workers[i].thread, NULL, WorkerMain, &pool.workers[i]) == 0);
+    }
+    if (result == 0) {
+        WorkerMain(&pool.workers[0]);
+        for (i = 1; i < pool.count; i++) {
+            if (pool.workers[i].started) {
+                pthread_join(pool.workers[i].thread, NULL);
+            }
+        }
+    }
+
+    if (stats != NULL) {
+        stats->steals = 0;
+        stats->attempts = 0;
+    }
+    for (i = 0; i < pool.count && pool.workers != NULL; i++) {
+        if (stats != NULL) {
+            stats->steals += pool.workers[i].steals;
+            stats->attempts += pool.workers[i].attempts;
+        }
+        pthread_mutex_destroy(&pool.workers[i].lock);
+    }
+    free(pool.workers);
+
+    return result;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,83 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef WORK_POOL_H_
+#define WORK_POOL_H_
+
+/** @file work_pool.h
+ ** @brief Declaraciones de un grupo de hilos con robo de trabajo - Electrónica 4 2025
+ **
+ ** Reparte un conjunto de trabajos independientes, identificados por su índice, entre varios hilos. Cada hilo empieza
+ ** con un bloque contiguo de índices y los ejecuta desde el final; cuando se queda sin trabajos le roba la mitad de los
+ ** que le quedan a otro hilo, desde el principio de su bloque. Así los trabajos de distinta duración se equilibran
+ ** sin una cola compartida.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* === Public data type declarations =============================================================================== */
+
+/**
+ * @brief Función que ejecuta un trabajo
+ *
+ * @param index índice del trabajo
+ * @param context contexto indicado en @ref WorkPoolRun()
+ */
+typedef void (*work_job_p)(size_t index, void * context);
+
+//! Estadísticas de una ejecución
+typedef struct work_pool_stats_s {
+    uint64_t steals;   //!< cantidad de robos de trabajo
+    uint64_t attempts; //!< cantidad de intentos de robo, incluidos los que no encontraron trabajo
+} work_pool_stats_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Función que ejecuta todos los trabajos y espera a que terminen
+ *
+ * @param workers cantidad de hilos
+ * @param jobs cantidad de trabajos, se ejecutan los índices de 0 a jobs - 1
+ * @param job función que ejecuta cada trabajo
+ * @param context contexto que se pasa a cada trabajo
+ * @param stats estadísticas de la ejecución, puede ser NULL
+ * @return 0 si se ejecutaron todos los trabajos, -1 si no hay memoria para el grupo
+ */
+int WorkPoolRun(unsigned workers, size_t jobs, work_job_p job, void * context, work_pool_stats_t * stats);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* WORK_POOL_H_ */
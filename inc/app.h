@@ -0,0 +1,127 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef APP_H_
+#define APP_H_
+
+/** @file app.h
+ ** @brief Declaraciones de la aplicación del reloj despertador - Electrónica 4 2025
+ **
+ ** La aplicación no contiene el lazo principal, de modo que el mismo código se puede ejecutar en la placa desde main()
+ ** o desde un simulador en el host que controla el avance del tiempo.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "clock.h"
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* === Public data type declarations =============================================================================== */
+
+//! Trabajo periódico cuyos plazos se vigilan
+typedef enum app_deadline_e {
+    APP_DEADLINE_TICK, //!< rutina de la interrupción periódica
+    APP_DEADLINE_LOOP, //!< revisión de las entradas en el lazo principal
+} app_deadline_e;
+
+/**
+ * @brief Función que se llama cuando el trabajo periódico no cumple su plazo
+ *
+ * Para @ref APP_DEADLINE_TICK se llama desde la interrupción periódica.
+ *
+ * @param source trabajo atrasado
+ * @param lateness atraso, en cuentas de HalTimestamp para la interrupción y en milisegundos para el lazo principal
+ */
+typedef void (*app_deadline_hook_p)(app_deadline_e source, uint32_t lateness);
+
+//! Parámetros de la aplicación que se pueden cambiar al iniciarla
+typedef struct app_config_s {
+    uint16_t ticks_per_second;         //!< frecuencia de la interrupción periódica, debe ser un divisor de 1000
+    uint32_t seconds_snoozed;          //!< segundos que se pospone la alarma
+    clock_alarm_policy_t alarm_policy; //!< límites de la alarma que suena, en cero no la limitan
+    app_deadline_hook_p deadline_hook; //!< función que se llama al no cumplir un plazo, puede ser NULL
+    const char * timezone;             //!< zona horaria en formato POSIX TZ, NULL para mostrar la hora UTC
+    uint16_t telemetry_period;         //!< segundos entre envíos de la telemetría por la consola, 0 no la envía
+    uint16_t sync_period;              //!< segundos entre pedidos de la hora al servidor, 0 solo con la orden sync
+    uint16_t display_timeout;          //!< segundos sin usar las teclas hasta apagar la pantalla, 0 no la apaga
+} app_config_t;
+
+//! Cumplimiento de los plazos del trabajo periódico desde que se inició la aplicación
+typedef struct app_deadline_stats_s {
+    uint32_t tick_period;   //!< periodo de la interrupción periódica, en cuentas de HalTimestamp
+    uint32_t tick_worst;    //!< máximo tiempo desde el disparo de la interrupción hasta el final de su rutina
+    uint32_t tick_overruns; //!< rutinas que terminaron después del disparo de la siguiente interrupción
+    uint32_t loop_worst;    //!< máximo atraso de la revisión de las entradas, en milisegundos
+    uint32_t loop_skipped;  //!< periodos de la revisión de las entradas que no se ejecutaron por atraso
+    uint32_t loop_wakeups;  //!< veces que el lazo principal despertó al procesador
+    uint32_t loop_busy;     //!< ciclo de trabajo del procesador, en millonésimos del tiempo transcurrido
+} app_deadline_stats_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Función que crea los objetos de la aplicación e inicia la interrupción periódica
+ *
+ * @param config parámetros de la aplicación, NULL para usar los valores por defecto
+ */
+void AppInit(const app_config_t * config);
+
+/**
+ * @brief Función que ejecuta una iteración del lazo principal
+ *
+ * Ejecuta las tareas vencidas o, si no hay ninguna, duerme al procesador hasta la próxima interrupción.
+ *
+ */
+void AppRun(void);
+
+/**
+ * @brief Función que devuelve el cumplimiento de los plazos del trabajo periódico
+ *
+ * El margen de la interrupción periódica es tick_period - tick_worst.
+ *
+ * @param stats variable en la que se devuelven los resultados
+ */
+void AppGetDeadlineStats(app_deadline_stats_t * stats);
+
+/**
+ * @brief Función que devuelve el tiempo que tardó la aplicación en tener una hora válida al iniciar
+ *
+ * Se mide desde el llamado a @ref AppInit() hasta que se recuperó la hora guardada en el almacenamiento no volátil.
+ *
+ * @return tiempo en cuentas de HalTimestamp, 0 si no había una hora guardada
+ */
+uint32_t AppGetBootLatency(void);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* APP_H_ */
@@ -0,0 +1,67 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef APP_CONSOLE_H_
+#define APP_CONSOLE_H_
+
+/** @file app_console.h
+ ** @brief Declaraciones de las órdenes de la consola serie de la aplicación - Electrónica 4 2025
+ **
+ ** Registra en console.h las órdenes que leen y cambian la hora, la fecha y la alarma del reloj, muestran las
+ ** estadísticas y el trazado de eventos, y configuran la telemetría, la sincronización y el apagado de la pantalla.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "clock.h"
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* === Public data type declarations =============================================================================== */
+
+//! Función que se llama cuando una orden cambió la hora o la alarma del reloj
+typedef void (*app_console_changed_p)(void);
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Función que inicia la consola con las órdenes de la aplicación
+ *
+ * La consola se atiende llamando periódicamente a ConsolePoll() de console.h.
+ *
+ * @param reference reloj que leen y cambian las órdenes
+ * @param changed función que se llama cuando una orden cambió el reloj
+ */
+void AppConsoleInit(clock_p reference, app_console_changed_p changed);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* APP_CONSOLE_H_ */
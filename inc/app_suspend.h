@@ -0,0 +1,113 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef APP_SUSPEND_H_
+#define APP_SUSPEND_H_
+
+/** @file app_suspend.h
+ ** @brief Declaraciones del apagado de la pantalla de la aplicación sin usar las teclas - Electrónica 4 2025
+ **
+ ** Con la pantalla apagada se detiene la interrupción periódica y el reloj sigue en el RTC. La pantalla vuelve a
+ ** prenderse con una tecla o con el aviso del RTC.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "clock.h"
+#include "shield.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* === Public data type declarations =============================================================================== */
+
+//! Interface con las funciones que avisan a la aplicación que se apagó o se prendió la pantalla
+typedef struct app_suspend_driver_s {
+    void (*Suspended)(void); //!< se llama después de apagar la pantalla y detener la interrupción periódica
+    void (*Resumed)(void);   //!< se llama desde la interrupción que despierta, antes de reiniciar la periódica
+} const * app_suspend_driver_p;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Función que reinicia el estado con la pantalla prendida
+ *
+ * @param reference reloj que se suspende con la pantalla apagada
+ * @param board poncho con la pantalla y las teclas
+ * @param timeout segundos sin usar las teclas hasta apagar la pantalla, 0 no la apaga
+ * @param driver funciones que se llaman al apagar y al prender la pantalla
+ */
+void AppSuspendInit(clock_p reference, shield_p board, uint16_t timeout, app_suspend_driver_p driver);
+
+/**
+ * @brief Función que cuenta el tiempo sin usar las teclas y apaga la pantalla al cumplirse el plazo
+ *
+ * Solo se apaga si el reloj se pudo suspender.
+ *
+ * @param elapsed milisegundos desde la llamada anterior
+ * @param used true si se usaron las teclas o la consola desde la llamada anterior
+ * @param allowed true si la aplicación está en un estado en el que se puede apagar la pantalla
+ */
+void AppSuspendIdle(uint32_t elapsed, bool used, bool allowed);
+
+/**
+ * @brief Función que indica si se deben ignorar las teclas porque una de ellas despertó al procesador
+ *
+ * Las teclas se ignoran hasta soltarlas todas, mientras tanto se descartan sus flancos.
+ *
+ * @return true si se deben ignorar las teclas
+ */
+bool AppSuspendKeysHeld(void);
+
+/**
+ * @brief Función que atiende el aviso del RTC, prende la pantalla si estaba apagada
+ *
+ */
+void AppSuspendRtcAlarm(void);
+
+/**
+ * @brief Función que devuelve los segundos sin usar las teclas hasta apagar la pantalla
+ *
+ * @return segundos, 0 si no se apaga
+ */
+uint16_t AppSuspendGetTimeout(void);
+
+/**
+ * @brief Función que cambia los segundos sin usar las teclas hasta apagar la pantalla
+ *
+ * @param timeout segundos, 0 no la apaga
+ */
+void AppSuspendSetTimeout(uint16_t timeout);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* APP_SUSPEND_H_ */
@@ -0,0 +1,106 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef APP_SYNC_H_
+#define APP_SYNC_H_
+
+/** @file app_sync.h
+ ** @brief Declaraciones de la sincronización de la hora de la aplicación con el servidor - Electrónica 4 2025
+ **
+ ** Envía los pedidos de la hora por la consola y corrige el reloj con las respuestas, las cuentas las hace
+ ** time_sync.h.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "clock.h"
+#include "time_sync.h"
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* === Public data type declarations =============================================================================== */
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Función que reinicia el estado de la sincronización
+ *
+ * @param reference reloj que se corrige
+ * @param period segundos entre pedidos de la hora al servidor, 0 solo se piden con @ref AppSyncRequest()
+ */
+void AppSyncInit(clock_p reference, uint16_t period);
+
+/**
+ * @brief Tarea periódica que envía los pedidos de la hora al servidor cuando corresponde, se llama cada un segundo
+ *
+ */
+void AppSyncTask(void);
+
+/**
+ * @brief Función que envía por la consola un pedido de la hora al servidor
+ *
+ */
+void AppSyncRequest(void);
+
+/**
+ * @brief Función que corrige el reloj con la respuesta del servidor
+ *
+ * Una hora válida se corrige de a poco para no saltear ni repetir alarmas, si el reloj no tiene hora se pone de golpe.
+ *
+ * @param sequence número del pedido que responde el servidor
+ * @param received hora del servidor, en milisegundos desde 1970
+ * @param hold milisegundos que tardó el servidor en responder
+ * @param sample resultado del intercambio
+ * @return int devuelve:
+ *  \li 0 si el reloj se corrige de a poco
+ *  \li 1 si se puso la hora de golpe
+ *  \li -1 si la respuesta se descartó o el desplazamiento no se puede corregir
+ */
+int AppSyncResponse(uint32_t sequence, int64_t received, uint32_t hold, time_sync_sample_t * sample);
+
+/**
+ * @brief Función que devuelve los segundos entre pedidos de la hora al servidor
+ *
+ * @return segundos entre pedidos, 0 si solo se piden con @ref AppSyncRequest()
+ */
+uint16_t AppSyncGetPeriod(void);
+
+/**
+ * @brief Función que devuelve el estado de la sincronización, con los contadores y el último intercambio aceptado
+ *
+ * @param state variable en la que se devuelve el estado
+ */
+void AppSyncGetState(time_sync_t * state);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* APP_SYNC_H_ */
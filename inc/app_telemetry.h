@@ -0,0 +1,119 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef APP_TELEMETRY_H_
+#define APP_TELEMETRY_H_
+
+/** @file app_telemetry.h
+ ** @brief Declaraciones de la telemetría de la aplicación - Electrónica 4 2025
+ **
+ ** Cuenta el uso del reloj, mide la deriva de la interrupción periódica y envía las tramas de telemetry.h por la
+ ** consola.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* === Public data type declarations =============================================================================== */
+
+/**
+ * @brief Función que devuelve los datos de la última interrupción periódica sin que cambien a la mitad
+ *
+ * @param fired valor de HalCycleCounter en el disparo de la interrupción
+ * @param milliseconds milisegundos contados por la interrupción
+ */
+typedef void (*app_telemetry_tick_p)(uint32_t * fired, uint32_t * milliseconds);
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Función que reinicia los contadores y la medición de la deriva
+ *
+ * @param tick función que devuelve los datos de la última interrupción periódica
+ * @param period segundos entre envíos de la telemetría, 0 no la envía
+ * @param period_ms milisegundos que pasan en cada interrupción periódica
+ * @param period_counts periodo de la interrupción periódica en cuentas de HalCycleCounter
+ */
+void AppTelemetryInit(app_telemetry_tick_p tick, uint16_t period, uint32_t period_ms, uint32_t period_counts);
+
+/**
+ * @brief Tarea periódica que acumula la deriva de los ticks y envía la telemetría cuando corresponde, se llama cada
+ * un segundo
+ *
+ */
+void AppTelemetryTask(void);
+
+/**
+ * @brief Función que devuelve los segundos entre envíos de la telemetría
+ *
+ * @return segundos entre envíos, 0 si no se envía
+ */
+uint16_t AppTelemetryGetPeriod(void);
+
+/**
+ * @brief Función que cambia los segundos entre envíos de la telemetría, el próximo envío se cuenta desde ahora
+ *
+ * @param period segundos entre envíos, 0 no la envía
+ */
+void AppTelemetrySetPeriod(uint16_t period);
+
+/**
+ * @brief Función que descarta la referencia de la deriva, se llama cuando se detiene la interrupción periódica
+ *
+ */
+void AppTelemetryRestartDrift(void);
+
+/**
+ * @brief Función que cuenta una vez que empezó a sonar la alarma, se puede llamar desde la interrupción periódica
+ *
+ */
+void AppTelemetryCountRing(void);
+
+/**
+ * @brief Función que cuenta las veces que se pospuso la alarma
+ *
+ * @param snoozes cantidad de veces
+ */
+void AppTelemetryCountSnoozes(uint32_t snoozes);
+
+/**
+ * @brief Función que cuenta una pulsación de un botón
+ *
+ * @param button número del botón, los que no tienen contador en la trama de estado se ignoran
+ */
+void AppTelemetryCountButton(uint8_t button);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* APP_TELEMETRY_H_ */
@@ -0,0 +1,130 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+#ifndef BENCHMARK_H_
+#define BENCHMARK_H_
+
+/** @file benchmark.h
+ ** @brief Declaraciones de las mediciones del costo de los caminos críticos del reloj - Electrónica 4 2025
+ **
+ ** Cada medición ejecuta una operación muchas veces seguidas con el contador de ciclos de la capa de abstracción del
+ ** hardware, ciclos del DWT en la placa y nanosegundos en el host. A cada muestra se le resta el costo de un lote de
+ ** operaciones vacías medido justo antes, así el resultado es el costo de la operación sin el del lazo ni el de la
+ ** llamada indirecta. Los valores se expresan en milésimas de cuenta por operación para no usar punto flotante.
+ **
+ ** El resultado de cada medición se puede escribir como una línea JSON, por ejemplo:
+ ** `{"name":"ClockNewTick","unit":"ns","frequency":1000000000,"iterations":1000,"samples":31,"min":4.210,...}`
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+#include <stddef.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#ifndef BENCHMARK_SAMPLES
+//! Cantidad de muestras de cada medición
+#define BENCHMARK_SAMPLES    31
+#endif
+
+#ifndef BENCHMARK_ITERATIONS
+//! Cantidad de operaciones de cada muestra
+#define BENCHMARK_ITERATIONS 1000
+#endif
+
+/* === Public data type declarations =============================================================================== */
+
+/**
+ * @brief Operación que se mide
+ *
+ * @param context contexto de la operación
+ */
+typedef void (*benchmark_operation_p)(void * context);
+
+//! Resultado de una medición, los tiempos en milésimas de cuenta del contador de ciclos por operación
+typedef struct benchmark_result_s {
+    const char * name;   //!< nombre de la operación
+    uint32_t frequency;  //!< cuentas por segundo del contador de ciclos
+    uint32_t iterations; //!< operaciones de cada muestra
+    uint16_t samples;    //!< cantidad de muestras
+    uint32_t min;        //!< muestra más rápida
+    uint32_t median;     //!< mediana de las muestras
+    uint32_t mean;       //!< promedio de las muestras
+    uint32_t max;        //!< muestra más lenta
+    uint32_t stddev;     //!< desviación estándar de las muestras
+} benchmark_result_t;
+
+/**
+ * @brief Función que recibe el resultado de cada medición de @ref BenchmarkSuiteRun()
+ *
+ * @param result resultado de la medición
+ */
+typedef void (*benchmark_report_p)(const benchmark_result_t * result);
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Función que mide el costo de una operación
+ *
+ * @param name nombre de la operación
+ * @param operation operación a medir
+ * @param context contexto de la operación
+ * @param result resultado de la medición
+ */
+void BenchmarkRun(const char * name, benchmark_operation_p operation, void * context, benchmark_result_t * result);
+
+/**
+ * @brief Función que escribe un resultado como una línea JSON terminada en salto de línea
+ *
+ * @param result resultado de la medición
+ * @param unit unidad del contador de ciclos, por ejemplo "cycles" o "ns"
+ * @param buffer texto resultante
+ * @param size tamaño del buffer
+ * @return largo del texto, si es mayor o igual a @p size el texto se recortó
+ */
+int BenchmarkFormat(const benchmark_result_t * result, const char * unit, char * buffer, size_t size);
+
+/**
+ * @brief Función que mide ClockNewTick, ClockGetTime, ClockSetTime, DisplayWriteBCD, DisplayRefresh,
+ * DigitalInputWasChanged, CalendarCivilFromDays y CalendarDaysFromCivil sobre el poncho real
+ *
+ * Crea su propio reloj y su propio poncho, por lo que no se puede ejecutar junto con la aplicación.
+ *
+ * @param report función que recibe cada resultado
+ * @return 0 si se pudieron crear los objetos, -1 en caso contrario
+ */
+int BenchmarkSuiteRun(benchmark_report_p report);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BENCHMARK_H_ */
@@ -0,0 +1,124 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+#ifndef CALENDAR_H_
+#define CALENDAR_H_
+
+/** @file calendar.h
+ ** @brief Declaraciones de la conversión entre días y fechas del calendario gregoriano - Electrónica 4 2025
+ **
+ ** Los días se cuentan desde el 1 de enero de 1970, como en el tiempo de Unix, y pueden ser negativos. El calendario
+ ** es el gregoriano proléptico, es decir que se aplica también a las fechas anteriores a su adopción. Las conversiones
+ ** usan los algoritmos de Howard Hinnant: cuentan los años desde el 1 de marzo, así el día bisiesto queda al final del
+ ** año, y agrupan los años en eras de 400 años que tienen siempre 146097 días. Solo usan sumas, productos y divisiones
+ ** por constantes, sin lazos ni tablas.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+//! Segundos de un día
+#define CALENDAR_SECONDS_PER_DAY 86400UL
+
+/* === Public data type declarations =============================================================================== */
+
+//! Días de la semana
+typedef enum calendar_weekday_e {
+    CALENDAR_SUNDAY,
+    CALENDAR_MONDAY,
+    CALENDAR_TUESDAY,
+    CALENDAR_WEDNESDAY,
+    CALENDAR_THURSDAY,
+    CALENDAR_FRIDAY,
+    CALENDAR_SATURDAY,
+} calendar_weekday_e;
+
+//! Fecha del calendario gregoriano
+typedef struct calendar_date_s {
+    int16_t year;    //!< año
+    uint8_t month;   //!< mes, de 1 a 12
+    uint8_t day;     //!< día del mes, desde 1
+    uint8_t weekday; //!< día de la semana, uno de calendar_weekday_e
+} calendar_date_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Función que convierte una fecha en días desde el 1 de enero de 1970
+ *
+ * No verifica la fecha y no usa el día de la semana.
+ *
+ * @param date fecha
+ * @return días desde el 1 de enero de 1970, negativo para las fechas anteriores
+ */
+int32_t CalendarDaysFromCivil(const calendar_date_t * date);
+
+/**
+ * @brief Función que convierte días desde el 1 de enero de 1970 en una fecha
+ *
+ * @param days días desde el 1 de enero de 1970
+ * @param date variable en la que se devuelve la fecha, con el día de la semana
+ */
+void CalendarCivilFromDays(int32_t days, calendar_date_t * date);
+
+/**
+ * @brief Función que devuelve el día de la semana
+ *
+ * @param days días desde el 1 de enero de 1970, que fue jueves
+ * @return día de la semana, uno de calendar_weekday_e
+ */
+uint8_t CalendarWeekday(int32_t days);
+
+/**
+ * @brief Función que devuelve la cantidad de días de un mes
+ *
+ * @param year año
+ * @param month mes, de 1 a 12
+ * @return cantidad de días
+ */
+uint8_t CalendarDaysInMonth(int16_t year, uint8_t month);
+
+/**
+ * @brief Función que verifica si el mes y el día de una fecha existen
+ *
+ * @param date fecha, no se usa el día de la semana
+ * @return true si la fecha es válida
+ */
+bool CalendarValidDate(const calendar_date_t * date);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CALENDAR_H_ */
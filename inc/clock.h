@@ -22,10 +22,28 @@ SPDX-License-Identifier: MIT
 
 /** @file clock.h
  ** @brief Declaraciones del modulo de reloj - Electrónica 4 2025
+ **
+ ** Además de la hora del día el reloj cuenta los segundos desde el 1 de enero de 1970 a las 00:00:00 y guarda la fecha,
+ ** que solo se vuelve a calcular al pasar la medianoche. Al crearlo la fecha es el 1 de enero de 1970.
+ **
+ ** Con una zona horaria los segundos desde 1970 son UTC y la hora, la fecha y la alarma son locales. El reloj guarda el
+ ** instante del próximo cambio de la zona y solo la consulta al alcanzarlo. Al adelantar la hora las alarmas de la
+ ** hora que se saltea no suenan y al atrasarla las de la hora que se repite suenan dos veces.
+ **
+ ** Para corregir una hora válida sin saltos se usa @ref ClockAdjustTime(), que reparte la corrección agregando o
+ ** salteando un tick cada @ref CLOCK_SLEW_INTERVAL. Los segundos siguen avanzando de a uno, así ninguna alarma ni
+ ** función programada se saltea ni se repite.
+ **
+ ** Con un RTC indicado con @ref ClockSetRtc() la hora se guarda en el RTC cada vez que se ajusta y al crear el reloj se
+ ** recupera, si el RTC la conservó. Mientras el reloj cuenta los ticks el RTC solo mide el tiempo: el reloj puede
+ ** suspenderse con @ref ClockSuspend(), para detener la interrupción periódica, y al reanudarlo con @ref ClockResume()
+ ** suma de una vez los segundos que contó el RTC. La próxima alarma se programa en el RTC para despertar a tiempo.
  **/
 
 /* === Headers files inclusions ==================================================================================== */
 
+#include "calendar.h"
+#include "timezone.h"
 #include <stdint.h>
 #include <stdbool.h>
 
@@ -37,6 +55,42 @@ extern "C" {
 
 /* === Public macros definitions =================================================================================== */
 
+//! Bit de un día de la semana en los días de la alarma, el día es un @ref calendar_weekday_e
+#define CLOCK_ALARM_DAY(weekday) ((uint8_t)(1U << (weekday)))
+
+//! Días de la alarma para que suene todos los días
+#define CLOCK_ALARM_EVERY_DAY    0x7FU
+
+//! Días de la alarma para que suene de lunes a viernes
+#define CLOCK_ALARM_WEEKDAYS     0x3EU
+
+//! Días de la alarma para que suene los sábados y domingos
+#define CLOCK_ALARM_WEEKEND      0x41U
+
+//! Instante de la alarma cuando no hay una próxima alarma
+#define CLOCK_ALARM_NEVER        INT64_MAX
+
+//! Instante de la alarma del RTC cuando no hay que despertar al reloj
+#define CLOCK_RTC_NO_ALARM       UINT32_MAX
+
+//! Día que no corresponde a ninguna fecha
+#define CLOCK_NO_DAY             INT32_MIN
+
+#ifndef CLOCK_HOOKS
+//! Cantidad máxima de funciones programadas en cada reloj
+#define CLOCK_HOOKS 8
+#endif
+
+#ifndef CLOCK_SLEW_INTERVAL
+//! Ticks entre cada tick que se agrega o se saltea al corregir la hora, 100 corrige un segundo en 100 segundos
+#define CLOCK_SLEW_INTERVAL 100
+#endif
+
+#ifndef CLOCK_ADJUST_LIMIT
+//! Corrección máxima en milisegundos que acepta @ref ClockAdjustTime()
+#define CLOCK_ADJUST_LIMIT 600000
+#endif
+
 /* === Public data type declarations =============================================================================== */
 
 //! Tipo de dato con la referencia a un reloj
@@ -65,11 +119,65 @@ typedef void (*turn_on_alarm_p)(void);
  */
 typedef void (*turn_off_alarm_p)(void);
 
+//! Momentos en los que se puede llamar a una función programada
+typedef enum clock_hook_e {
+    CLOCK_HOOK_SECOND, //!< al empezar cada segundo
+    CLOCK_HOOK_MINUTE, //!< al empezar cada minuto
+    CLOCK_HOOK_HOUR,   //!< al empezar cada hora
+    CLOCK_HOOK_TIME,   //!< todos los días a una hora indicada
+} clock_hook_e;
+
+/**
+ * @brief Puntero a una función programada en el reloj
+ *
+ * Se llama desde @ref ClockNewTick(), por lo que se ejecuta en la interrupción periódica y debe ser breve.
+ *
+ * @param clock reloj que llama a la función
+ * @param context dato indicado al programar la función
+ */
+typedef void (*clock_hook_p)(clock_p clock, void * context);
+
+//! Límites de la alarma que suena y de sus posposiciones, todos en cero no limitan la alarma
+typedef struct clock_alarm_policy_s {
+    uint32_t ring_timeout; //!< segundos que suena la alarma antes de apagarse sola, 0 para que suene hasta apagarla
+    uint8_t max_snoozes;   //!< veces que se puede posponer la alarma desde que empezó a sonar, 0 para no limitarlas
+    int32_t snooze_step;   //!< segundos que se suman a cada posposición después de la primera, pueden ser negativos
+} clock_alarm_policy_t;
+
 typedef struct clock_alarm_driver_s {
     turn_off_alarm_p TurnOffAlarm;
     turn_on_alarm_p TurnOnAlarm;
 } const * clock_alarm_driver_p;
 
+/**
+ * @brief Puntero a una función que lee los segundos del RTC
+ *
+ * @param seconds segundos UTC desde 1970
+ * @return true si el RTC conserva la hora que se le escribió
+ */
+typedef bool (*clock_rtc_read_p)(uint32_t * seconds);
+
+/**
+ * @brief Puntero a una función que pone en hora el RTC, que empieza a contar un segundo nuevo
+ *
+ * @param seconds segundos UTC desde 1970
+ */
+typedef void (*clock_rtc_write_p)(uint32_t seconds);
+
+/**
+ * @brief Puntero a una función que programa la alarma del RTC
+ *
+ * @param seconds segundos del RTC en los que se despierta al reloj, @ref CLOCK_RTC_NO_ALARM para no despertarlo
+ */
+typedef void (*clock_rtc_alarm_p)(uint32_t seconds);
+
+//! Funciones del RTC que mantiene la hora con el reloj suspendido
+typedef struct clock_rtc_driver_s {
+    clock_rtc_read_p Read;      //!< lee los segundos
+    clock_rtc_write_p Write;    //!< pone en hora el RTC
+    clock_rtc_alarm_p SetAlarm; //!< programa la alarma
+} const * clock_rtc_driver_p;
+
 /* === Public variable declarations ================================================================================ */
 
 /* === Public function declarations ================================================================================ */
@@ -111,6 +219,107 @@ int ClockSetTime(clock_p clock, const clock_time_u * new_time);
 
 void ClockNewTick(clock_p clock);
 
+/**
+ * @brief Función para cambiar la fecha del reloj sin cambiar la hora
+ *
+ * @param clock referencia al reloj
+ * @param new_date fecha, no se usa el día de la semana
+ * @return devuelve 1 si ajustó la fecha, 0 si la fecha no existe o es anterior a 1970
+ */
+int ClockSetDate(clock_p clock, const calendar_date_t * new_date);
+
+/**
+ * @brief Función para obtener la fecha actual
+ *
+ * @param clock referencia al reloj
+ * @param current_date variable en la que devuelve la fecha actual con el día de la semana
+ * @return devuelve 1 si la hora del reloj es válida, 0 si hay que poner en hora el reloj
+ */
+int ClockGetDate(clock_p clock, calendar_date_t * current_date);
+
+/**
+ * @brief Función que devuelve los milisegundos UTC desde el 1 de enero de 1970, con la resolución de un tick
+ *
+ * Igual que @ref ClockGetEpochSeconds(), fuera de la interrupción periódica se debe leer con las interrupciones
+ * deshabilitadas.
+ *
+ * @param clock referencia al reloj
+ * @return milisegundos desde 1970
+ */
+int64_t ClockGetEpochMilliseconds(clock_p clock);
+
+/**
+ * @brief Función que pone el reloj en hora a partir de los milisegundos UTC desde 1970
+ *
+ * Cambia la hora de golpe igual que @ref ClockSetTime(), por lo que solo conviene usarla cuando la hora no es válida.
+ *
+ * @param clock referencia al reloj
+ * @param milliseconds milisegundos desde 1970
+ * @return devuelve 1 si ajustó la hora, 0 si el instante es anterior a 1970
+ */
+int ClockSetEpochMilliseconds(clock_p clock, int64_t milliseconds);
+
+/**
+ * @brief Función que corrige una hora válida de a poco, sin saltos
+ *
+ * Cada @ref CLOCK_SLEW_INTERVAL ticks el reloj avanza dos ticks para adelantar la hora o ninguno para atrasarla, hasta
+ * completar la corrección. Reemplaza la corrección pendiente, porque la medición nueva ya incluye la parte aplicada.
+ * Ajustar la hora o la fecha descarta la corrección pendiente.
+ *
+ * @param clock referencia al reloj
+ * @param milliseconds milisegundos a sumar a la hora, como máximo @ref CLOCK_ADJUST_LIMIT en valor absoluto
+ * @return devuelve 1 si se aceptó la corrección, 0 si la hora no es válida o la corrección es demasiado grande
+ */
+int ClockAdjustTime(clock_p clock, int32_t milliseconds);
+
+/**
+ * @brief Función que devuelve la corrección que falta aplicar
+ *
+ * @param clock referencia al reloj
+ * @return milisegundos que faltan sumar a la hora
+ */
+int32_t ClockGetAdjustment(clock_p clock);
+
+/**
+ * @brief Función que devuelve los segundos UTC desde el 1 de enero de 1970 a las 00:00:00
+ *
+ * El valor es de 64 bits, fuera de la interrupción periódica se debe leer con las interrupciones deshabilitadas.
+ *
+ * @param clock referencia al reloj
+ * @return segundos desde 1970
+ */
+int64_t ClockGetEpochSeconds(clock_p clock);
+
+/**
+ * @brief Función para saber si el reloj se puso en hora
+ *
+ * @param clock referencia al reloj
+ * @return devuelve:
+ *  \li 1 si el reloj se puso en hora valida
+ *  \li 0 si hay que poner en hora el reloj
+ */
+int ClockIsTimeValid(clock_p clock);
+
+/**
+ * @brief Función para indicar la zona horaria de la hora local
+ *
+ * Conserva los segundos UTC y vuelve a calcular la hora y la fecha local, si la hora no es válida conserva la hora
+ * local. Se debe volver a llamar cada vez que se compila de nuevo la tabla de la zona, con la interrupción periódica
+ * deshabilitada.
+ *
+ * @param clock referencia al reloj
+ * @param zone zona compilada, NULL para que la hora local sea la hora UTC
+ */
+void ClockSetTimezone(clock_p clock, const timezone_t * zone);
+
+/**
+ * @brief Función que devuelve el desplazamiento actual de la hora local
+ *
+ * @param clock referencia al reloj
+ * @return segundos que se suman a la hora UTC para obtener la hora local
+ */
+int32_t ClockGetUtcOffset(clock_p clock);
+
 /**
  * @brief Función para poner la alarma
  *
@@ -156,6 +365,56 @@ int ClockIsAlarmRinging(clock_p clock);
  */
 void ClockSetAlarmState(clock_p clock, bool state);
 
+/**
+ * @brief Función para indicar los días de la semana en los que suena la alarma
+ *
+ * Al crear el reloj la alarma suena todos los días. Sin ningún día la alarma no suena aunque esté activada.
+ *
+ * @param clock referencia al reloj
+ * @param weekdays un bit @ref CLOCK_ALARM_DAY por cada día, por ejemplo @ref CLOCK_ALARM_WEEKDAYS
+ */
+void ClockSetAlarmDays(clock_p clock, uint8_t weekdays);
+
+/**
+ * @brief Función para obtener los días de la semana en los que suena la alarma
+ *
+ * @param clock referencia al reloj
+ * @return un bit @ref CLOCK_ALARM_DAY por cada día
+ */
+uint8_t ClockGetAlarmDays(clock_p clock);
+
+/**
+ * @brief Función para indicar si la alarma suena una sola vez
+ *
+ * Una alarma que suena una sola vez se desactiva al empezar a sonar, se puede posponer igual que las demás.
+ *
+ * @param clock referencia al reloj
+ * @param one_shot true para que la alarma se desactive después de sonar
+ */
+void ClockSetAlarmOneShot(clock_p clock, bool one_shot);
+
+/**
+ * @brief Función para saltear la próxima alarma sin desactivarla
+ *
+ * Después del día salteado la alarma vuelve a sonar en sus días. Cambiar la hora o la fecha no cambia el día
+ * salteado.
+ *
+ * @param clock referencia al reloj
+ * @param skip true para saltear la próxima alarma, false para que vuelva a sonar
+ */
+void ClockSkipNextAlarm(clock_p clock, bool skip);
+
+/**
+ * @brief Función para obtener la fecha local en la que suena la próxima alarma
+ *
+ * @param clock referencia al reloj
+ * @param date fecha de la próxima alarma
+ * @return int devuelve:
+ *  \li 1 si hay una próxima alarma
+ *  \li 0 si la alarma no está activada o no tiene días
+ */
+int ClockGetNextAlarm(clock_p clock, calendar_date_t * date);
+
 /**
  * @brief Función para saber si la alarma esta activa
  *
@@ -167,12 +426,32 @@ int ClockIsAlarmActivated(clock_p clock);
 /**
  * @brief Función para posponer la alarma
  *
+ * La primera posposición dura los segundos indicados al crear el reloj y cada una de las siguientes dura
+ * clock_alarm_policy_t::snooze_step segundos más, como mínimo un segundo.
+ *
  * @param clock referencia del reloj
+ * @return int devuelve:
+ *  \li 1 si se pospuso la alarma
+ *  \li 0 si ya se pospuso el máximo de veces, la alarma sigue sonando
+ */
+int ClockSnoozeAlarm(clock_p clock);
+
+/**
+ * @brief Función para indicar los límites de la alarma que suena y de sus posposiciones
+ *
+ * La alarma que suena más de clock_alarm_policy_t::ring_timeout segundos se apaga sola hasta la próxima, igual que con
+ * @ref ClockTurnOffAlarm(). Al crear el reloj la alarma no tiene límites.
+ *
+ * @param clock referencia al reloj
+ * @param policy límites de la alarma
+ * @return int devuelve:
+ *  \li 1 si se cambiaron los límites
+ *  \li 0 si algún tiempo supera las 24 horas, se dejan los límites anteriores
  */
-void ClockSnoozeAlarm(clock_p clock);
+int ClockSetAlarmPolicy(clock_p clock, const clock_alarm_policy_t * policy);
 
 /**
- * @brief Función para apagar la alarma, esta sonorá al dia siguiente
+ * @brief Función para apagar la alarma, esta sonará en el próximo día de la alarma
  *
  * @param clock referencia al reloj
  */
@@ -196,6 +475,66 @@ uint32_t ClockGetTimeInSeconds(clock_p clock);
  */
 int ClockIsAlarmSnoozed(clock_p clock);
 
+/**
+ * @brief Función para programar una función que se llama al empezar un segundo, un minuto, una hora o a una hora
+ *
+ * Las funciones se guardan en casilleros según el próximo segundo en el que se llaman, con casilleros para los
+ * segundos del minuto actual, los minutos de la hora actual y las horas del día, que se reparten al empezar cada
+ * minuto y cada hora. Así cada segundo solo se revisa un casillero, sin importar cuantas funciones haya programadas.
+ * Al cambiar la hora, la fecha o la zona las funciones se vuelven a repartir según la nueva hora local.
+ *
+ * @param clock referencia al reloj
+ * @param kind momento en el que se llama a la función
+ * @param time hora para @ref CLOCK_HOOK_TIME, se ignora en los demás casos
+ * @param callback función que se llama
+ * @param context dato que recibe la función
+ * @return número de la función programada, -1 si no hay lugar o los argumentos no son válidos
+ */
+int ClockAddHook(clock_p clock, clock_hook_e kind, const clock_time_u * time, clock_hook_p callback, void * context);
+
+/**
+ * @brief Función para dejar de llamar a una función programada
+ *
+ * Se puede llamar desde la misma función programada.
+ *
+ * @param clock referencia al reloj
+ * @param hook número devuelto por @ref ClockAddHook()
+ */
+void ClockRemoveHook(clock_p clock, int hook);
+
+/**
+ * @brief Función para indicar el RTC que mantiene la hora con el reloj suspendido y recuperar la hora que conservó
+ *
+ * Si el RTC conserva la hora el reloj la toma, como con @ref ClockSetEpochMilliseconds(), y el segundo siguiente
+ * empieza cuando cambia el segundo del RTC. Si no, el RTC se pone en hora al empezar el próximo segundo válido.
+ *
+ * @param clock referencia al reloj
+ * @param rtc funciones del RTC, NULL para no usar ninguno
+ * @return devuelve 1 si el reloj tomó la hora del RTC, 0 si el RTC no la conserva
+ */
+int ClockSetRtc(clock_p clock, clock_rtc_driver_p rtc);
+
+/**
+ * @brief Función para dejar de contar los ticks mientras el RTC mantiene la hora
+ *
+ * Programa la alarma del RTC en el instante de la próxima alarma, de la posposición o del apagado automático. Mientras
+ * está suspendido @ref ClockNewTick() no hace nada y las consultas devuelven la hora de la suspensión.
+ *
+ * @param clock referencia al reloj
+ * @return devuelve 1 si se suspendió, 0 si no hay un RTC o la hora no es válida
+ */
+int ClockSuspend(clock_p clock);
+
+/**
+ * @brief Función para volver a contar los ticks, sumando los segundos que contó el RTC
+ *
+ * La alarma que correspondía mientras estaba suspendido suena una vez. Las funciones programadas de los segundos que
+ * se saltean no se llaman. No hace nada si el reloj no está suspendido.
+ *
+ * @param clock referencia al reloj
+ */
+void ClockResume(clock_p clock);
+
 /* === End of conditional blocks =================================================================================== */
 
 #ifdef __cplusplus
@@ -1,10 +1,26 @@
 // #define USE_DYNAMIC_MEMORY
 
 #define DIGITAL_OUTPUT_MAX_INSTANCE     8
-#define DIGITAL_INPUT_MAX_INSTANCE      4
+#define DIGITAL_INPUT_MAX_INSTANCE      6
+#define DIGITAL_OUTPUT_USE_SHADOW
+#define OUTPUT_PATTERN_MAX_INSTANCE     1
 
 #define DISPLAY_MAX_INSTANCE            1
 #define DISPLAY_MAX_DIGITS              4
 
 #define SHIELD_MAX_INSTANCE             1
+
+#define SCHEDULER_MAX_INSTANCE          1
+#define SCHEDULER_MAX_TASKS             6
+
+#define USE_DEFERRED_DISPLAY_UPDATE
 #define TIME_TO_HOLD_TO_CHANGE_STATE_MS 300
+
+// Las mediciones de las rutinas de interrupción no se compilan en las versiones de producción
+#ifndef NDEBUG
+#define USE_PROFILER
+#endif
+
+// El registro de eventos sirve para investigar fallas en el uso real, se incluye también en producción
+#define USE_EVENT_TRACE
+#define EVENT_TRACE_SIZE                64
@@ -0,0 +1,178 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+#ifndef CONSOLE_H_
+#define CONSOLE_H_
+
+/** @file console.h
+ ** @brief Declaraciones de la consola de órdenes por el puerto serie - Electrónica 4 2025
+ **
+ ** El DMA escribe los bytes recibidos en un buffer circular y la consola los interpreta directamente ahí, byte por
+ ** byte, sin copiar las líneas: el nombre de la orden y las palabras se reducen a un hash mientras llegan y los números
+ ** se convierten a medida que se leen sus dígitos. Una línea tiene un nombre de orden y hasta @ref CONSOLE_ARGS
+ ** argumentos separados por espacios, `:`, `-`, `/` o `,`, así `time 12:30:00` y `date 2025-03-10` tienen tres números.
+ **
+ ** Las respuestas se escriben en otro buffer circular que se envía por DMA desde su misma posición. Todo el trabajo se
+ ** hace en @ref ConsolePoll(), que se llama desde el lazo principal, de modo que la consola no agrega trabajo a la
+ ** interrupción periódica. El buffer de recepción debe alcanzar para los bytes que llegan entre dos llamadas, a
+ ** 115200 bps son unos 12 bytes por milisegundo.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#ifndef CONSOLE_RX_SIZE
+//! Tamaño del buffer circular de recepción
+#define CONSOLE_RX_SIZE   256
+#endif
+
+#ifndef CONSOLE_TX_SIZE
+//! Tamaño del buffer circular de envío, potencia de 2
+#define CONSOLE_TX_SIZE   1024
+#endif
+
+#ifndef CONSOLE_ARGS
+//! Cantidad máxima de argumentos de una orden
+#define CONSOLE_ARGS      4
+#endif
+
+//! Largo máximo de una línea escrita con @ref ConsolePrint()
+#define CONSOLE_LINE_SIZE 96
+
+/* === Public data type declarations =============================================================================== */
+
+//! Argumento de una orden
+typedef struct console_arg_s {
+    uint32_t number; //!< valor si el argumento es un número
+    uint32_t hash;   //!< hash del texto del argumento, para compararlo con @ref ConsoleArgIs()
+    uint8_t length;  //!< largo del texto del argumento
+    bool numeric;    //!< indica si el argumento es un número decimal sin signo
+} console_arg_t;
+
+//! Argumentos de una orden
+typedef struct console_args_s {
+    uint8_t count;                      //!< cantidad de argumentos
+    console_arg_t values[CONSOLE_ARGS]; //!< argumentos en el orden en que se escribieron
+} console_args_t;
+
+/**
+ * @brief Función que atiende una orden, escribe la respuesta con @ref ConsolePrint() o @ref ConsoleWrite()
+ *
+ * @param args argumentos de la orden
+ */
+typedef void (*console_handler_p)(const console_args_t * args);
+
+//! Orden que atiende la consola
+typedef struct console_command_s {
+    const char * name;         //!< nombre de la orden
+    console_handler_p handler; //!< función que la atiende
+} console_command_t;
+
+//! Funciones del puerto serie que usa la consola, con la misma forma que las de hal.h
+typedef struct console_driver_s {
+    void (*Start)(uint8_t * buffer, size_t size); //!< inicia la recepción circular en el buffer
+    size_t (*Received)(void);                     //!< posición en la que se escribe el próximo byte recibido
+    bool (*Send)(const void * data, size_t size); //!< empieza a enviar bytes, false si está ocupado
+    bool (*Busy)(void);                           //!< indica si el envío anterior no terminó
+} const * console_driver_p;
+
+//! Contadores de la consola
+typedef struct console_stats_s {
+    uint32_t lines;   //!< órdenes recibidas
+    uint32_t errors;  //!< órdenes desconocidas o con argumentos inválidos
+    uint32_t dropped; //!< bytes de respuesta descartados porque el buffer de envío estaba lleno
+} console_stats_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Función que vacía los buffers e inicia la recepción
+ *
+ * @param driver funciones del puerto serie
+ * @param commands órdenes que atiende la consola, deben existir mientras se use
+ * @param count cantidad de órdenes
+ */
+void ConsoleInit(console_driver_p driver, const console_command_t * commands, uint8_t count);
+
+/**
+ * @brief Función que interpreta los bytes recibidos, atiende las órdenes completas y envía las respuestas pendientes
+ *
+ */
+void ConsolePoll(void);
+
+/**
+ * @brief Función que agrega texto a la respuesta, lo que no entra en el buffer de envío se descarta
+ *
+ * @param text texto a enviar
+ * @param size cantidad de bytes
+ */
+void ConsoleWrite(const char * text, size_t size);
+
+/**
+ * @brief Función que agrega a la respuesta un texto con formato, de hasta @ref CONSOLE_LINE_SIZE bytes
+ *
+ * @param format formato de printf
+ */
+void ConsolePrint(const char * format, ...);
+
+/**
+ * @brief Función que devuelve el espacio libre del buffer de envío
+ *
+ * @return cantidad de bytes que se pueden escribir sin descartar
+ */
+size_t ConsoleFree(void);
+
+/**
+ * @brief Función para saber si un argumento es una palabra
+ *
+ * @param args argumentos de la orden
+ * @param index número de argumento
+ * @param word palabra a comparar
+ * @return true si el argumento existe y es la palabra
+ */
+bool ConsoleArgIs(const console_args_t * args, uint8_t index, const char * word);
+
+/**
+ * @brief Función que devuelve los contadores de la consola
+ *
+ * @param stats variable en la que se devuelven los contadores
+ */
+void ConsoleGetStats(console_stats_t * stats);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CONSOLE_H_ */
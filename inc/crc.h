@@ -0,0 +1,70 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+#ifndef CRC_H_
+#define CRC_H_
+
+/** @file crc.h
+ ** @brief Declaraciones del cálculo del CRC de 16 bits para datos guardados y transmitidos - Electrónica 4 2025
+ **
+ ** Usa el CRC-16/CCITT-FALSE: polinomio 0x1021, valor inicial 0xFFFF, sin reflejar y sin XOR final. El CRC de los
+ ** bytes "123456789" es 0x29B1. Los datos se pueden procesar en partes pasando el resultado de una llamada como valor
+ ** inicial de la siguiente.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+#include <stddef.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+//! Valor inicial del CRC
+#define CRC16_INITIAL 0xFFFF
+
+/* === Public data type declarations =============================================================================== */
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Función que agrega bytes al cálculo de un CRC
+ *
+ * @param crc valor inicial, @ref CRC16_INITIAL o el resultado de la parte anterior
+ * @param data bytes a agregar
+ * @param size cantidad de bytes
+ * @return CRC de los bytes procesados hasta ahora
+ */
+uint16_t Crc16(uint16_t crc, const void * data, size_t size);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CRC_H_ */
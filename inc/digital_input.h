@@ -49,6 +49,15 @@ typedef enum digital_input_changes_e {
     DIGITAL_INPUT_WAS_DEACTIVATED = -1,
 } digital_input_changes_t;
 
+/**
+ * @brief Función que recibe cada cambio de nivel que el firmware lee en una entrada digital
+ *
+ * @param port Puerto de la entrada digital
+ * @param pin Pin de la entrada digital
+ * @param level Nivel eléctrico leído, sin tener en cuenta la lógica invertida
+ */
+typedef void (*digital_input_observer_p)(uint8_t port, uint32_t pin, bool level);
+
 /* === Public variable declarations ================================================================================ */
 
 /* === Public function declarations ================================================================================ */
@@ -103,6 +112,16 @@ bool DigitalInputWasDeactivated(digital_input_p input);
  */
 digital_input_changes_t DigitalInputWasChanged(digital_input_p input);
 
+/**
+ * @brief Funcion para observar los niveles que leen todas las entradas digitales, por ejemplo para grabarlos
+ *
+ * El observador se llama al crear cada entrada con su nivel inicial y después cada vez que una lectura encuentra un
+ * nivel distinto al de la lectura anterior.
+ *
+ * @param observer Función que recibe los cambios, NULL para dejar de observar
+ */
+void DigitalInputSetObserver(digital_input_observer_p observer);
+
 /* === End of conditional blocks =================================================================================== */
 
 #ifdef __cplusplus
@@ -27,6 +27,7 @@ SPDX-License-Identifier: MIT
 /* === Headers files inclusions ==================================================================================== */
 
 #include <stdint.h>
+#include <stdbool.h>
 
 /* === Header for C++ compatibility ================================================================================ */
 
@@ -41,6 +42,13 @@ extern "C" {
 //! Refencia al objeto salida digital
 typedef struct digital_output_s * digital_output_p;
 
+//! Lote de cambios sobre salidas digitales de un mismo puerto que se escriben juntos
+typedef struct digital_output_batch_s {
+    uint8_t port;   //!< puerto al que pertenecen todas las salidas del lote
+    uint32_t mask;  //!< bits del puerto que se modifican al escribir el lote
+    uint32_t value; //!< valor que toman los bits indicados en @ref mask
+} digital_output_batch_t;
+
 /* === Public variable declarations ================================================================================ */
 
 /* === Public function declarations ================================================================================ */
@@ -49,7 +57,7 @@ typedef struct digital_output_s * digital_output_p;
  * @brief Funcion para crear una Salida Digital
  *
  * Si pudo asignar un espacio de memoria devuelve una referencia a la salida digital creada ademas desactiva esta salida
- * digital, en caso contrario devuelve NULL.
+ * digital, en caso contrario devuelve NULL. También devuelve NULL si el puerto o el pin están fuera de rango.
  *
  * @param port Puerto de la salida digital creada
  * @param pin Pin de la salida digital creada
@@ -78,6 +86,50 @@ void DigitalOutputDeactivate(digital_output_p self);
  */
 void DigitalOutputToggle(digital_output_p self);
 
+/**
+ * @brief Funcion para preguntarle a una salida digital si está activa
+ *
+ * Si se define DIGITAL_OUTPUT_USE_SHADOW el estado se obtiene de la copia en memoria del puerto, sin acceder al
+ * periférico. En caso contrario se lee el pin.
+ *
+ * @param self Referencia de la salida digital
+ * @return true Si la salida esta activa
+ * @return false Si la salida esta inactiva
+ */
+bool DigitalOutputGetIsActive(digital_output_p self);
+
+/**
+ * @brief Funcion para iniciar un lote de cambios vacío
+ *
+ * El puerto del lote queda definido por la primera salida que se agrega con @ref DigitalOutputBatchSet().
+ *
+ * @param batch Lote a iniciar
+ */
+void DigitalOutputBatchBegin(digital_output_batch_t * batch);
+
+/**
+ * @brief Funcion para agregar el nuevo estado de una salida digital a un lote
+ *
+ * No escribe en el puerto, solo memoriza el cambio hasta llamar a @ref DigitalOutputBatchCommit().
+ *
+ * @param batch Lote al que se agrega el cambio
+ * @param output Referencia de la salida digital
+ * @param active Estado que debe tomar la salida
+ * @return devuelve -1 si la salida pertenece a un puerto distinto al del lote, 0 en caso contrario
+ */
+int DigitalOutputBatchSet(digital_output_batch_t * batch, digital_output_p output, bool active);
+
+/**
+ * @brief Funcion para escribir todos los cambios de un lote con una única escritura enmascarada del puerto
+ *
+ * Utiliza el registro de máscara del puerto, por lo que no se debe llamar desde contextos que puedan interrumpirse
+ * entre sí sobre un mismo puerto. Los pines que no pertenecen al lote no se modifican.
+ *
+ * @param batch Lote a escribir
+ * @return devuelve -1 si el lote está vacío, 0 en caso contrario
+ */
+int DigitalOutputBatchCommit(digital_output_batch_t * batch);
+
 /* === End of conditional blocks =================================================================================== */
 
 #ifdef __cplusplus
@@ -126,6 +126,15 @@ void DisplayWriteBCD(display_p display, uint8_t * bcd_to_show, uint8_t size);
  */
 void DisplayRefresh(display_p display);
 
+/**
+ * @brief Función que apaga todos los dígitos hasta la próxima llamada a @ref DisplayRefresh()
+ *
+ * Permite dejar la pantalla apagada sin borrar la memoria de video.
+ *
+ * @param display referencia a la pantalla
+ */
+void DisplayTurnOff(display_p display);
+
 /**
  * @brief Función para configurar un parpadero en los dígitos desde @p from hasta @p to.
  *
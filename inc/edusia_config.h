@@ -1,59 +1,59 @@
 #define LED_R_PORT 2
 #define LED_R_PIN  0
-#define LED_R_FUNC SCU_MODE_FUNC4
+#define LED_R_FUNC HAL_PIN_FUNC4
 #define LED_R_GPIO 5
 #define LED_R_BIT  0
 
 #define LED_G_PORT 2
 #define LED_G_PIN  1
-#define LED_G_FUNC SCU_MODE_FUNC4
+#define LED_G_FUNC HAL_PIN_FUNC4
 #define LED_G_GPIO 5
 #define LED_G_BIT  1
 
 #define LED_B_PORT 2
 #define LED_B_PIN  2
-#define LED_B_FUNC SCU_MODE_FUNC4
+#define LED_B_FUNC HAL_PIN_FUNC4
 #define LED_B_GPIO 5
 #define LED_B_BIT  2
 
 #define LED_1_PORT 2
 #define LED_1_PIN  10
-#define LED_1_FUNC SCU_MODE_FUNC0
+#define LED_1_FUNC HAL_PIN_FUNC0
 #define LED_1_GPIO 0
 #define LED_1_BIT  14
 
 #define LED_2_PORT 2
 #define LED_2_PIN  11
-#define LED_2_FUNC SCU_MODE_FUNC0
+#define LED_2_FUNC HAL_PIN_FUNC0
 #define LED_2_GPIO 1
 #define LED_2_BIT  11
 
 #define LED_3_PORT 2
 #define LED_3_PIN  12
-#define LED_3_FUNC SCU_MODE_FUNC0
+#define LED_3_FUNC HAL_PIN_FUNC0
 #define LED_3_GPIO 1
 #define LED_3_BIT  12
 
 #define TEC_1_PORT 1
 #define TEC_1_PIN  0
-#define TEC_1_FUNC SCU_MODE_FUNC0
+#define TEC_1_FUNC HAL_PIN_FUNC0
 #define TEC_1_GPIO 0
 #define TEC_1_BIT  4
 
 #define TEC_2_PORT 1
 #define TEC_2_PIN  1
-#define TEC_2_FUNC SCU_MODE_FUNC0
+#define TEC_2_FUNC HAL_PIN_FUNC0
 #define TEC_2_GPIO 0
 #define TEC_2_BIT  8
 
 #define TEC_3_PORT 1
 #define TEC_3_PIN  2
-#define TEC_3_FUNC SCU_MODE_FUNC0
+#define TEC_3_FUNC HAL_PIN_FUNC0
 #define TEC_3_GPIO 0
 #define TEC_3_BIT  9
 
 #define TEC_4_PORT 1
 #define TEC_4_PIN  6
-#define TEC_4_FUNC SCU_MODE_FUNC0
+#define TEC_4_FUNC HAL_PIN_FUNC0
 #define TEC_4_GPIO 1
 #define TEC_4_BIT  9
\ No newline at end of file
@@ -0,0 +1,165 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+#ifndef EVENT_TRACE_H_
+#define EVENT_TRACE_H_
+
+/** @file event_trace.h
+ ** @brief Declaraciones del registro circular de eventos del reloj y de la interfaz - Electrónica 4 2025
+ **
+ ** El reloj, la máquina de estados y las entradas escriben registros de 8 bytes con el tiempo en milisegundos en un
+ ** buffer circular de @ref EVENT_TRACE_SIZE posiciones, así después de una falla se puede ver que pasó antes. Cuando
+ ** el buffer se llena los registros nuevos reemplazan a los más viejos.
+ **
+ ** La escritura no usa bloqueos ni deshabilita interrupciones: cada escritor reserva una posición con un incremento
+ ** atómico y marca el registro como completo con su número de secuencia al terminar, por lo que se puede escribir
+ ** desde las interrupciones y desde el lazo principal a la vez. El lector descarta los registros que encuentra a
+ ** medio escribir o que se reemplazaron mientras los copiaba.
+ **
+ ** Significado de los campos de cada evento:
+ ** \li @ref EVENT_TRACE_ALARM_FIRED: detail 1 si terminó una posposición, 0 si llegó la hora de la alarma
+ ** \li @ref EVENT_TRACE_ALARM_SNOOZED: detail las veces que se pospuso, value los segundos limitados a 65535
+ ** \li @ref EVENT_TRACE_ALARM_OFF: detail 1 si se apagó sola por sonar demasiado tiempo, 0 si la apagó el usuario
+ ** \li @ref EVENT_TRACE_TIME_SET y @ref EVENT_TRACE_ALARM_SET: detail las horas, value los segundos de la hora
+ ** \li @ref EVENT_TRACE_STATE_CHANGED: detail el evento, value el estado anterior << 8 | el estado nuevo
+ ** \li @ref EVENT_TRACE_INPUT_EDGE: detail el nivel eléctrico, value el puerto GPIO << 8 | el bit
+ ** \li @ref EVENT_TRACE_DEADLINE_MISSED: detail el trabajo atrasado, value el atraso limitado a 65535
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "config.h"
+#include <stdint.h>
+#include <stddef.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#ifndef EVENT_TRACE_SIZE
+//! Cantidad de registros del buffer circular, debe ser una potencia de 2
+#define EVENT_TRACE_SIZE 64
+#endif
+
+#ifdef USE_EVENT_TRACE
+//! Escribe un registro, no genera código si no se define USE_EVENT_TRACE
+#define EVENT_TRACE(event, detail, value) EventTraceWrite((event), (detail), (value))
+#else
+// Los datos se descartan para que las variables que solo se usan en el registro no generen advertencias
+#define EVENT_TRACE(event, detail, value) ((void)(event), (void)(detail), (void)(value))
+#endif
+
+/* === Public data type declarations =============================================================================== */
+
+//! Eventos que se registran
+typedef enum event_trace_event_e {
+    EVENT_TRACE_ALARM_FIRED,     //!< la alarma empezó a sonar
+    EVENT_TRACE_ALARM_SNOOZED,   //!< se pospuso la alarma
+    EVENT_TRACE_ALARM_OFF,       //!< se apagó la alarma
+    EVENT_TRACE_TIME_SET,        //!< se ajustó la hora
+    EVENT_TRACE_ALARM_SET,       //!< se ajustó la hora de la alarma
+    EVENT_TRACE_STATE_CHANGED,   //!< una máquina de estados atendió un evento
+    EVENT_TRACE_INPUT_EDGE,      //!< cambió el nivel de una entrada
+    EVENT_TRACE_DEADLINE_MISSED, //!< un trabajo periódico no cumplió su plazo
+    EVENT_TRACE_EVENTS_COUNT,
+} event_trace_event_e;
+
+//! Registro de un evento
+typedef struct event_trace_record_s {
+    uint32_t time;  //!< milisegundos según la función indicada en @ref EventTraceInit()
+    uint8_t event;  //!< evento, ver @ref event_trace_event_e
+    uint8_t detail; //!< primer dato del evento
+    uint16_t value; //!< segundo dato del evento
+} event_trace_record_t;
+
+/**
+ * @brief Función que devuelve el tiempo con el que se marcan los registros
+ *
+ * @return tiempo en milisegundos
+ */
+typedef uint32_t (*event_trace_clock_p)(void);
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Función que vacía el registro e indica de donde se obtiene el tiempo
+ *
+ * No se debe llamar mientras otro escritor usa el registro.
+ *
+ * @param clock función que devuelve el tiempo en milisegundos, NULL para marcar todos los registros con 0
+ */
+void EventTraceInit(event_trace_clock_p clock);
+
+/**
+ * @brief Función que escribe un registro, se usa a través de @ref EVENT_TRACE
+ *
+ * @param event evento, ver @ref event_trace_event_e
+ * @param detail primer dato del evento
+ * @param value segundo dato del evento
+ */
+void EventTraceWrite(uint8_t event, uint8_t detail, uint16_t value);
+
+/**
+ * @brief Función que devuelve la cantidad de registros escritos desde @ref EventTraceInit()
+ *
+ * Sirve como cursor para leer solo los registros que se escriban a partir de ahora.
+ *
+ * @return cantidad de registros escritos, incluyendo los reemplazados
+ */
+uint32_t EventTraceCount(void);
+
+/**
+ * @brief Función que lee el siguiente registro completo a partir de un cursor
+ *
+ * Un cursor en 0 empieza por el registro más viejo que todavía está en el buffer. Los registros reemplazados o a medio
+ * escribir se saltean, la diferencia entre el número del registro leído y el cursor anterior indica cuantos se
+ * perdieron.
+ *
+ * @param cursor número del próximo registro a leer, se avanza después del registro leído
+ * @param sequence número del registro leído
+ * @param record registro leído
+ * @return 0 si se leyó un registro, -1 si no hay más registros
+ */
+int EventTraceRead(uint32_t * cursor, uint32_t * sequence, event_trace_record_t * record);
+
+/**
+ * @brief Función que escribe un registro como una línea JSON terminada en salto de línea
+ *
+ * @param sequence número del registro devuelto por @ref EventTraceRead()
+ * @param record registro
+ * @param buffer texto resultante
+ * @param size tamaño del buffer
+ * @return largo del texto, si es mayor o igual a @p size el texto se recortó
+ */
+int EventTraceFormat(uint32_t sequence, const event_trace_record_t * record, char * buffer, size_t size);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EVENT_TRACE_H_ */
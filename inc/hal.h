@@ -0,0 +1,398 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef HAL_H_
+#define HAL_H_
+
+/** @file hal.h
+ ** @brief Declaraciones de la capa de abstracción del hardware - Electrónica 4 2025
+ **
+ ** Los módulos del proyecto acceden al hardware solamente a través de estas funciones. Existe una implementación para
+ ** el LPC43xx de la EDU-CIAA (src/hal_lpc43xx.c) y otra para compilar el firmware como un programa de Linux, con los
+ ** registros en memoria y el tiempo simulado (host/hal_host.c).
+ **
+ ** El RTC cuenta los segundos con su propio oscilador y los conserva mientras la placa está apagada, con la batería de
+ ** respaldo. Con la interrupción periódica detenida el procesador solo despierta con la alarma del RTC o con un cambio
+ ** en las entradas indicadas con @ref HalWakeOnChange().
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+//! Cantidad de puertos GPIO
+#define HAL_GPIO_PORTS 8
+
+/**
+ * @brief Clase de almacenamiento de las variables que representan el estado de una placa
+ *
+ * En la placa no tiene efecto. En el host cada hilo simula una placa distinta, por lo que estas variables son locales
+ * a cada hilo.
+ */
+#ifdef HOST
+#define HAL_BOARD_LOCAL __thread
+#else
+#define HAL_BOARD_LOCAL
+#endif
+
+//! Funciones alternativas de un pin, se indican en el archivo de configuración de la placa
+#define HAL_PIN_FUNC0  0
+#define HAL_PIN_FUNC1  1
+#define HAL_PIN_FUNC2  2
+#define HAL_PIN_FUNC3  3
+#define HAL_PIN_FUNC4  4
+#define HAL_PIN_FUNC5  5
+#define HAL_PIN_FUNC6  6
+#define HAL_PIN_FUNC7  7
+
+//! Instante de la alarma del RTC que no la dispara nunca
+#define HAL_RTC_NO_ALARM UINT32_MAX
+
+/* === Public data type declarations =============================================================================== */
+
+//! Configuración eléctrica de un pin
+typedef enum hal_pin_mode_e {
+    HAL_PIN_INPUT_PULLUP, //!< entrada con resistencia de pull-up
+    HAL_PIN_OUTPUT,       //!< salida sin resistencias de pull-up ni pull-down
+} hal_pin_mode_t;
+
+//! Función que atiende una interrupción
+typedef void (*hal_handler_p)(void);
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Función para asignar la función y la configuración eléctrica de un pin del encapsulado
+ *
+ * @param port puerto del pin en el encapsulado
+ * @param pin número de pin dentro del puerto
+ * @param mode configuración eléctrica
+ * @param function función alternativa, una de HAL_PIN_FUNCx
+ */
+void HalPinMux(uint8_t port, uint8_t pin, hal_pin_mode_t mode, uint8_t function);
+
+/**
+ * @brief Función para definir si un bit de un puerto GPIO es entrada o salida
+ *
+ * @param gpio puerto GPIO
+ * @param bit bit dentro del puerto
+ * @param output true si es salida
+ */
+void HalGpioSetDirection(uint8_t gpio, uint8_t bit, bool output);
+
+/**
+ * @brief Función para leer el estado de un bit de un puerto GPIO
+ *
+ * @param gpio puerto GPIO
+ * @param bit bit dentro del puerto
+ * @return estado del bit
+ */
+bool HalGpioReadBit(uint8_t gpio, uint8_t bit);
+
+/**
+ * @brief Función para escribir un bit de un puerto GPIO
+ *
+ * @param gpio puerto GPIO
+ * @param bit bit dentro del puerto
+ * @param state nuevo estado del bit
+ */
+void HalGpioWriteBit(uint8_t gpio, uint8_t bit, bool state);
+
+/**
+ * @brief Función para invertir un bit de un puerto GPIO
+ *
+ * @param gpio puerto GPIO
+ * @param bit bit dentro del puerto
+ */
+void HalGpioToggleBit(uint8_t gpio, uint8_t bit);
+
+/**
+ * @brief Función para leer todos los bits de un puerto GPIO
+ *
+ * @param gpio puerto GPIO
+ * @return valor del puerto
+ */
+uint32_t HalGpioReadPort(uint8_t gpio);
+
+/**
+ * @brief Función para poner en uno los bits indicados de un puerto GPIO sin modificar los demás
+ *
+ * @param gpio puerto GPIO
+ * @param mask bits a poner en uno
+ */
+void HalGpioSetBits(uint8_t gpio, uint32_t mask);
+
+/**
+ * @brief Función para poner en cero los bits indicados de un puerto GPIO sin modificar los demás
+ *
+ * @param gpio puerto GPIO
+ * @param mask bits a poner en cero
+ */
+void HalGpioClearBits(uint8_t gpio, uint32_t mask);
+
+/**
+ * @brief Función para escribir en una única operación los bits indicados de un puerto GPIO
+ *
+ * @param gpio puerto GPIO
+ * @param mask bits que se modifican
+ * @param value valor de los bits indicados en @p mask
+ */
+void HalGpioWriteMasked(uint8_t gpio, uint32_t mask, uint32_t value);
+
+/**
+ * @brief Función para iniciar la interrupción periódica del sistema
+ *
+ * También habilita el contador de ciclos.
+ *
+ * @param ticks_per_second frecuencia de la interrupción
+ * @param handler función que se llama en cada interrupción
+ */
+void HalTickStart(uint32_t ticks_per_second, hal_handler_p handler);
+
+/**
+ * @brief Función para detener y volver a habilitar la interrupción periódica sin cambiar su frecuencia
+ *
+ * @param enabled true para habilitarla, false para detenerla
+ */
+void HalTickEnable(bool enabled);
+
+/**
+ * @brief Función para registrar la función que atiende el trabajo diferido
+ *
+ * El trabajo diferido se ejecuta con la menor prioridad, después de las demás interrupciones.
+ *
+ * @param handler función que realiza el trabajo diferido
+ */
+void HalDeferredStart(hal_handler_p handler);
+
+/**
+ * @brief Función para pedir que se ejecute el trabajo diferido
+ *
+ */
+void HalDeferredRequest(void);
+
+/**
+ * @brief Función que habilita el contador de ciclos del procesador sin iniciar la interrupción periódica
+ *
+ */
+void HalCycleCounterStart(void);
+
+/**
+ * @brief Función que devuelve el contador de ciclos del procesador
+ *
+ * @return cantidad de ciclos, desborda
+ */
+uint32_t HalCycleCounter(void);
+
+/**
+ * @brief Función que devuelve la frecuencia del contador de ciclos
+ *
+ * @return cuentas por segundo
+ */
+uint32_t HalCycleCounterFrequency(void);
+
+/**
+ * @brief Función que devuelve un contador de alta resolución para medir la duración del código
+ *
+ * En la placa es el contador de ciclos. En el host es un reloj monotónico en nanosegundos aunque el tiempo de la placa
+ * sea simulado, para que las mediciones reflejen el costo real en el procesador que ejecuta la simulación.
+ *
+ * @return cuentas del contador, desborda, con la frecuencia de @ref HalCycleCounterFrequency()
+ */
+uint32_t HalTimestamp(void);
+
+/**
+ * @brief Función que devuelve el tiempo transcurrido desde que se disparó la interrupción periódica actual
+ *
+ * Llamada al entrar a la rutina de la interrupción periódica mide la latencia de la interrupción.
+ *
+ * @return cuentas del contador de ciclos
+ */
+uint32_t HalTickLatency(void);
+
+/**
+ * @brief Función que indica si la interrupción periódica se volvió a disparar antes de terminar de atenderla
+ *
+ * Llamada al final de la rutina de la interrupción periódica indica que la rutina terminó después del siguiente tick,
+ * que se atiende tarde. Si la rutina dura más de dos periodos se pierden ticks. En el host con tiempo simulado
+ * devuelve siempre false porque el tiempo no avanza durante la rutina.
+ *
+ * @return true si la interrupción periódica está pendiente
+ */
+bool HalTickOverrun(void);
+
+/**
+ * @brief Función para deshabilitar las interrupciones
+ *
+ */
+void HalInterruptsDisable(void);
+
+/**
+ * @brief Función para habilitar las interrupciones
+ *
+ */
+void HalInterruptsEnable(void);
+
+/**
+ * @brief Función que duerme al procesador hasta la próxima interrupción
+ *
+ * Despierta aunque las interrupciones estén deshabilitadas, de modo que se puede llamar después de
+ * @ref HalInterruptsDisable() para no perder una interrupción que llegó antes de dormir.
+ *
+ */
+void HalSleep(void);
+
+/**
+ * @brief Función que devuelve el tamaño del almacenamiento no volátil
+ *
+ * En la placa es la EEPROM interna del LPC43xx. En el host es un buffer en memoria que se puede respaldar en un archivo.
+ *
+ * @return tamaño en bytes, múltiplo de 4
+ */
+uint32_t HalStorageSize(void);
+
+/**
+ * @brief Función para leer del almacenamiento no volátil
+ *
+ * @param address posición del primer byte, múltiplo de 4
+ * @param data bytes leídos
+ * @param size cantidad de bytes, múltiplo de 4
+ */
+void HalStorageRead(uint32_t address, void * data, size_t size);
+
+/**
+ * @brief Función para escribir en el almacenamiento no volátil
+ *
+ * Espera a que termine la programación, en la placa unos 3 ms por cada página de 128 bytes que se modifica. Una
+ * interrupción de la alimentación durante la escritura puede dejar los bytes escritos con cualquier valor.
+ *
+ * @param address posición del primer byte, múltiplo de 4
+ * @param data bytes a escribir
+ * @param size cantidad de bytes, múltiplo de 4
+ * @return true si la posición y el tamaño son válidos
+ */
+bool HalStorageWrite(uint32_t address, const void * data, size_t size);
+
+/**
+ * @brief Función para iniciar el puerto serie y la recepción circular por DMA
+ *
+ * En la placa es la USART2 conectada al USB de depuración. El DMA escribe los bytes recibidos en el buffer y vuelve al
+ * principio al llegar al final, sin interrumpir al procesador, así quien lo lee solo compara su posición con
+ * @ref HalSerialReceived(). En el host con tiempo real el puerto es una pseudo terminal.
+ *
+ * @param baud_rate velocidad en bits por segundo
+ * @param buffer buffer circular de recepción, debe existir mientras se use el puerto
+ * @param size tamaño del buffer
+ */
+void HalSerialStart(uint32_t baud_rate, uint8_t * buffer, size_t size);
+
+/**
+ * @brief Función que devuelve la posición del buffer de recepción en la que el DMA escribe el próximo byte
+ *
+ * @return posición, menor que el tamaño del buffer
+ */
+size_t HalSerialReceived(void);
+
+/**
+ * @brief Función para enviar bytes por el puerto serie con DMA, sin copiarlos
+ *
+ * Los bytes no se deben modificar hasta que @ref HalSerialBusy() devuelva false.
+ *
+ * @param data bytes a enviar
+ * @param size cantidad de bytes
+ * @return true si empezó el envío, false si todavía se está enviando el anterior
+ */
+bool HalSerialSend(const void * data, size_t size);
+
+/**
+ * @brief Función para saber si el DMA todavía está enviando bytes
+ *
+ * @return true si el envío anterior no terminó
+ */
+bool HalSerialBusy(void);
+
+/**
+ * @brief Función para iniciar el RTC y registrar la función que atiende su alarma
+ *
+ * Si el RTC ya estaba contando, porque solo se reinició el procesador o lo mantuvo la batería, conserva su cuenta. En
+ * la placa iniciar el RTC por primera vez espera unos 2 s a que arranque su oscilador. En el host con tiempo real el
+ * RTC empieza con la hora UTC del sistema y con tiempo simulado empieza sin hora, salvo que se indique una con
+ * HalHostSetRtc().
+ *
+ * @param handler función que se llama en la interrupción de la alarma
+ */
+void HalRtcStart(hal_handler_p handler);
+
+/**
+ * @brief Función que lee los segundos del RTC
+ *
+ * @param seconds segundos UTC desde el 1 de enero de 1970
+ * @return true si el RTC conserva la hora desde la última vez que se escribió, false si se perdió o nunca se escribió
+ */
+bool HalRtcRead(uint32_t * seconds);
+
+/**
+ * @brief Función para poner en hora el RTC
+ *
+ * El RTC empieza a contar un segundo nuevo al escribirlo, así conviene llamarla al comenzar un segundo.
+ *
+ * @param seconds segundos UTC desde el 1 de enero de 1970
+ */
+void HalRtcWrite(uint32_t seconds);
+
+/**
+ * @brief Función para programar la interrupción de la alarma del RTC
+ *
+ * La interrupción se pide una vez al llegar al instante indicado, o de inmediato si el RTC ya lo pasó.
+ *
+ * @param seconds instante de la alarma en segundos UTC desde 1970, @ref HAL_RTC_NO_ALARM para no pedirla
+ */
+void HalRtcSetAlarm(uint32_t seconds);
+
+/**
+ * @brief Función para despertar al procesador cuando cambia el nivel de alguno de los bits de un puerto GPIO
+ *
+ * Compara con los niveles de los bits al llamarla y llama a la función una sola vez, desde una interrupción. En la
+ * placa usa la interrupción del grupo 0 de GPIO, por lo que solo se puede vigilar un puerto a la vez.
+ *
+ * @param gpio puerto GPIO
+ * @param mask bits que se vigilan
+ * @param handler función que se llama al cambiar alguno de los bits, NULL para dejar de vigilarlos
+ */
+void HalWakeOnChange(uint8_t gpio, uint32_t mask, hal_handler_p handler);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HAL_H_ */
@@ -0,0 +1,157 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+#ifndef INPUT_TRACE_H_
+#define INPUT_TRACE_H_
+
+/** @file input_trace.h
+ ** @brief Declaraciones del registro binario compacto de cambios de las entradas digitales - Electrónica 4 2025
+ **
+ ** Un registro guarda cada cambio de nivel que el firmware observa en sus entradas junto con la cantidad de ticks en
+ ** que lo observó. Al reproducirlo poniendo cada nivel en el mismo tick, el firmware lee exactamente los mismos valores
+ ** que durante la grabación, por lo que una sesión capturada se vuelve una prueba determinista.
+ **
+ ** Formato, todos los números en little endian:
+ ** \li Encabezado de @ref INPUT_TRACE_HEADER_SIZE bytes: "RTRC", versión, cantidad de canales, ticks por segundo en
+ **     16 bits y para cada uno de los @ref INPUT_TRACE_MAX_CHANNELS canales su puerto GPIO y su bit.
+ ** \li Un registro por cambio: el número (ticks desde el cambio anterior << 4 | canal << 1 | nivel) codificado en
+ **     grupos de 7 bits, con el bit más significativo de cada byte indicando que sigue otro byte.
+ ** \li Un registro final con el canal 7 y nivel 1 cuyos ticks llevan el registro hasta el final de la sesión.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+//! Versión del formato del registro
+#define INPUT_TRACE_VERSION      1
+
+//! Cantidad máxima de entradas distintas en un registro, el canal 7 marca el final
+#define INPUT_TRACE_MAX_CHANNELS 7
+
+//! Tamaño del encabezado en bytes
+#define INPUT_TRACE_HEADER_SIZE  (8 + 2 * INPUT_TRACE_MAX_CHANNELS)
+
+/* === Public data type declarations =============================================================================== */
+
+//! Referencia a un registro de entradas
+typedef struct input_trace_s * input_trace_p;
+
+//! Cambio de una entrada leído de un registro
+typedef struct input_trace_event_s {
+    uint64_t ticks; //!< ticks desde el inicio de la sesión
+    uint8_t gpio;   //!< puerto GPIO de la entrada
+    uint8_t bit;    //!< bit de la entrada
+    bool level;     //!< nivel eléctrico observado
+} input_trace_event_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Función para crear un registro vacío sobre un buffer
+ *
+ * @param buffer memoria donde se escribe el registro
+ * @param size tamaño del buffer, al menos @ref INPUT_TRACE_HEADER_SIZE
+ * @param ticks_per_second frecuencia de la interrupción periódica durante la grabación
+ * @return referencia al registro, NULL si el buffer es muy chico o no hay espacio
+ */
+input_trace_p InputTraceCreate(uint8_t * buffer, size_t size, uint16_t ticks_per_second);
+
+/**
+ * @brief Función para leer un registro terminado
+ *
+ * @param buffer memoria con el registro
+ * @param size tamaño del registro
+ * @return referencia al registro, NULL si no es válido, no tiene el registro final o no hay espacio
+ */
+input_trace_p InputTraceOpen(const uint8_t * buffer, size_t size);
+
+/**
+ * @brief Función que libera un registro, el buffer queda a cargo de quien lo creó
+ *
+ * @param trace referencia al registro
+ */
+void InputTraceDestroy(input_trace_p trace);
+
+/**
+ * @brief Función que agrega un cambio de nivel de una entrada
+ *
+ * @param trace referencia al registro
+ * @param ticks ticks desde el inicio de la sesión, no puede ser menor que el del cambio anterior
+ * @param gpio puerto GPIO de la entrada
+ * @param bit bit de la entrada
+ * @param level nivel eléctrico observado
+ * @return true si se agregó, false si el buffer está lleno, hay demasiadas entradas o el registro está terminado
+ */
+bool InputTraceRecord(input_trace_p trace, uint64_t ticks, uint8_t gpio, uint8_t bit, bool level);
+
+/**
+ * @brief Función que termina un registro con la duración de la sesión
+ *
+ * @param trace referencia al registro
+ * @param ticks ticks totales de la sesión
+ * @return tamaño del registro en bytes, 0 si no entra el registro final
+ */
+size_t InputTraceFinish(input_trace_p trace, uint64_t ticks);
+
+/**
+ * @brief Función que devuelve la frecuencia de la interrupción periódica durante la grabación
+ *
+ * @param trace referencia al registro
+ * @return ticks por segundo
+ */
+uint16_t InputTraceTicksPerSecond(input_trace_p trace);
+
+/**
+ * @brief Función que devuelve la duración de la sesión
+ *
+ * @param trace referencia al registro
+ * @return ticks totales
+ */
+uint64_t InputTraceDuration(input_trace_p trace);
+
+/**
+ * @brief Función que lee el próximo cambio de un registro abierto con @ref InputTraceOpen()
+ *
+ * @param trace referencia al registro
+ * @param event cambio leído
+ * @return true si se leyó un cambio, false al llegar al final o si el registro está dañado
+ */
+bool InputTraceNext(input_trace_p trace, input_trace_event_t * event);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INPUT_TRACE_H_ */
@@ -0,0 +1,144 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef OUTPUT_PATTERN_H_
+#define OUTPUT_PATTERN_H_
+
+/** @file output_pattern.h
+ ** @brief Declaraciones del modulo generador de patrones sobre salidas digitales - Electrónica 4 2025
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "digital_output.h"
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+//! Cantidad de llamadas a @ref OutputPatternTick() que dura un periodo del PWM por software
+#ifndef OUTPUT_PATTERN_PWM_PERIOD
+#define OUTPUT_PATTERN_PWM_PERIOD 10
+#endif
+
+/* === Public data type declarations =============================================================================== */
+
+//! Referencia a un generador de patrones
+typedef struct output_pattern_s * output_pattern_p;
+
+//! Paso de una secuencia, la salida se mantiene con el mismo ciclo de trabajo durante @ref ticks llamadas
+typedef struct output_pattern_step_s {
+    uint8_t duty;   //!< cantidad de ticks de cada periodo de PWM en los que la salida está activa, 0 es apagada
+    uint16_t ticks; //!< duración del paso en llamadas a @ref OutputPatternTick()
+} output_pattern_step_t;
+
+//! Secuencia precalculada de pasos que reproduce un generador de patrones
+typedef struct output_sequence_s {
+    const output_pattern_step_t * steps; //!< array con los pasos de la secuencia
+    uint8_t count;                       //!< cantidad de pasos del array
+    bool loop;                           //!< indica si al terminar el último paso vuelve a empezar
+} output_sequence_t;
+
+/* === Public variable declarations ================================================================================ */
+
+//! Dos pitidos cortos seguidos de un silencio, se repite
+extern const output_sequence_t OUTPUT_SEQUENCE_BEEP_BEEP;
+
+//! Pitidos que aumentan su ciclo de trabajo hasta quedar encendido, se repite
+extern const output_sequence_t OUTPUT_SEQUENCE_ESCALATING;
+
+//! Encendido y apagado gradual, pensado para leds, se repite
+extern const output_sequence_t OUTPUT_SEQUENCE_PULSE;
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Función para crear un generador de patrones sobre una salida digital
+ *
+ * Deja la salida inactiva. Si no hay memoria disponible o la salida es NULL devuelve NULL.
+ *
+ * @param output salida digital que controla el generador
+ * @param inverted indica si la salida es activa en bajo
+ * @return output_pattern_p referencia al generador creado
+ */
+output_pattern_p OutputPatternCreate(digital_output_p output, bool inverted);
+
+/**
+ * @brief Función para empezar a reproducir una secuencia desde su primer paso
+ *
+ * Si el generador ya estaba reproduciendo una secuencia la reemplaza.
+ *
+ * @param pattern referencia al generador
+ * @param sequence secuencia a reproducir, debe permanecer válida mientras se reproduce
+ * @return devuelve -1 si la secuencia no tiene pasos, 0 en caso contrario
+ */
+int OutputPatternStart(output_pattern_p pattern, const output_sequence_t * sequence);
+
+/**
+ * @brief Función para detener la secuencia que se está reproduciendo y dejar la salida inactiva
+ *
+ * No escribe la salida, queda inactiva en la próxima llamada a @ref OutputPatternTick() o a
+ * @ref OutputPatternTickBatch().
+ *
+ * @param pattern referencia al generador
+ */
+void OutputPatternStop(output_pattern_p pattern);
+
+/**
+ * @brief Función para saber si el generador está reproduciendo una secuencia
+ *
+ * @param pattern referencia al generador
+ * @return true si hay una secuencia en reproducción
+ */
+bool OutputPatternIsRunning(output_pattern_p pattern);
+
+/**
+ * @brief Función que avanza la secuencia un tick, se debe llamar periódicamente, por ejemplo desde el SysTick
+ *
+ * Su costo es constante y solo escribe la salida cuando cambia su estado.
+ *
+ * @param pattern referencia al generador
+ */
+void OutputPatternTick(output_pattern_p pattern);
+
+/**
+ * @brief Función que avanza la secuencia un tick y agrega el cambio de la salida a un lote en lugar de escribirla
+ *
+ * Permite escribir la salida junto con otras del mismo puerto en una sola transacción, o juntar varios ticks en una
+ * única escritura. Se debe llamar desde el mismo contexto que escribe el lote con @ref DigitalOutputBatchCommit(). Si
+ * el lote ya tiene salidas de otro puerto el cambio no se agrega y se vuelve a intentar en el próximo tick.
+ *
+ * @param pattern referencia al generador
+ * @param batch lote al que se agrega la salida solo si cambia su estado
+ */
+void OutputPatternTickBatch(output_pattern_p pattern, digital_output_batch_t * batch);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* OUTPUT_PATTERN_H_ */
@@ -0,0 +1,175 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+#ifndef PROFILER_H_
+#define PROFILER_H_
+
+/** @file profiler.h
+ ** @brief Declaraciones de las mediciones de duración y latencia de las rutinas de interrupción - Electrónica 4 2025
+ **
+ ** Cada región medida acumula la cantidad de ejecuciones, el mínimo, el máximo, el promedio y un histograma con
+ ** escala logarítmica de su duración y de su latencia, medidas con @ref HalTimestamp(). El cubo i del histograma
+ ** cuenta los valores v con 2^(i-1) <= v < 2^i, el cubo 0 cuenta los ceros y el último también los valores mayores.
+ **
+ ** Las regiones se usan con las macros, que no generan código si no se define USE_PROFILER:
+ ** \code
+ ** PROFILER_REGION(tick_region, "SysTick");
+ **
+ ** void Handler(void) {
+ **     PROFILER_ENTER(tick_region, HalTickLatency());
+ **     ...
+ **     PROFILER_EXIT(tick_region);
+ ** }
+ ** \endcode
+ ** y @ref PROFILER_START(tick_region) durante la inicialización reinicia la región y la agrega a la lista que se lee
+ ** en tiempo de ejecución con @ref ProfilerCount() y @ref ProfilerSnapshot().
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "config.h"
+#include "hal.h"
+#include <stdint.h>
+#include <stddef.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#ifndef PROFILER_BUCKETS
+//! Cantidad de cubos de los histogramas, con 20 el último empieza en 2^18 ciclos, más de 1 ms a 204 MHz
+#define PROFILER_BUCKETS     20
+#endif
+
+#ifndef PROFILER_MAX_REGIONS
+//! Cantidad máxima de regiones que se pueden leer en tiempo de ejecución
+#define PROFILER_MAX_REGIONS 4
+#endif
+
+#ifdef USE_PROFILER
+
+//! Define una región medida, local a cada placa simulada en el host
+#define PROFILER_REGION(region, text) static HAL_BOARD_LOCAL profiler_region_t region = {.name = text}
+
+//! Reinicia una región y la agrega a la lista de regiones
+#define PROFILER_START(region)        ProfilerStart(&region)
+
+//! Marca la entrada a una región con su latencia, debe estar en el mismo bloque que @ref PROFILER_EXIT
+#define PROFILER_ENTER(region, latency)                                                                                \
+    uint32_t region##_start = HalTimestamp();                                                                          \
+    ProfilerEnter(&region, latency)
+
+//! Marca la salida de una región
+#define PROFILER_EXIT(region)         ProfilerExit(&region, region##_start)
+
+#else
+
+// Un tipo sin uso en lugar de la variable, así el punto y coma de la definición sigue siendo válido
+#define PROFILER_REGION(region, text) typedef int region##_disabled_t
+#define PROFILER_START(region)
+#define PROFILER_ENTER(region, latency)
+#define PROFILER_EXIT(region)
+
+#endif
+
+/* === Public data type declarations =============================================================================== */
+
+//! Estadísticas de una magnitud medida, en cuentas de @ref HalTimestamp()
+typedef struct profiler_stats_s {
+    uint32_t last;                        //!< última medición
+    uint32_t min;                         //!< medición mínima
+    uint32_t max;                         //!< medición máxima
+    uint64_t total;                       //!< suma de las mediciones, para el promedio
+    uint32_t histogram[PROFILER_BUCKETS]; //!< cantidad de mediciones en cada cubo
+} profiler_stats_t;
+
+//! Región medida
+typedef struct profiler_region_s {
+    const char * name;         //!< nombre de la región
+    uint32_t count;            //!< cantidad de ejecuciones
+    profiler_stats_t duration; //!< duración de cada ejecución
+    profiler_stats_t latency;  //!< demora entre el pedido de la interrupción y la entrada a la región
+} profiler_region_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Función que reinicia una región y la agrega a la lista de regiones si no estaba
+ *
+ * @param region región medida
+ * @return 0 si la región está en la lista, -1 si la lista está llena
+ */
+int ProfilerStart(profiler_region_t * region);
+
+/**
+ * @brief Función que registra la latencia de una ejecución de la región, se usa a través de @ref PROFILER_ENTER
+ *
+ * @param region región medida
+ * @param latency latencia en cuentas de @ref HalTimestamp()
+ */
+void ProfilerEnter(profiler_region_t * region, uint32_t latency);
+
+/**
+ * @brief Función que registra la duración de una ejecución de la región, se usa a través de @ref PROFILER_EXIT
+ *
+ * @param region región medida
+ * @param start valor de @ref HalTimestamp() al entrar a la región
+ */
+void ProfilerExit(profiler_region_t * region, uint32_t start);
+
+/**
+ * @brief Función que devuelve la cantidad de regiones en la lista
+ *
+ * @return cantidad de regiones
+ */
+size_t ProfilerCount(void);
+
+/**
+ * @brief Función que copia una región de la lista con las interrupciones deshabilitadas, para leerla entera
+ *
+ * @param index posición de la región en la lista
+ * @param copy copia de la región
+ * @return 0 si la región existe, -1 en caso contrario
+ */
+int ProfilerSnapshot(size_t index, profiler_region_t * copy);
+
+/**
+ * @brief Función que escribe una región como una línea JSON terminada en salto de línea
+ *
+ * @param region región medida
+ * @param buffer texto resultante
+ * @param size tamaño del buffer
+ * @return largo del texto, si es mayor o igual a @p size el texto se recortó
+ */
+int ProfilerFormat(const profiler_region_t * region, char * buffer, size_t size);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PROFILER_H_ */
@@ -0,0 +1,179 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef SCHEDULER_H_
+#define SCHEDULER_H_
+
+/** @file scheduler.h
+ ** @brief Declaraciones del planificador de tareas periódicas con bajo consumo - Electrónica 4 2025
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* === Public data type declarations =============================================================================== */
+
+//! Referencia a un planificador
+typedef struct scheduler_s * scheduler_p;
+
+//! Tarea periódica que ejecuta el planificador
+typedef void (*scheduler_task_p)(void);
+
+/**
+ * @brief Función que devuelve la cantidad de ticks transcurridos, es la base de tiempo de los plazos de las tareas
+ *
+ * @return cantidad de ticks, puede desbordar
+ */
+typedef uint32_t (*scheduler_now_p)(void);
+
+/**
+ * @brief Función que duerme al procesador hasta la próxima interrupción
+ *
+ * Debe dormir solamente si la cantidad de ticks sigue siendo @p now, por ejemplo deshabilitando las interrupciones,
+ * comparando y ejecutando WFI, para no perder un tick que llegó justo antes de dormir.
+ *
+ * @param now cantidad de ticks con la que el planificador decidió dormir
+ */
+typedef void (*scheduler_sleep_p)(uint32_t now);
+
+/**
+ * @brief Función que devuelve un contador de alta resolución para medir el tiempo dormido, por ejemplo ciclos
+ *
+ * @return valor del contador, puede desbordar
+ */
+typedef uint32_t (*scheduler_cycles_p)(void);
+
+/**
+ * @brief Función que se llama cuando una tarea se atrasó tanto que se saltearon periodos
+ *
+ * @param task tarea atrasada
+ * @param lateness atraso en ticks respecto del plazo, mayor o igual al periodo
+ */
+typedef void (*scheduler_missed_p)(scheduler_task_p task, uint32_t lateness);
+
+//! Interface con las funciones que necesita el planificador
+typedef struct scheduler_driver_s {
+    scheduler_now_p Now;       //!< base de tiempo de los plazos
+    scheduler_sleep_p Sleep;   //!< función para dormir al procesador
+    scheduler_cycles_p Cycles; //!< contador para medir el tiempo dormido, si es NULL se usa Now
+    scheduler_missed_p Missed; //!< función que se llama al saltear periodos, puede ser NULL
+} const * scheduler_driver_p;
+
+//! Estadísticas de uso del procesador
+typedef struct scheduler_stats_s {
+    uint32_t wakeups; //!< cantidad de veces que el procesador despertó
+    uint32_t runs;    //!< cantidad de tareas ejecutadas
+    uint64_t idle;    //!< tiempo que el procesador estuvo dormido, en unidades de Cycles
+    uint64_t elapsed; //!< tiempo total desde que se reiniciaron las estadísticas, en unidades de Cycles
+    uint32_t skipped; //!< periodos de las tareas que no se ejecutaron por atraso
+    uint32_t worst;   //!< máximo atraso de una tarea respecto de su plazo, en ticks
+} scheduler_stats_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Función para crear un planificador
+ *
+ * @param driver interface con las funciones de tiempo y de bajo consumo
+ * @return scheduler_p referencia al planificador, NULL si el driver es invalido o no hay memoria
+ */
+scheduler_p SchedulerCreate(scheduler_driver_p driver);
+
+/**
+ * @brief Función para agregar una tarea periódica
+ *
+ * La tarea se ejecuta por primera vez @p period ticks después de agregarla.
+ *
+ * @param scheduler referencia al planificador
+ * @param task función a ejecutar
+ * @param period periodo de la tarea en ticks, debe ser mayor a cero
+ * @return devuelve -1 si no hay lugar para más tareas o los argumentos son invalidos, 0 en caso contrario
+ */
+int SchedulerAddTask(scheduler_p scheduler, scheduler_task_p task, uint32_t period);
+
+/**
+ * @brief Función para quitar una tarea del planificador
+ *
+ * Si la tarea se agregó más de una vez se quitan todas sus apariciones.
+ *
+ * @param scheduler referencia al planificador
+ * @param task función que se agregó con @ref SchedulerAddTask()
+ * @return devuelve -1 si la tarea no estaba en el planificador, 0 en caso contrario
+ */
+int SchedulerRemoveTask(scheduler_p scheduler, scheduler_task_p task);
+
+/**
+ * @brief Función que ejecuta las tareas cuyo plazo se cumplió
+ *
+ * Una tarea se ejecuta cuando la cantidad de ticks es mayor o igual a su plazo, por lo que una iteración demorada no
+ * pierde el periodo. Si la tarea se atrasó más de un periodo se ejecuta una sola vez, se vuelve a sincronizar, se
+ * cuentan los periodos salteados y se llama a la función Missed del driver.
+ *
+ * @param scheduler referencia al planificador
+ * @return devuelve true si se ejecutó alguna tarea
+ */
+bool SchedulerRunPending(scheduler_p scheduler);
+
+/**
+ * @brief Función que ejecuta las tareas pendientes y, si no había ninguna, duerme al procesador
+ *
+ * Se debe llamar en el lazo principal.
+ *
+ * @param scheduler referencia al planificador
+ */
+void SchedulerRun(scheduler_p scheduler);
+
+/**
+ * @brief Función para obtener las estadísticas de uso del procesador
+ *
+ * El ciclo de trabajo es (elapsed - idle) / elapsed. Los tiempos se acumulan en 64 bits en cada despertar, así no
+ * desbordan aunque el contador del driver dé la vuelta en segundos. Solo un sueño más largo que una vuelta del
+ * contador se cuenta incompleto, y como se cuenta igual en los dos tiempos el ciclo de trabajo sigue siendo válido.
+ *
+ * @param scheduler referencia al planificador
+ * @param stats variable en la que se devuelven las estadísticas
+ */
+void SchedulerGetStats(scheduler_p scheduler, scheduler_stats_t * stats);
+
+/**
+ * @brief Función para reiniciar las estadísticas de uso del procesador
+ *
+ * @param scheduler referencia al planificador
+ */
+void SchedulerResetStats(scheduler_p scheduler);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCHEDULER_H_ */
@@ -32,6 +32,7 @@ SPDX-License-Identifier: MIT
 #include "digital_output.h"
 #include "display.h"
 #include "config.h"
+#include "hal.h"
 
 /* === Header for C++ compatibility ================================================================================ */
 
@@ -56,7 +57,7 @@ typedef struct shield_s {
 #ifndef USE_DYNAMIC_MEMORY
     bool used; //!< indica si el struc esta siendo usado en caso de no usar memoria dinamica
 #endif
-} const * const shield_p;
+} const * shield_p;
 
 /* === Public variable declarations ================================================================================ */
 
@@ -69,6 +70,15 @@ typedef struct shield_s {
  */
 shield_p ShieldCreate(void);
 
+/**
+ * @brief Función para despertar al procesador cuando se presiona o se suelta cualquier tecla del poncho
+ *
+ * Se compara con el estado de las teclas al llamarla y la función se llama una sola vez, desde una interrupción.
+ *
+ * @param handler función que se llama, NULL para dejar de vigilar las teclas
+ */
+void ShieldWakeOnKeys(hal_handler_p handler);
+
 /* === End of conditional blocks =================================================================================== */
 
 #ifdef __cplusplus
@@ -42,7 +42,7 @@
  ** @{ */
 
 /* === Headers files inclusions ================================================================ */
-#include "chip.h"
+#include "hal.h"
 
 /* === Cabecera C++ ============================================================================ */
 
@@ -57,28 +57,28 @@ extern "C" {
 
 #define DIGIT_0_PORT   0
 #define DIGIT_0_PIN    0
-#define DIGIT_0_FUNC   SCU_MODE_FUNC0
+#define DIGIT_0_FUNC   HAL_PIN_FUNC0
 #define DIGIT_0_GPIO   DIGITS_GPIO
 #define DIGIT_0_BIT    0
 #define DIGIT_0_MASK   (1 << DIGIT_0_BIT)
 
 #define DIGIT_1_PORT   0
 #define DIGIT_1_PIN    1
-#define DIGIT_1_FUNC   SCU_MODE_FUNC0
+#define DIGIT_1_FUNC   HAL_PIN_FUNC0
 #define DIGIT_1_GPIO   DIGITS_GPIO
 #define DIGIT_1_BIT    1
 #define DIGIT_1_MASK   (1 << DIGIT_1_BIT)
 
 #define DIGIT_2_PORT   1
 #define DIGIT_2_PIN    15
-#define DIGIT_2_FUNC   SCU_MODE_FUNC0
+#define DIGIT_2_FUNC   HAL_PIN_FUNC0
 #define DIGIT_2_GPIO   DIGITS_GPIO
 #define DIGIT_2_BIT    2
 #define DIGIT_2_MASK   (1 << DIGIT_2_BIT)
 
 #define DIGIT_3_PORT   1
 #define DIGIT_3_PIN    17
-#define DIGIT_3_FUNC   SCU_MODE_FUNC0
+#define DIGIT_3_FUNC   HAL_PIN_FUNC0
 #define DIGIT_3_GPIO   DIGITS_GPIO
 #define DIGIT_3_BIT    3
 #define DIGIT_3_MASK   (1 << DIGIT_3_BIT)
@@ -90,49 +90,49 @@ extern "C" {
 
 #define SEGMENT_A_PORT 4
 #define SEGMENT_A_PIN  0
-#define SEGMENT_A_FUNC SCU_MODE_FUNC0
+#define SEGMENT_A_FUNC HAL_PIN_FUNC0
 #define SEGMENT_A_GPIO SEGMENTS_GPIO
 #define SEGMENT_A_BIT  0
 #define SEGMENT_A_MASK (1 << SEGMENT_A_BIT)
 
 #define SEGMENT_B_PORT 4
 #define SEGMENT_B_PIN  1
-#define SEGMENT_B_FUNC SCU_MODE_FUNC0
+#define SEGMENT_B_FUNC HAL_PIN_FUNC0
 #define SEGMENT_B_GPIO SEGMENTS_GPIO
 #define SEGMENT_B_BIT  1
 #define SEGMENT_B_MASK (1 << SEGMENT_B_BIT)
 
 #define SEGMENT_C_PORT 4
 #define SEGMENT_C_PIN  2
-#define SEGMENT_C_FUNC SCU_MODE_FUNC0
+#define SEGMENT_C_FUNC HAL_PIN_FUNC0
 #define SEGMENT_C_GPIO SEGMENTS_GPIO
 #define SEGMENT_C_BIT  2
 #define SEGMENT_C_MASK (1 << SEGMENT_C_BIT)
 
 #define SEGMENT_D_PORT 4
 #define SEGMENT_D_PIN  3
-#define SEGMENT_D_FUNC SCU_MODE_FUNC0
+#define SEGMENT_D_FUNC HAL_PIN_FUNC0
 #define SEGMENT_D_GPIO SEGMENTS_GPIO
 #define SEGMENT_D_BIT  3
 #define SEGMENT_D_MASK (1 << SEGMENT_D_BIT)
 
 #define SEGMENT_E_PORT 4
 #define SEGMENT_E_PIN  4
-#define SEGMENT_E_FUNC SCU_MODE_FUNC0
+#define SEGMENT_E_FUNC HAL_PIN_FUNC0
 #define SEGMENT_E_GPIO SEGMENTS_GPIO
 #define SEGMENT_E_BIT  4
 #define SEGMENT_E_MASK (1 << SEGMENT_E_BIT)
 
 #define SEGMENT_F_PORT 4
 #define SEGMENT_F_PIN  5
-#define SEGMENT_F_FUNC SCU_MODE_FUNC0
+#define SEGMENT_F_FUNC HAL_PIN_FUNC0
 #define SEGMENT_F_GPIO SEGMENTS_GPIO
 #define SEGMENT_F_BIT  5
 #define SEGMENT_F_MASK (1 << SEGMENT_F_BIT)
 
 #define SEGMENT_G_PORT 4
 #define SEGMENT_G_PIN  6
-#define SEGMENT_G_FUNC SCU_MODE_FUNC0
+#define SEGMENT_G_FUNC HAL_PIN_FUNC0
 #define SEGMENT_G_GPIO SEGMENTS_GPIO
 #define SEGMENT_G_BIT  6
 #define SEGMENT_G_MASK (1 << SEGMENT_G_BIT)
@@ -143,7 +143,7 @@ extern "C" {
 
 #define SEGMENT_DOT_PORT 6
 #define SEGMENT_DOT_PIN  8
-#define SEGMENT_DOT_FUNC SCU_MODE_FUNC4
+#define SEGMENT_DOT_FUNC HAL_PIN_FUNC4
 #define SEGMENT_DOT_GPIO 5
 #define SEGMENT_DOT_BIT  16
 #define SEGMENT_DOT_MASK (1 << 7)
@@ -151,63 +151,69 @@ extern "C" {
 // Definiciones de los recursos asociados a las teclas del puncho
 #define KEY_F1_PORT      4
 #define KEY_F1_PIN       8
-#define KEY_F1_FUNC      SCU_MODE_FUNC4
+#define KEY_F1_FUNC      HAL_PIN_FUNC4
 #define KEY_F1_GPIO      5
 #define KEY_F1_BIT       12
 
 #define KEY_F2_PORT      4
 #define KEY_F2_PIN       9
-#define KEY_F2_FUNC      SCU_MODE_FUNC4
+#define KEY_F2_FUNC      HAL_PIN_FUNC4
 #define KEY_F2_GPIO      5
 #define KEY_F2_BIT       13
 
 #define KEY_F3_PORT      4
 #define KEY_F3_PIN       10
-#define KEY_F3_FUNC      SCU_MODE_FUNC4
+#define KEY_F3_FUNC      HAL_PIN_FUNC4
 #define KEY_F3_GPIO      5
 #define KEY_F3_BIT       14
 
 #define KEY_F4_PORT      6
 #define KEY_F4_PIN       7
-#define KEY_F4_FUNC      SCU_MODE_FUNC4
+#define KEY_F4_FUNC      HAL_PIN_FUNC4
 #define KEY_F4_GPIO      5
 #define KEY_F4_BIT       15
 
 #define KEY_ACCEPT_PIN   2
 #define KEY_ACCEPT_PORT  3
-#define KEY_ACCEPT_FUNC  SCU_MODE_FUNC4
+#define KEY_ACCEPT_FUNC  HAL_PIN_FUNC4
 #define KEY_ACCEPT_GPIO  5
 #define KEY_ACCEPT_BIT   9
 
 #define KEY_CANCEL_PORT  3
 #define KEY_CANCEL_PIN   1
-#define KEY_CANCEL_FUNC  SCU_MODE_FUNC4
+#define KEY_CANCEL_FUNC  HAL_PIN_FUNC4
 #define KEY_CANCEL_GPIO  5
 #define KEY_CANCEL_BIT   8
 
+// Todas las teclas están en el mismo puerto GPIO, cualquiera despierta al procesador con la pantalla apagada
+#define KEYS_GPIO        5
+#define KEYS_MASK                                                                                                      \
+    ((1 << KEY_F1_BIT) | (1 << KEY_F2_BIT) | (1 << KEY_F3_BIT) | (1 << KEY_F4_BIT) | (1 << KEY_ACCEPT_BIT) |           \
+     (1 << KEY_CANCEL_BIT))
+
 // Definiciones de los recursos asociados al zumbador
 #define BUZZER_PORT      2
 #define BUZZER_PIN       2
-#define BUZZER_FUNC      SCU_MODE_FUNC4
+#define BUZZER_FUNC      HAL_PIN_FUNC4
 #define BUZZER_GPIO      5
 #define BUZZER_BIT       2
 
 // Led RGB
 #define RGB_RED_PORT     1
 #define RGB_RED_PIN      4
-#define RGB_RED_FUNC     SCU_MODE_FUNC0
+#define RGB_RED_FUNC     HAL_PIN_FUNC0
 #define RGB_RED_GPIO     0
 #define RGB_RED_BIT      11
 
 #define RGB_GREEN_PORT   1
 #define RGB_GREEN_PIN    5
-#define RGB_GREEN_FUNC   SCU_MODE_FUNC0
+#define RGB_GREEN_FUNC   HAL_PIN_FUNC0
 #define RGB_GREEN_GPIO   1
 #define RGB_GREEN_BIT    8
 
 #define RGB_BLUE_PORT    1
 #define RGB_BLUE_PIN     3
-#define RGB_BLUE_FUNC    SCU_MODE_FUNC0
+#define RGB_BLUE_FUNC    HAL_PIN_FUNC0
 #define RGB_BLUE_GPIO    0
 #define RGB_BLUE_BIT     10
 
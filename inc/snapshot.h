@@ -0,0 +1,100 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+#ifndef SNAPSHOT_H_
+#define SNAPSHOT_H_
+
+/** @file snapshot.h
+ ** @brief Declaraciones de la copia de la configuración del reloj en el almacenamiento no volátil - Electrónica 4 2025
+ **
+ ** Cada copia es un registro de 16 bytes con un número de secuencia, la versión del formato y un CRC. Los registros se
+ ** agregan uno detrás de otro en todo el almacenamiento como un buffer circular y nunca se reescribe el último, de modo
+ ** que el desgaste se reparte entre todas las páginas y un corte de alimentación durante una escritura solo puede
+ ** dañar el registro nuevo. Al iniciar se busca el registro más nuevo con una búsqueda binaria de las secuencias, unas
+ ** 10 lecturas de 4 bytes, y solo se calcula su CRC. Si está dañado se usa el anterior.
+ **
+ ** La hora se guarda sin los segundos, así se escribe como máximo un registro por minuto además de los cambios de la
+ ** configuración. Con la EEPROM de la placa cada página se programa unas 11 veces por día.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+//! Versión del formato de los registros, los registros de otra versión se ignoran
+#define SNAPSHOT_VERSION      1
+
+//! La hora guardada es válida
+#define SNAPSHOT_TIME_VALID   (1U << 0)
+
+//! La alarma guardada fue configurada
+#define SNAPSHOT_ALARM_SET    (1U << 1)
+
+//! La alarma guardada está activada
+#define SNAPSHOT_ALARM_ACTIVE (1U << 2)
+
+/* === Public data type declarations =============================================================================== */
+
+//! Configuración del reloj que se conserva al reiniciar
+typedef struct snapshot_s {
+    uint8_t flags;    //!< combinación de SNAPSHOT_TIME_VALID, SNAPSHOT_ALARM_SET y SNAPSHOT_ALARM_ACTIVE
+    uint8_t time[4];  //!< minutos y horas de la hora en BCD, en el orden de los bytes 2 a 5 de clock_time_u
+    uint8_t alarm[4]; //!< minutos y horas de la alarma en BCD, en el orden de los bytes 2 a 5 de clock_time_u
+} snapshot_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Función que busca la copia más nueva en el almacenamiento
+ *
+ * Se debe llamar al iniciar, antes de @ref SnapshotSave(), porque también ubica la posición del próximo registro.
+ *
+ * @param snapshot variable en la que se devuelve la configuración guardada
+ * @return 0 si se encontró una copia válida, -1 si no hay ninguna
+ */
+int SnapshotRestore(snapshot_t * snapshot);
+
+/**
+ * @brief Función que guarda una copia de la configuración si cambió desde la última
+ *
+ * Espera a que termine la escritura, en la placa unos 3 ms.
+ *
+ * @param snapshot configuración a guardar
+ * @return 0 si se escribió, 1 si no cambió y -1 si no se pudo escribir
+ */
+int SnapshotSave(const snapshot_t * snapshot);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SNAPSHOT_H_ */
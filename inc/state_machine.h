@@ -0,0 +1,124 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef STATE_MACHINE_H_
+#define STATE_MACHINE_H_
+
+/** @file state_machine.h
+ ** @brief Declaraciones del despachador de máquinas de estado definidas por tablas - Electrónica 4 2025
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+//! Estado siguiente que indica que la transición no cambia de estado ni vuelve a entrar al estado actual
+#define STATE_MACHINE_NO_CHANGE 0xFF
+
+//! Inicializa una entrada de la tabla de transiciones que ejecuta @p action y pasa al estado @p next
+#define STATE_TRANSITION(action, next) {(action), (next), true}
+
+/* === Public data type declarations =============================================================================== */
+
+/**
+ * @brief Acción que se ejecuta en una transición
+ *
+ * @param next estado siguiente indicado en la tabla
+ * @return estado al que debe pasar la máquina, normalmente @p next
+ */
+typedef uint8_t (*state_action_p)(uint8_t next);
+
+/**
+ * @brief Función que se ejecuta cada vez que se entra a un estado
+ *
+ * @param state estado al que se entra
+ */
+typedef void (*state_enter_p)(uint8_t state);
+
+//! Entrada de la tabla de transiciones para un par estado, evento
+typedef struct state_transition_s {
+    state_action_p action; //!< acción a ejecutar, puede ser NULL
+    uint8_t next;          //!< estado siguiente o @ref STATE_MACHINE_NO_CHANGE
+    bool handled;          //!< indica si el evento se atiende en el estado, las entradas vacías se ignoran
+} state_transition_t;
+
+//! Descripción constante de una máquina de estados
+typedef struct state_machine_table_s {
+    const state_transition_t * transitions; //!< matriz de estados por eventos guardada por filas
+    uint8_t states;                         //!< cantidad de estados, filas de la matriz
+    uint8_t events;                         //!< cantidad de eventos, columnas de la matriz
+    state_enter_p Enter;                    //!< función que se ejecuta al entrar a un estado, puede ser NULL
+} state_machine_table_t;
+
+//! Máquina de estados en ejecución
+typedef struct state_machine_s {
+    const state_machine_table_t * table; //!< tabla que describe la máquina
+    uint8_t current;                     //!< estado actual
+} state_machine_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Función para iniciar una máquina de estados y entrar al estado inicial
+ *
+ * @param machine máquina a iniciar
+ * @param table tabla que describe la máquina, debe ser constante
+ * @param initial estado inicial
+ * @return devuelve -1 si el estado inicial no existe en la tabla, 0 en caso contrario
+ */
+int StateMachineInit(state_machine_t * machine, const state_machine_table_t * table, uint8_t initial);
+
+/**
+ * @brief Función para procesar un evento
+ *
+ * Busca la transición del estado actual para el evento con un único acceso a la tabla, ejecuta su acción y, si el
+ * estado siguiente no es @ref STATE_MACHINE_NO_CHANGE, entra a ese estado aunque sea el mismo en el que estaba.
+ *
+ * @param machine máquina de estados
+ * @param event evento a procesar
+ * @return devuelve true si el evento se atendió en el estado actual
+ */
+bool StateMachineDispatch(state_machine_t * machine, uint8_t event);
+
+/**
+ * @brief Función para obtener el estado actual
+ *
+ * @param machine máquina de estados
+ * @return estado actual
+ */
+uint8_t StateMachineGetState(const state_machine_t * machine);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STATE_MACHINE_H_ */
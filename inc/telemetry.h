@@ -0,0 +1,165 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+#ifndef TELEMETRY_H_
+#define TELEMETRY_H_
+
+/** @file telemetry.h
+ ** @brief Declaraciones de las tramas binarias de telemetría - Electrónica 4 2025
+ **
+ ** Cada trama lleva un tipo, un número de secuencia de 8 bits, el contenido y el CRC-16 de crc.h de los bytes
+ ** anteriores. La trama se codifica con COBS, que quita todos los bytes en cero, y se envía entre dos bytes en cero.
+ ** Así se puede mezclar con el texto de la consola en el mismo puerto serie: el receptor separa los bytes en cero y
+ ** descarta los tramos que no se decodifican o cuyo CRC no coincide, como el texto entre dos tramas.
+ **
+ ** El contenido son las mismas estructuras que usa el firmware, copiadas sin convertir a texto, por lo que el
+ ** decodificador debe compartir este archivo y el orden de los bytes, little endian en el LPC43xx y en el host. Las
+ ** estructuras solo tienen campos de ancho fijo, y los de 64 bits de profiler.h quedan alineados a 8 bytes tanto en
+ ** el LPC43xx como en el host de 64 bits, así el relleno del compilador es el mismo en los dos.
+ **
+ ** La deriva compara los ticks contados con el contador de ciclos, que en la placa usa el mismo reloj que la
+ ** interrupción periódica, por lo que solo cambia si se pierden o se atrasan interrupciones. En el simulador el
+ ** contador sigue al tiempo simulado y la deriva queda en cero.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "event_trace.h"
+#include "profiler.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+//! Tamaño máximo del contenido de una trama
+#define TELEMETRY_MAX_PAYLOAD 240
+
+//! Bytes de la trama además del contenido: el tipo, la secuencia y el CRC
+#define TELEMETRY_OVERHEAD    4
+
+/**
+ * @brief Bytes que ocupa una trama codificada con un contenido de un tamaño, incluyendo los dos bytes en cero
+ *
+ * COBS agrega un byte al principio y otro cada 254 bytes sin ceros.
+ */
+#define TELEMETRY_FRAME_SIZE(payload) ((payload) + TELEMETRY_OVERHEAD + ((payload) + TELEMETRY_OVERHEAD) / 254 + 3)
+
+//! Bytes que ocupa la trama codificada más grande
+#define TELEMETRY_MAX_FRAME   TELEMETRY_FRAME_SIZE(TELEMETRY_MAX_PAYLOAD)
+
+//! Cantidad de botones que se cuentan en el estado
+#define TELEMETRY_BUTTONS     6
+
+//! Largo del nombre de una región medida, se recorta si es más largo
+#define TELEMETRY_NAME_SIZE   12
+
+//! Cantidad máxima de eventos de una trama
+#define TELEMETRY_MAX_EVENTS  (TELEMETRY_MAX_PAYLOAD / sizeof(telemetry_event_t))
+
+/* === Public data type declarations =============================================================================== */
+
+//! Tipos de trama
+typedef enum telemetry_type_e {
+    TELEMETRY_STATUS = 1, //!< contenido @ref telemetry_status_t
+    TELEMETRY_REGION,     //!< contenido @ref telemetry_region_t
+    TELEMETRY_EVENTS,     //!< contenido hasta @ref TELEMETRY_MAX_EVENTS registros @ref telemetry_event_t
+} telemetry_type_e;
+
+//! Estado general de la placa
+typedef struct telemetry_status_s {
+    uint32_t uptime;                     //!< segundos desde que se inició la aplicación
+    int32_t tick_drift;                  //!< cuentas de HalCycleCounter que adelantó respecto de los ticks
+    uint32_t tick_period;                //!< periodo de la interrupción periódica, en cuentas de HalTimestamp
+    uint32_t tick_worst;                 //!< máximo tiempo desde el disparo de la interrupción al final de su rutina
+    uint32_t tick_overruns;              //!< rutinas que terminaron después del disparo de la siguiente
+    uint32_t loop_worst;                 //!< máximo atraso de la revisión de las entradas, en milisegundos
+    uint32_t loop_skipped;               //!< periodos de la revisión de las entradas que no se ejecutaron
+    uint32_t loop_wakeups;               //!< veces que el lazo principal despertó al procesador
+    uint32_t loop_busy;                  //!< ciclo de trabajo del procesador, en millonésimos
+    uint32_t alarm_rings;                //!< veces que empezó a sonar la alarma
+    uint32_t alarm_snoozes;              //!< veces que se pospuso la alarma
+    uint32_t frames_skipped;             //!< tramas que no se enviaron porque el buffer de envío estaba lleno
+    uint32_t buttons[TELEMETRY_BUTTONS]; //!< pulsaciones de cada botón, en el orden de los eventos de la aplicación
+} telemetry_status_t;
+
+//! Mediciones de una región de profiler.h
+typedef struct telemetry_region_s {
+    char name[TELEMETRY_NAME_SIZE]; //!< nombre de la región, termina en cero si es más corto
+    uint32_t count;                 //!< cantidad de ejecuciones
+    profiler_stats_t duration;      //!< duración de cada ejecución
+    profiler_stats_t latency;       //!< demora entre el pedido de la interrupción y la entrada a la región
+} telemetry_region_t;
+
+//! Registro de event_trace.h con su número
+typedef struct telemetry_event_s {
+    uint32_t sequence;           //!< número del registro
+    event_trace_record_t record; //!< registro
+} telemetry_event_t;
+
+//! Trama decodificada
+typedef struct telemetry_frame_s {
+    uint8_t type;                             //!< tipo de trama, uno de @ref telemetry_type_e
+    uint8_t sequence;                         //!< número de trama, permite detectar las que se perdieron
+    uint16_t size;                            //!< bytes del contenido
+    union {
+        uint8_t bytes[TELEMETRY_MAX_PAYLOAD]; //!< contenido
+        uint64_t align;                       //!< alinea el contenido para leerlo como una de las estructuras
+    } payload;                                //!< contenido de la trama
+} telemetry_frame_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Función que arma una trama codificada, con los bytes en cero del principio y del final
+ *
+ * @param type tipo de trama
+ * @param sequence número de trama
+ * @param payload contenido
+ * @param size bytes del contenido, como máximo @ref TELEMETRY_MAX_PAYLOAD
+ * @param frame trama resultante, debe tener lugar para @ref TELEMETRY_FRAME_SIZE(size) bytes
+ * @return bytes de la trama, 0 si el contenido es demasiado grande
+ */
+size_t TelemetryEncode(uint8_t type, uint8_t sequence, const void * payload, size_t size, uint8_t * frame);
+
+/**
+ * @brief Función que decodifica los bytes recibidos entre dos bytes en cero
+ *
+ * @param data bytes recibidos, sin los bytes en cero que los delimitan
+ * @param size cantidad de bytes
+ * @param frame trama decodificada
+ * @return 0 si es una trama válida, -1 si no se puede decodificar o el CRC no coincide
+ */
+int TelemetryDecode(const uint8_t * data, size_t size, telemetry_frame_t * frame);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TELEMETRY_H_ */
@@ -0,0 +1,120 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+#ifndef TIME_SYNC_H_
+#define TIME_SYNC_H_
+
+/** @file time_sync.h
+ ** @brief Declaraciones de la sincronización de la hora con un servidor por el puerto serie - Electrónica 4 2025
+ **
+ ** El intercambio es el de NTP: la placa envía un pedido numerado y guarda la hora t1 de su reloj, el servidor responde
+ ** con la hora t2 en la que recibió el pedido y los milisegundos que tardó en responder, t3 - t2, y la placa anota la
+ ** hora t4 en la que llega la respuesta. El desplazamiento del reloj de la placa respecto del servidor se estima como
+ ** ((t2 - t1) + (t3 - t4)) / 2 y la demora de ida y vuelta como (t4 - t1) - (t3 - t2). La estimación supone que la ida
+ ** y la vuelta tardan lo mismo, así que el error es como máximo la mitad de la demora y los intercambios con demoras
+ ** mayores a @ref TIME_SYNC_MAX_DELAY se descartan.
+ **
+ ** Por la consola la placa envía `sync <número>` y el servidor responde con la orden
+ ** `sync <número> <segundos> <milisegundos> <demora>`, con t2 en segundos UTC desde 1970 y milisegundos.
+ **
+ ** El módulo solo hace las cuentas, la aplicación lee el reloj y aplica la corrección con ClockAdjustTime() de clock.h.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#ifndef TIME_SYNC_MAX_DELAY
+//! Demora máxima de ida y vuelta en milisegundos de un intercambio que se usa para corregir el reloj
+#define TIME_SYNC_MAX_DELAY 500
+#endif
+
+/* === Public data type declarations =============================================================================== */
+
+//! Resultado de un intercambio
+typedef struct time_sync_sample_s {
+    int64_t offset; //!< milisegundos que hay que sumar al reloj de la placa para tener la hora del servidor
+    int64_t delay;  //!< milisegundos de ida y vuelta sin contar la demora del servidor
+} time_sync_sample_t;
+
+//! Estado de la sincronización
+typedef struct time_sync_s {
+    int64_t sent;            //!< hora t1 del último pedido, en milisegundos desde 1970
+    uint8_t sequence;        //!< número del último pedido
+    bool pending;            //!< indica si el último pedido espera una respuesta
+    uint32_t requests;       //!< pedidos enviados
+    uint32_t accepted;       //!< respuestas usadas para corregir el reloj
+    uint32_t rejected;       //!< respuestas descartadas por el número o por la demora
+    time_sync_sample_t last; //!< último intercambio aceptado
+} time_sync_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Función que inicializa el estado de la sincronización
+ *
+ * @param sync estado de la sincronización
+ */
+void TimeSyncInit(time_sync_t * sync);
+
+/**
+ * @brief Función que prepara un pedido nuevo, una respuesta a un pedido anterior ya no se acepta
+ *
+ * @param sync estado de la sincronización
+ * @param now hora t1 del reloj de la placa, en milisegundos desde 1970
+ * @return número del pedido que se envía al servidor
+ */
+uint8_t TimeSyncRequest(time_sync_t * sync, int64_t now);
+
+/**
+ * @brief Función que calcula el desplazamiento y la demora con la respuesta del servidor
+ *
+ * @param sync estado de la sincronización
+ * @param sequence número del pedido que responde el servidor
+ * @param received hora t2 del servidor, en milisegundos desde 1970
+ * @param hold milisegundos entre la recepción del pedido y el envío de la respuesta en el servidor
+ * @param now hora t4 del reloj de la placa, en milisegundos desde 1970
+ * @param sample resultado del intercambio, se completa también si se descarta por la demora
+ * @return int devuelve:
+ *  \li 0 si el intercambio se puede usar para corregir el reloj
+ *  \li -1 si no hay un pedido pendiente con ese número
+ *  \li -2 si la demora es negativa o mayor a @ref TIME_SYNC_MAX_DELAY
+ */
+int TimeSyncResponse(time_sync_t * sync, uint32_t sequence, int64_t received, uint32_t hold, int64_t now,
+                     time_sync_sample_t * sample);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TIME_SYNC_H_ */
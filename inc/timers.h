@@ -0,0 +1,227 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+#ifndef TIMERS_H_
+#define TIMERS_H_
+
+/** @file timers.h
+ ** @brief Declaraciones de los cronómetros y temporizadores que comparten el tick del reloj - Electrónica 4 2025
+ **
+ ** Los cronómetros y los temporizadores se toman de un pool estático y se miden con una única base de tiempo en
+ ** milisegundos que avanza @ref TimersTick(), llamada desde la misma interrupción que @ref ClockNewTick(). Un
+ ** cronómetro guarda el instante en el que arrancó, por lo que avanzar el tiempo no lo modifica. Los temporizadores
+ ** guardan el instante en el que terminan y el pool recuerda el más cercano, así cada tick solo hace una comparación y
+ ** revisa todos los temporizadores en una sola pasada cuando alguno termina.
+ **
+ ** Los tiempos se cuentan con 32 bits, un cronómetro mide hasta 49 días y un temporizador dura como máximo
+ ** @ref TIMERS_MAX_DURATION.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#ifndef TIMERS_STOPWATCHES
+//! Cantidad de cronómetros del pool
+#define TIMERS_STOPWATCHES  4
+#endif
+
+#ifndef TIMERS_COUNTDOWNS
+//! Cantidad de temporizadores del pool
+#define TIMERS_COUNTDOWNS   4
+#endif
+
+//! Duración máxima de un temporizador en milisegundos
+#define TIMERS_MAX_DURATION ((uint32_t)INT32_MAX)
+
+/* === Public data type declarations =============================================================================== */
+
+//! Referencia a un cronómetro
+typedef struct stopwatch_s * stopwatch_p;
+
+//! Referencia a un temporizador
+typedef struct countdown_s * countdown_p;
+
+/**
+ * @brief Puntero a la función que se llama cuando termina un temporizador
+ *
+ * Se llama desde @ref TimersTick(), por lo que se ejecuta en la interrupción periódica y debe ser breve. Puede volver
+ * a arrancar el mismo temporizador para repetirlo.
+ *
+ * @param countdown temporizador que terminó
+ * @param context dato indicado al crear el temporizador
+ */
+typedef void (*countdown_expired_p)(countdown_p countdown, void * context);
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Función que libera todos los cronómetros y temporizadores y pone en cero la base de tiempo
+ *
+ * Se debe llamar antes de usar el pool y no se debe llamar mientras la interrupción periódica lo usa.
+ */
+void TimersInit(void);
+
+/**
+ * @brief Función que avanza la base de tiempo y llama a los temporizadores que terminaron
+ *
+ * @param milliseconds milisegundos que pasaron desde la llamada anterior
+ */
+void TimersTick(uint32_t milliseconds);
+
+/**
+ * @brief Función que devuelve la base de tiempo
+ *
+ * @return milisegundos desde @ref TimersInit()
+ */
+uint32_t TimersNow(void);
+
+/**
+ * @brief Función para tomar un cronómetro del pool, detenido y en cero
+ *
+ * @return referencia al cronómetro, NULL si no hay cronómetros libres
+ */
+stopwatch_p StopwatchCreate(void);
+
+/**
+ * @brief Función para devolver un cronómetro al pool
+ *
+ * @param stopwatch referencia al cronómetro
+ */
+void StopwatchDestroy(stopwatch_p stopwatch);
+
+/**
+ * @brief Función para arrancar un cronómetro detenido, sigue sumando al tiempo que ya tenía
+ *
+ * @param stopwatch referencia al cronómetro
+ */
+void StopwatchStart(stopwatch_p stopwatch);
+
+/**
+ * @brief Función para detener un cronómetro sin perder el tiempo medido
+ *
+ * @param stopwatch referencia al cronómetro
+ */
+void StopwatchStop(stopwatch_p stopwatch);
+
+/**
+ * @brief Función para poner en cero un cronómetro y sus vueltas, no cambia si está andando o detenido
+ *
+ * @param stopwatch referencia al cronómetro
+ */
+void StopwatchReset(stopwatch_p stopwatch);
+
+/**
+ * @brief Función que devuelve el tiempo parcial del cronómetro
+ *
+ * @param stopwatch referencia al cronómetro
+ * @return milisegundos medidos desde que se puso en cero
+ */
+uint32_t StopwatchElapsed(stopwatch_p stopwatch);
+
+/**
+ * @brief Función que marca una vuelta y devuelve su duración
+ *
+ * @param stopwatch referencia al cronómetro
+ * @return milisegundos medidos desde la vuelta anterior o desde que se puso en cero
+ */
+uint32_t StopwatchLap(stopwatch_p stopwatch);
+
+/**
+ * @brief Función para saber si un cronómetro está andando
+ *
+ * @param stopwatch referencia al cronómetro
+ * @return true si está andando
+ */
+bool StopwatchIsRunning(stopwatch_p stopwatch);
+
+/**
+ * @brief Función para tomar un temporizador del pool, detenido
+ *
+ * @param expired función que se llama al terminar, puede ser NULL
+ * @param context dato que recibe la función
+ * @return referencia al temporizador, NULL si no hay temporizadores libres
+ */
+countdown_p CountdownCreate(countdown_expired_p expired, void * context);
+
+/**
+ * @brief Función para devolver un temporizador al pool, si estaba andando no se llama a su función
+ *
+ * @param countdown referencia al temporizador
+ */
+void CountdownDestroy(countdown_p countdown);
+
+/**
+ * @brief Función para arrancar un temporizador, si estaba andando vuelve a empezar
+ *
+ * @param countdown referencia al temporizador
+ * @param milliseconds duración, como máximo @ref TIMERS_MAX_DURATION
+ * @return devuelve -1 si la duración es 0 o demasiado larga, 0 en caso contrario
+ */
+int CountdownStart(countdown_p countdown, uint32_t milliseconds);
+
+/**
+ * @brief Función para detener un temporizador sin llamar a su función, guarda el tiempo que le falta
+ *
+ * @param countdown referencia al temporizador
+ */
+void CountdownStop(countdown_p countdown);
+
+/**
+ * @brief Función para que un temporizador detenido siga con el tiempo que le faltaba
+ *
+ * @param countdown referencia al temporizador
+ */
+void CountdownResume(countdown_p countdown);
+
+/**
+ * @brief Función que devuelve el tiempo que le falta a un temporizador
+ *
+ * @param countdown referencia al temporizador
+ * @return milisegundos que faltan, 0 si ya terminó
+ */
+uint32_t CountdownRemaining(countdown_p countdown);
+
+/**
+ * @brief Función para saber si un temporizador está andando
+ *
+ * @param countdown referencia al temporizador
+ * @return true si está andando
+ */
+bool CountdownIsRunning(countdown_p countdown);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TIMERS_H_ */
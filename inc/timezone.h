@@ -0,0 +1,139 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+#ifndef TIMEZONE_H_
+#define TIMEZONE_H_
+
+/** @file timezone.h
+ ** @brief Declaraciones de las zonas horarias con horario de verano - Electrónica 4 2025
+ **
+ ** Una zona se describe con el formato de la variable TZ de POSIX, por ejemplo `ART3`, `CET-1CEST,M3.5.0,M10.5.0/3` o
+ ** `<-03>3`. El desplazamiento se escribe al revés que en la hora local: `CET-1` es una hora más que UTC. Las reglas de
+ ** inicio y fin del horario de verano pueden ser `Mm.w.d` (día d de la semana w del mes m, la semana 5 es la última),
+ ** `Jn` (día n del año sin contar el 29 de febrero) o `n` (día n del año desde 0), seguidas de `/hora`, 02:00 si no se
+ ** indica.
+ **
+ ** Las reglas se evalúan una sola vez al compilar la zona para algunos años, en una tabla ordenada de instantes UTC en
+ ** los que cambia el desplazamiento. Quien usa la tabla guarda el instante del próximo cambio y solo vuelve a
+ ** consultarla cuando lo alcanza, por lo que pasar de UTC a la hora local cuesta una comparación por segundo.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#ifndef TIMEZONE_YEARS
+//! Años que cubre la tabla de cambios de una zona compilada
+#define TIMEZONE_YEARS 2
+#endif
+
+//! Instante que indica que no hay un próximo cambio
+#define TIMEZONE_NEVER INT64_MAX
+
+/* === Public data type declarations =============================================================================== */
+
+//! Forma en que una regla indica el día del cambio
+typedef enum timezone_rule_kind_e {
+    TIMEZONE_RULE_MONTH_WEEK_DAY, //!< Mm.w.d
+    TIMEZONE_RULE_JULIAN,         //!< Jn, de 1 a 365 sin contar el 29 de febrero
+    TIMEZONE_RULE_DAY_OF_YEAR,    //!< n, de 0 a 365
+} timezone_rule_kind_e;
+
+//! Regla de inicio o de fin del horario de verano
+typedef struct timezone_rule_s {
+    uint8_t kind;    //!< forma de la regla, uno de timezone_rule_kind_e
+    uint8_t month;   //!< mes, de 1 a 12
+    uint8_t week;    //!< semana del mes, de 1 a 5
+    uint8_t weekday; //!< día de la semana, 0 es domingo
+    uint16_t day;    //!< día del año de las reglas Jn y n
+    int32_t time;    //!< hora local del cambio en segundos, puede ser negativa o mayor a un día
+} timezone_rule_t;
+
+//! Instante en que cambia el desplazamiento de la hora local
+typedef struct timezone_transition_s {
+    int64_t at;     //!< segundos UTC desde 1970
+    int32_t offset; //!< segundos que se suman a UTC desde ese instante
+} timezone_transition_t;
+
+//! Zona horaria con sus reglas y la tabla de cambios compilada
+typedef struct timezone_s {
+    int32_t standard;                                      //!< desplazamiento del horario normal, sumado a UTC
+    int32_t daylight;                                      //!< desplazamiento del horario de verano, sumado a UTC
+    bool has_daylight;                                     //!< indica si la zona tiene horario de verano
+    timezone_rule_t start;                                 //!< inicio del horario de verano
+    timezone_rule_t end;                                   //!< fin del horario de verano
+    int16_t year;                                          //!< primer año de la tabla
+    uint8_t count;                                         //!< cantidad de cambios en la tabla
+    int64_t valid_until;                                   //!< instante UTC en el que termina la tabla
+    timezone_transition_t transitions[2 * TIMEZONE_YEARS]; //!< cambios ordenados por instante
+} timezone_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Función que lee las reglas de una zona escritas en el formato de la variable TZ de POSIX
+ *
+ * La zona queda sin compilar, con una tabla vacía hasta llamar a @ref TimezoneCompile().
+ *
+ * @param zone zona a completar
+ * @param text reglas de la zona
+ * @return 0 si las reglas son válidas, -1 en caso contrario
+ */
+int TimezoneParse(timezone_t * zone, const char * text);
+
+/**
+ * @brief Función que evalúa las reglas de la zona y arma la tabla de cambios desde el inicio de un año
+ *
+ * @param zone zona leída con @ref TimezoneParse()
+ * @param year primer año que cubre la tabla
+ */
+void TimezoneCompile(timezone_t * zone, int16_t year);
+
+/**
+ * @brief Función que devuelve el desplazamiento de la hora local en un instante
+ *
+ * Después del último cambio de la tabla devuelve su desplazamiento y como próximo cambio el fin de la tabla, de modo
+ * que quien la usa vuelve a consultarla después de compilar la zona de nuevo.
+ *
+ * @param zone zona compilada
+ * @param utc segundos UTC desde 1970
+ * @param next variable en la que se devuelve el instante del próximo cambio, @ref TIMEZONE_NEVER si no hay ninguno
+ * @return segundos que se suman a UTC para obtener la hora local
+ */
+int32_t TimezoneLookup(const timezone_t * zone, int64_t utc, int64_t * next);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TIMEZONE_H_ */
@@ -0,0 +1,136 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+#ifndef WORLD_CLOCK_H_
+#define WORLD_CLOCK_H_
+
+/** @file world_clock.h
+ ** @brief Declaraciones de las vistas de la hora de otras zonas sobre un mismo reloj - Electrónica 4 2025
+ **
+ ** Una vista solo guarda un desplazamiento respecto de UTC y una referencia al reloj principal, que es el único que
+ ** cuenta el tiempo en la interrupción periódica. La hora y la fecha de la vista se calculan a partir de los segundos
+ ** UTC del reloj recién cuando se consultan, por ejemplo al mostrarla en el display, y se guardan para que las
+ ** consultas siguientes dentro del mismo segundo no vuelvan a convertirlas. La fecha solo se vuelve a convertir cuando
+ ** cambia el día de la vista.
+ **
+ ** Las vistas se toman de un pool estático y se consultan desde el mismo contexto que modifica el reloj, ya que leen
+ ** sus segundos UTC de 64 bits.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "calendar.h"
+#include "clock.h"
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#ifndef WORLD_CLOCK_VIEWS
+//! Cantidad de vistas del pool
+#define WORLD_CLOCK_VIEWS      4
+#endif
+
+//! Desplazamiento máximo de una vista respecto de UTC en segundos, en ambos sentidos
+#define WORLD_CLOCK_MAX_OFFSET (CALENDAR_SECONDS_PER_DAY - 1)
+
+/* === Public data type declarations =============================================================================== */
+
+//! Referencia a una vista de la hora de otra zona
+typedef struct world_clock_s * world_clock_p;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Función que libera todas las vistas
+ *
+ * Se debe llamar antes de usar el pool.
+ */
+void WorldClockInit(void);
+
+/**
+ * @brief Función para tomar una vista del pool
+ *
+ * @param clock reloj principal del que se toma la hora
+ * @param utc_offset segundos que se suman a la hora UTC del reloj, como máximo @ref WORLD_CLOCK_MAX_OFFSET
+ * @return referencia a la vista, NULL si no hay vistas libres o los argumentos no son válidos
+ */
+world_clock_p WorldClockCreate(clock_p clock, int32_t utc_offset);
+
+/**
+ * @brief Función para devolver una vista al pool
+ *
+ * @param view referencia a la vista
+ */
+void WorldClockDestroy(world_clock_p view);
+
+/**
+ * @brief Función para cambiar el desplazamiento de una vista
+ *
+ * @param view referencia a la vista
+ * @param utc_offset segundos que se suman a la hora UTC del reloj, como máximo @ref WORLD_CLOCK_MAX_OFFSET
+ * @return devuelve 1 si el desplazamiento es válido, 0 en caso contrario
+ */
+int WorldClockSetOffset(world_clock_p view, int32_t utc_offset);
+
+/**
+ * @brief Función que devuelve el desplazamiento de una vista
+ *
+ * @param view referencia a la vista
+ * @return segundos que se suman a la hora UTC del reloj
+ */
+int32_t WorldClockGetOffset(world_clock_p view);
+
+/**
+ * @brief Función para obtener la hora de la vista
+ *
+ * @param view referencia a la vista
+ * @param current_time variable en la que devuelve la hora de la vista
+ * @return devuelve:
+ *  \li 1 si el reloj principal se puso en hora valida
+ *  \li 0 si hay que poner en hora el reloj principal
+ */
+int WorldClockGetTime(world_clock_p view, clock_time_u * current_time);
+
+/**
+ * @brief Función para obtener la fecha de la vista, que puede ser distinta a la del reloj principal
+ *
+ * @param view referencia a la vista
+ * @param current_date variable en la que devuelve la fecha de la vista
+ * @return devuelve:
+ *  \li 1 si el reloj principal se puso en hora valida
+ *  \li 0 si hay que poner en hora el reloj principal
+ */
+int WorldClockGetDate(world_clock_p view, calendar_date_t * current_date);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* WORLD_CLOCK_H_ */
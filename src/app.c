@@ -0,0 +1,1186 @@
+/* Copyright 2022, Laboratorio de Microprocesadores
+ * Facultad de Ciencias Exactas y Tecnología
+ * Universidad Nacional de Tucuman
+ * http://www.microprocesadores.unt.edu.ar/
+ * Copyright 2022, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \brief Aplicación del reloj despertador, independiente del lazo principal y de la plataforma
+ **
+ ** \addtogroup samples Sample projects
+ ** \brief Sample projects to use as a starting point
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "app.h"
+#include "shield.h"
+#include "clock.h"
+#include "output_pattern.h"
+#include "state_machine.h"
+#include "scheduler.h"
+#include "hal.h"
+#include "profiler.h"
+#include "event_trace.h"
+#include "snapshot.h"
+#include "timezone.h"
+#include "timers.h"
+#include "console.h"
+#include "app_console.h"
+#include "app_suspend.h"
+#include "app_sync.h"
+#include "app_telemetry.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "edusia_config.h" // solo para usar los leds
+/* === Macros definitions ====================================================================== */
+
+#ifndef TIME_TO_HOLD_TO_CHANGE_STATE_MS
+#define TIME_TO_HOLD_TO_CHANGE_STATE_MS 300
+#endif
+
+//! Periodo en milisegundos con el que se revisan los botones
+#define INPUTS_POLL_PERIOD_MS 15
+
+#ifndef APP_TICKS_PER_SECOND
+//! Frecuencia por defecto de la interrupción periódica
+#define APP_TICKS_PER_SECOND 1000
+#endif
+
+#ifndef APP_SECONDS_SNOOZED
+//! Segundos que se pospone la alarma por defecto
+#define APP_SECONDS_SNOOZED 300
+#endif
+
+#ifndef APP_ALARM_RING_TIMEOUT
+//! Segundos que suena la alarma por defecto antes de apagarse sola
+#define APP_ALARM_RING_TIMEOUT 600
+#endif
+
+//! Periodo en milisegundos con el que se atiende la consola, a 115200 bps llegan unos 115 bytes por periodo
+#define CONSOLE_POLL_PERIOD_MS 10
+
+#ifndef APP_TELEMETRY_PERIOD
+//! Segundos por defecto entre envíos de la telemetría, 0 no la envía hasta pedirla con la orden telemetry
+#define APP_TELEMETRY_PERIOD 0
+#endif
+
+//! Periodo en milisegundos de la tarea de telemetría, que acumula la deriva de los ticks en cada llamada
+#define TELEMETRY_TASK_PERIOD_MS 1000
+
+#ifndef APP_SYNC_PERIOD
+//! Segundos por defecto entre pedidos de la hora al servidor, 0 solo los envía la orden sync
+#define APP_SYNC_PERIOD 0
+#endif
+
+//! Periodo en milisegundos de la tarea que envía los pedidos de la hora al servidor
+#define SYNC_TASK_PERIOD_MS 1000
+
+#ifndef APP_DISPLAY_TIMEOUT
+//! Segundos por defecto sin usar las teclas hasta apagar la pantalla, 0 no la apaga hasta pedirlo con la orden display
+#define APP_DISPLAY_TIMEOUT 0
+#endif
+
+//! Valor de la última hora dibujada que obliga a volver a escribir el display
+#define DISPLAY_REDRAW UINT32_MAX
+
+/* === Private data type declarations ========================================================== */
+
+//! Representa los estados en lo que puede estar el reloj
+typedef enum {
+    valid_time,
+    invalid_time,
+    adjust_time_hours,
+    adjust_time_minutes,
+    adjust_alarm_hours,
+    adjust_alarm_minutes,
+    STATES_COUNT,
+} states_e;
+
+//! Representa los eventos que atiende la MEF del reloj
+typedef enum {
+    EVENT_SET_TIME,       //!< se mantuvo presionado el botón para cambiar la hora
+    EVENT_SET_ALARM,      //!< se mantuvo presionado el botón para cambiar la alarma
+    EVENT_INCREMENT,      //!< se presionó el botón de incrementar
+    EVENT_DECREMENT,      //!< se presionó el botón de decrementar
+    EVENT_ACCEPT,         //!< se presionó el botón de aceptar
+    EVENT_CANCEL,         //!< se presionó el botón de cancelar
+    EVENT_TIMEOUT,        //!< pasó el tiempo máximo sin apretar un botón
+    EVENT_ALARM_CHANGED,  //!< la alarma empezó o dejó de sonar
+    EVENT_REMOTE_CHANGED, //!< se cambió la hora o la alarma desde la consola
+    EVENTS_COUNT,
+    EVENT_NONE = EVENTS_COUNT,
+} events_e;
+
+//! Estado de un punto del display en un perfil
+typedef enum {
+    DOT_KEEP,           //!< no se modifica el punto
+    DOT_OFF,            //!< punto apagado
+    DOT_ON,             //!< punto prendido, parpadea si se indica una cantidad de llamadas
+    DOT_IF_RINGING,     //!< punto prendido solo si la alarma esta sonando
+    DOT_IF_ALARM_ACTIVE //!< punto prendido solo si la alarma esta activada
+} dot_mode_e;
+
+//! Contenido que se muestra en el display en cada estado
+typedef enum {
+    CONTENT_CLOCK_TIME,  //!< hora actual del reloj, la escribe el trabajo diferido de TickHandler
+    CONTENT_EDITED_TIME, //!< hora que se esta ajustando, la escribe el lazo principal
+} display_content_e;
+
+//! Configuración del display que se aplica al entrar a un estado
+typedef struct display_profile_s {
+    display_content_e content; //!< que hora se muestra
+    uint8_t blink_from;        //!< primer dígito que parpadea
+    uint8_t blink_to;          //!< último dígito que parpadea
+    uint16_t blink_calls;      //!< velocidad de parpadeo de los dígitos, 0 no parpadean
+    struct {
+        dot_mode_e mode; //!< estado del punto
+        uint16_t calls;  //!< velocidad de parpadeo del punto, 0 no parpadea
+    } dots[4];           //!< configuración de cada punto
+} display_profile_t;
+
+//! Struct que contiene los parametros de la funcion KeepedHoldButton(check_button_hold_p)
+typedef struct check_button_hold_s {
+    digital_input_p button; //!< botón
+    uint32_t counter;       //!< contador propio del boton
+    uint32_t time_to_hold;  //!< tiempo que se desea que se controle el boton.
+} * check_button_hold_p;
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Función que inicia la interrupción periódica y el trabajo diferido
+ *
+ * @param ticks_per_second frecuencia de la interrupción periódica
+ */
+static void ConfigureSystick(uint16_t ticks_per_second);
+
+/**
+ * @brief Tarea periódica que revisa los botones y procesa los eventos de la MEF del reloj
+ *
+ */
+static void PollInputs(void);
+
+/**
+ * @brief Función que recupera la hora y la alarma guardadas en el almacenamiento no volátil
+ *
+ * @return true si se recuperó una hora válida
+ */
+static bool RestoreSettings(void);
+
+/**
+ * @brief Función que guarda la hora y la alarma en el almacenamiento no volátil si cambiaron
+ *
+ */
+static void SaveSettings(void);
+
+/**
+ * @brief Función que vuelve a compilar la tabla de cambios de la zona horaria al cambiar el año del reloj
+ *
+ * Se llama desde el lazo principal, así la interrupción periódica nunca evalúa las reglas de la zona.
+ */
+static void UpdateTimezone(void);
+
+/**
+ * @brief Función programada en el reloj al empezar cada minuto, pide guardar la hora
+ *
+ * @param source reloj que llama a la función
+ * @param context no se usa
+ */
+static void MinuteChanged(clock_p source, void * context);
+
+/**
+ * @brief Función que marca que la consola cambió el reloj, para que la MEF lo muestre y se guarden los ajustes
+ *
+ */
+static void RemoteChanged(void);
+
+/**
+ * @brief Función que devuelve a la telemetría los datos de la última interrupción periódica
+ *
+ * @param fired valor de HalCycleCounter en el disparo de la interrupción
+ * @param now milisegundos contados por la interrupción
+ */
+static void LastTick(uint32_t * fired, uint32_t * now);
+
+/**
+ * @brief Función que se llama al apagar la pantalla, la deriva se vuelve a medir desde que se prende
+ *
+ */
+static void DisplaySuspended(void);
+
+/**
+ * @brief Función que se llama al prender la pantalla, dibuja la hora antes del primer tick y pide guardar la hora
+ *
+ */
+static void DisplayResumed(void);
+
+/**
+ * @brief Funciones pertenecientes a la Interface utilizada por el planificador
+ *
+ */
+static uint32_t SchedulerNow(void);
+static void SchedulerSleep(uint32_t now);
+static uint32_t SchedulerCycles(void);
+static void SchedulerMissed(scheduler_task_p task, uint32_t lateness);
+
+/**
+ * @brief Función que registra un plazo no cumplido y llama a la función indicada en la configuración
+ *
+ * @param source trabajo atrasado
+ * @param lateness atraso
+ */
+static void DeadlineMissed(app_deadline_e source, uint32_t lateness);
+
+/**
+ * @brief Función que revisa al final de la interrupción periódica si terminó antes del siguiente tick
+ *
+ * @param fired valor de HalTimestamp cuando se disparó la interrupción
+ */
+static void CheckTickDeadline(uint32_t fired);
+
+/**
+ * @brief Función que actualiza el contenido del display con la hora del reloj
+ *
+ * Es el trabajo que TickHandler difiere a DeferredHandler, salvo que no se defina USE_DEFERRED_DISPLAY_UPDATE.
+ *
+ */
+static void UpdateDisplayContent(void);
+
+/**
+ * @brief Función que atiende la interrupción periódica del sistema, se ejecuta cada un milisegundo
+ *
+ */
+static void TickHandler(void);
+
+/**
+ * @brief Función que realiza el trabajo diferido por TickHandler con la menor prioridad
+ *
+ */
+static void DeferredHandler(void);
+
+/**
+ * @brief Función que se ejecuta al entrar a un estado de la MEF del reloj
+ *
+ * Aplica en el display el perfil correspondiente al estado y reinicia la cuenta del tiempo sin apretar botones.
+ *
+ * @param state estado al que se entra
+ */
+static void EnterState(uint8_t state);
+
+/**
+ * @brief Función que obtiene el próximo evento a procesar por la MEF
+ *
+ * Revisa las entradas en orden de prioridad y se detiene en la primera que genera un evento, de modo que los flancos
+ * de las entradas que no se revisaron se atienden en la próxima llamada.
+ *
+ * @return evento a procesar o EVENT_NONE si no hay ninguno
+ */
+static events_e NextEvent(void);
+
+/**
+ * @brief Funcion para mejorar legibilidad de main
+ * Se encarga de verificar que los botones se mantienen pulsados el tiempo necesario
+ * @param check_values
+ * @return retorna:
+ *  \li 1 si se mantuvo presionado el botón el tiempo necesario
+ *  \li 0 si no se lo mantuvo presionado lo suficiente
+ */
+static bool KeepedHoldButton(check_button_hold_p check_values);
+
+/**
+ * @brief Funcion perteneciente a la Interface utilizada por el reloj, esta se encarga de prender la alarma
+ *
+ */
+void TurnOnAlarm(void);
+
+/**
+ * @brief Funcion perteneciente a la Interface utilizada por el reloj, esta se encarga de apagar la alarma
+ *
+ */
+void TurnOffAlarm(void);
+
+/**
+ * @brief Funcion para incrementar los digitos de un númeroo en formato array cada vez que es llamada y realiza el
+ * control de si se alcanzó el limite establecido.
+ *
+ * El el LS digit es el 0 y el MS digit es el tamaño del array-1.
+ *
+ * @param array array a modificarl
+ * @param limits_array array con los limites maximos del número
+ * @param size tamaño de los array
+ */
+static void IncrementControl(uint8_t * array, const uint8_t * array_limits, int size);
+
+/**
+ * @brief Funcion para decrementar los digitos de un númeroo en formato array cada vez que es llamada y realiza el
+ * control de si se alcanzó el limite establecido.
+ *
+ * El el LS digit es el 0 y el MS digit es el tamaño del array-1.
+ *
+ * @param array array a modificarl
+ * @param limits_array array con los limites maximos del número
+ * @param size tamaño de los array
+ */
+static void DecrementControl(uint8_t * array, const uint8_t * array_limits, int size);
+
+/**
+ * @brief Funcion para evitar codigo repetido, se encarga de sumar 1 al contador de 30 segundos y ver si ya pasaron 30s
+ *
+ * @return retorna:
+ *  \li 1 si pasaron 30s
+ *  \li 0 si no pasaron
+ */
+static bool Passed30s(void);
+
+/**
+ * @brief Acciones de las transiciones de la MEF del reloj
+ *
+ * Reciben el estado siguiente indicado en la tabla y devuelven el estado al que se debe pasar.
+ *
+ * @param next estado siguiente indicado en la tabla
+ * @return estado al que pasa la MEF
+ */
+static uint8_t StartAdjustTime(uint8_t next);
+static uint8_t StartAdjustAlarm(uint8_t next);
+static uint8_t IncrementMinutes(uint8_t next);
+static uint8_t DecrementMinutes(uint8_t next);
+static uint8_t IncrementHours(uint8_t next);
+static uint8_t DecrementHours(uint8_t next);
+static uint8_t CancelAdjustTime(uint8_t next);
+static uint8_t AcceptTime(uint8_t next);
+static uint8_t AcceptAlarm(uint8_t next);
+static uint8_t AcceptInValidTime(uint8_t next);
+static uint8_t CancelInValidTime(uint8_t next);
+static uint8_t AcceptRemoteChange(uint8_t next);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+//! Limites de los dígitos de los minutos, unidad y decena
+static const uint8_t MINUTES_LIMIT[2] = {0, 6};
+
+//! Limites de los dígitos de las horas, unidad y decena
+static const uint8_t HOURS_LIMIT[2] = {4, 2};
+
+//! Tabla de transiciones de la MEF del reloj, las entradas que no se indican ignoran el evento
+static const state_transition_t TRANSITIONS[STATES_COUNT][EVENTS_COUNT] = {
+    [valid_time] =
+        {
+            [EVENT_SET_TIME] = STATE_TRANSITION(StartAdjustTime, adjust_time_minutes),
+            [EVENT_SET_ALARM] = STATE_TRANSITION(StartAdjustAlarm, adjust_alarm_minutes),
+            [EVENT_ACCEPT] = STATE_TRANSITION(AcceptInValidTime, valid_time),
+            [EVENT_CANCEL] = STATE_TRANSITION(CancelInValidTime, valid_time),
+            [EVENT_ALARM_CHANGED] = STATE_TRANSITION(NULL, valid_time),
+            [EVENT_REMOTE_CHANGED] = STATE_TRANSITION(AcceptRemoteChange, valid_time),
+        },
+    [invalid_time] =
+        {
+            [EVENT_SET_TIME] = STATE_TRANSITION(StartAdjustTime, adjust_time_minutes),
+            [EVENT_REMOTE_CHANGED] = STATE_TRANSITION(AcceptRemoteChange, valid_time),
+        },
+    [adjust_time_minutes] =
+        {
+            [EVENT_INCREMENT] = STATE_TRANSITION(IncrementMinutes, STATE_MACHINE_NO_CHANGE),
+            [EVENT_DECREMENT] = STATE_TRANSITION(DecrementMinutes, STATE_MACHINE_NO_CHANGE),
+            [EVENT_ACCEPT] = STATE_TRANSITION(NULL, adjust_time_hours),
+            [EVENT_CANCEL] = STATE_TRANSITION(CancelAdjustTime, valid_time),
+            [EVENT_TIMEOUT] = STATE_TRANSITION(CancelAdjustTime, valid_time),
+        },
+    [adjust_time_hours] =
+        {
+            [EVENT_INCREMENT] = STATE_TRANSITION(IncrementHours, STATE_MACHINE_NO_CHANGE),
+            [EVENT_DECREMENT] = STATE_TRANSITION(DecrementHours, STATE_MACHINE_NO_CHANGE),
+            [EVENT_ACCEPT] = STATE_TRANSITION(AcceptTime, valid_time),
+            [EVENT_CANCEL] = STATE_TRANSITION(CancelAdjustTime, valid_time),
+            [EVENT_TIMEOUT] = STATE_TRANSITION(CancelAdjustTime, valid_time),
+        },
+    [adjust_alarm_minutes] =
+        {
+            [EVENT_INCREMENT] = STATE_TRANSITION(IncrementMinutes, STATE_MACHINE_NO_CHANGE),
+            [EVENT_DECREMENT] = STATE_TRANSITION(DecrementMinutes, STATE_MACHINE_NO_CHANGE),
+            [EVENT_ACCEPT] = STATE_TRANSITION(NULL, adjust_alarm_hours),
+            [EVENT_CANCEL] = STATE_TRANSITION(NULL, valid_time),
+            [EVENT_TIMEOUT] = STATE_TRANSITION(NULL, valid_time),
+        },
+    [adjust_alarm_hours] =
+        {
+            [EVENT_INCREMENT] = STATE_TRANSITION(IncrementHours, STATE_MACHINE_NO_CHANGE),
+            [EVENT_DECREMENT] = STATE_TRANSITION(DecrementHours, STATE_MACHINE_NO_CHANGE),
+            [EVENT_ACCEPT] = STATE_TRANSITION(AcceptAlarm, valid_time),
+            [EVENT_CANCEL] = STATE_TRANSITION(NULL, valid_time),
+            [EVENT_TIMEOUT] = STATE_TRANSITION(NULL, valid_time),
+        },
+};
+
+//! Perfil del display de cada estado de la MEF del reloj
+static const display_profile_t PROFILES[STATES_COUNT] = {
+    [valid_time] =
+        {
+            .content = CONTENT_CLOCK_TIME,
+            .blink_from = 0,
+            .blink_to = 3,
+            .blink_calls = 0,
+            .dots = {{DOT_IF_RINGING, 0}, {DOT_OFF, 0}, {DOT_ON, 500}, {DOT_IF_ALARM_ACTIVE, 0}},
+        },
+    [invalid_time] =
+        {
+            .content = CONTENT_CLOCK_TIME,
+            .blink_from = 0,
+            .blink_to = 3,
+            .blink_calls = 50,
+            .dots = {{DOT_OFF, 0}, {DOT_OFF, 0}, {DOT_ON, 50}, {DOT_OFF, 0}},
+        },
+    [adjust_time_minutes] =
+        {
+            .content = CONTENT_EDITED_TIME,
+            .blink_from = 0,
+            .blink_to = 1,
+            .blink_calls = 50,
+            .dots = {{DOT_KEEP, 0}, {DOT_KEEP, 0}, {DOT_ON, 0}, {DOT_KEEP, 0}},
+        },
+    [adjust_time_hours] =
+        {
+            .content = CONTENT_EDITED_TIME,
+            .blink_from = 2,
+            .blink_to = 3,
+            .blink_calls = 50,
+            .dots = {{DOT_KEEP, 0}, {DOT_KEEP, 0}, {DOT_KEEP, 0}, {DOT_KEEP, 0}},
+        },
+    [adjust_alarm_minutes] =
+        {
+            .content = CONTENT_EDITED_TIME,
+            .blink_from = 0,
+            .blink_to = 1,
+            .blink_calls = 50,
+            .dots = {{DOT_ON, 100}, {DOT_ON, 100}, {DOT_ON, 100}, {DOT_ON, 100}},
+        },
+    [adjust_alarm_hours] =
+        {
+            .content = CONTENT_EDITED_TIME,
+            .blink_from = 2,
+            .blink_to = 3,
+            .blink_calls = 50,
+            .dots = {{DOT_ON, 100}, {DOT_ON, 100}, {DOT_ON, 100}, {DOT_ON, 100}},
+        },
+};
+
+//! Descripción de la MEF del reloj
+static const state_machine_table_t CLOCK_STATE_MACHINE = {
+    .transitions = &TRANSITIONS[0][0],
+    .states = STATES_COUNT,
+    .events = EVENTS_COUNT,
+    .Enter = EnterState,
+};
+
+//! Interface con las funciones de tiempo y de bajo consumo que usa el planificador
+static const struct scheduler_driver_s scheduler_driver = {
+    .Now = SchedulerNow,
+    .Sleep = SchedulerSleep,
+    .Cycles = SchedulerCycles,
+    .Missed = SchedulerMissed,
+};
+
+//! Interface con las funciones que avisan que se apagó o se prendió la pantalla
+static const struct app_suspend_driver_s suspend_driver = {
+    .Suspended = DisplaySuspended,
+    .Resumed = DisplayResumed,
+};
+
+//! Interface con las funciones que prenden y apagan la alarma del reloj
+static const struct clock_alarm_driver_s alarm_driver = {
+    .TurnOnAlarm = TurnOnAlarm,
+    .TurnOffAlarm = TurnOffAlarm,
+};
+
+//! Interface con el RTC del microcontrolador, que mantiene la hora con la pantalla apagada
+static const struct clock_rtc_driver_s rtc_driver = {
+    .Read = HalRtcRead,
+    .Write = HalRtcWrite,
+    .SetAlarm = HalRtcSetAlarm,
+};
+
+//! Referencia al poncho
+static HAL_BOARD_LOCAL shield_p shield;
+
+//! Planificador de las tareas del lazo principal
+static HAL_BOARD_LOCAL scheduler_p scheduler;
+
+//! Control del tiempo que se mantiene presionado el botón para cambiar la hora
+static HAL_BOARD_LOCAL struct check_button_hold_s set_time = {0};
+
+//! Control del tiempo que se mantiene presionado el botón para cambiar la alarma
+static HAL_BOARD_LOCAL struct check_button_hold_s set_alarm = {0};
+
+//! Variable Auxiliar utilizada para guardar la hora que se elige al configurar la alarma o la hora
+static HAL_BOARD_LOCAL clock_time_u new_time;
+
+//! MEF del reloj
+static HAL_BOARD_LOCAL state_machine_t state_machine;
+
+//! Referencia al objeto reloj
+static HAL_BOARD_LOCAL clock_p clock;
+
+//! Generador de patrones que hace sonar el zumbador de la alarma
+static HAL_BOARD_LOCAL output_pattern_p alarm_pattern;
+
+//! Contador de milisegundos, para tener un control de tiempo en main
+static HAL_BOARD_LOCAL volatile uint32_t milliseconds = 0;
+
+//! Milisegundos que pasan en cada interrupción periódica
+static HAL_BOARD_LOCAL uint32_t tick_period_ms = 1;
+
+//! Varaible para saber cuando pasaron 30 segundos sin apretar un botón
+static HAL_BOARD_LOCAL uint32_t aux_30s = 0;
+
+//! Estado de la alarma que se mostró por última vez en el display
+static HAL_BOARD_LOCAL bool alarm_was_ringing = false;
+
+//! Segundos de la última hora que se escribió en el display
+static HAL_BOARD_LOCAL volatile uint32_t displayed_seconds = DISPLAY_REDRAW;
+
+//! Función que se llama al no cumplir un plazo
+static HAL_BOARD_LOCAL app_deadline_hook_p deadline_hook = NULL;
+
+//! Periodo de la interrupción periódica en cuentas de HalTimestamp
+static HAL_BOARD_LOCAL uint32_t tick_period_counts = 0;
+
+//! Máximo tiempo desde el disparo de la interrupción periódica hasta el final de su rutina
+static HAL_BOARD_LOCAL volatile uint32_t tick_worst = 0;
+
+//! Cantidad de rutinas de la interrupción periódica que terminaron después del siguiente tick
+static HAL_BOARD_LOCAL volatile uint32_t tick_overruns = 0;
+
+//! Tiempo desde el inicio de la aplicación hasta tener una hora válida, en cuentas de HalTimestamp
+static HAL_BOARD_LOCAL uint32_t boot_latency = 0;
+
+//! Zona horaria de la aplicación, compilada para el año del reloj
+static HAL_BOARD_LOCAL timezone_t zone;
+
+//! Indica si la aplicación usa una zona horaria
+static HAL_BOARD_LOCAL bool zone_valid = false;
+
+//! Indica que la hora guardada quedó vieja, se marca desde la interrupción periódica al empezar cada minuto
+static HAL_BOARD_LOCAL volatile bool settings_stale = false;
+
+//! Indica que la consola cambió el reloj y la MEF todavía no lo atendió
+static HAL_BOARD_LOCAL bool remote_changed = false;
+
+//! Valor de HalCycleCounter en el disparo de la última interrupción periódica
+static HAL_BOARD_LOCAL volatile uint32_t tick_fired = 0;
+
+//! Duración y latencia de la interrupción periódica
+PROFILER_REGION(tick_region, "SysTick");
+
+//! Duración y latencia del trabajo diferido
+PROFILER_REGION(deferred_region, "PendSV");
+
+#ifdef USE_PROFILER
+//! Valor de HalTimestamp cuando se pidió el trabajo diferido, para medir su latencia
+static HAL_BOARD_LOCAL volatile uint32_t deferred_requested = 0;
+#endif
+
+/* === Private function implementation ========================================================= */
+
+static void ConfigureSystick(uint16_t ticks_per_second) {
+    HalDeferredStart(DeferredHandler);
+    HalTickStart(ticks_per_second, TickHandler);
+}
+
+static void PollInputs(void) {
+    events_e event = NextEvent();
+
+    if (event != EVENT_NONE) {
+        StateMachineDispatch(&state_machine, event);
+    }
+
+    // Con la telemetría o la sincronización periódicas la consola debe seguir atendida, no se apaga la pantalla
+    AppSuspendIdle(INPUTS_POLL_PERIOD_MS, event != EVENT_NONE && event != EVENT_TIMEOUT,
+                   StateMachineGetState(&state_machine) == valid_time && !ClockIsAlarmRinging(clock) &&
+                       AppTelemetryGetPeriod() == 0 && AppSyncGetPeriod() == 0);
+
+    if (PROFILES[StateMachineGetState(&state_machine)].content == CONTENT_EDITED_TIME) {
+        DisplayWriteBCD(shield->display, &new_time.bcd[2], sizeof(new_time.bcd));
+    }
+
+    UpdateTimezone();
+    // Los ajustes solo cambian con un evento o al pasar un minuto, no hace falta revisarlos en cada llamada
+    if (event != EVENT_NONE || settings_stale) {
+        settings_stale = false;
+        SaveSettings();
+    }
+}
+
+static bool RestoreSettings(void) {
+    snapshot_t snapshot;
+    clock_time_u value = {0};
+    bool result = ClockIsTimeValid(clock);
+
+    if (SnapshotRestore(&snapshot) == 0) {
+        if (snapshot.flags & SNAPSHOT_ALARM_SET) {
+            memcpy(&value.bcd[2], snapshot.alarm, sizeof(snapshot.alarm));
+            ClockSetAlarm(clock, &value);
+            ClockSetAlarmState(clock, (snapshot.flags & SNAPSHOT_ALARM_ACTIVE) != 0);
+        }
+        // La hora del RTC tiene los segundos, la guardada solo los minutos
+        if (!result && (snapshot.flags & SNAPSHOT_TIME_VALID)) {
+            memcpy(&value.bcd[2], snapshot.time, sizeof(snapshot.time));
+            result = ClockSetTime(clock, &value);
+        }
+    }
+
+    return result;
+}
+
+static void SaveSettings(void) {
+    snapshot_t snapshot = {0};
+    clock_time_u value;
+
+    // Los segundos no se guardan, así se escribe como máximo una copia por minuto
+    if (ClockGetTime(clock, &value)) {
+        snapshot.flags |= SNAPSHOT_TIME_VALID;
+        memcpy(snapshot.time, &value.bcd[2], sizeof(snapshot.time));
+    }
+    if (ClockGetAlarm(clock, &value)) {
+        snapshot.flags |= SNAPSHOT_ALARM_SET;
+        memcpy(snapshot.alarm, &value.bcd[2], sizeof(snapshot.alarm));
+        if (ClockIsAlarmActivated(clock)) {
+            snapshot.flags |= SNAPSHOT_ALARM_ACTIVE;
+        }
+    }
+    SnapshotSave(&snapshot);
+}
+
+static void UpdateTimezone(void) {
+    calendar_date_t date;
+
+    if (zone_valid) {
+        ClockGetDate(clock, &date);
+        if (date.year != zone.year) {
+            // La interrupción periódica compara con la tabla, no debe verla a medio compilar
+            HalInterruptsDisable();
+            TimezoneCompile(&zone, date.year);
+            ClockSetTimezone(clock, &zone);
+            HalInterruptsEnable();
+            settings_stale = true;
+        }
+    }
+}
+
+static void MinuteChanged(clock_p source, void * context) {
+    (void)source;
+    (void)context;
+    settings_stale = true;
+}
+
+static void RemoteChanged(void) {
+    remote_changed = true;
+    settings_stale = true;
+}
+
+static void LastTick(uint32_t * fired, uint32_t * now) {
+    HalInterruptsDisable();
+    *fired = tick_fired;
+    *now = milliseconds;
+    HalInterruptsEnable();
+}
+
+static void DisplaySuspended(void) {
+    AppTelemetryRestartDrift();
+}
+
+static void DisplayResumed(void) {
+    settings_stale = true;
+    displayed_seconds = DISPLAY_REDRAW;
+    UpdateDisplayContent();
+}
+
+static uint32_t SchedulerNow(void) {
+    return milliseconds;
+}
+
+static void SchedulerSleep(uint32_t now) {
+    // Con las interrupciones deshabilitadas el procesador igual despierta con una interrupción pendiente
+    HalInterruptsDisable();
+    if (milliseconds == now) {
+        HalSleep();
+    }
+    HalInterruptsEnable();
+}
+
+static uint32_t SchedulerCycles(void) {
+    return HalCycleCounter();
+}
+
+static void SchedulerMissed(scheduler_task_p task, uint32_t lateness) {
+    (void)task;
+    DeadlineMissed(APP_DEADLINE_LOOP, lateness);
+}
+
+static void DeadlineMissed(app_deadline_e source, uint32_t lateness) {
+    EVENT_TRACE(EVENT_TRACE_DEADLINE_MISSED, source, (lateness > UINT16_MAX) ? UINT16_MAX : lateness);
+    if (deadline_hook != NULL) {
+        deadline_hook(source, lateness);
+    }
+}
+
+static void CheckTickDeadline(uint32_t fired) {
+    uint32_t elapsed = HalTimestamp() - fired;
+
+    if (elapsed > tick_worst) {
+        tick_worst = elapsed;
+    }
+    // El SysTick no vuelve a interrumpir a su propia rutina, el siguiente tick queda pendiente hasta que termine
+    if (HalTickOverrun()) {
+        tick_overruns++;
+        DeadlineMissed(APP_DEADLINE_TICK, (elapsed > tick_period_counts) ? elapsed - tick_period_counts : 0);
+    }
+}
+
+static void UpdateDisplayContent(void) {
+    clock_time_u current_time;
+
+    if (PROFILES[StateMachineGetState(&state_machine)].content == CONTENT_CLOCK_TIME) {
+        displayed_seconds = ClockGetTimeInSeconds(clock);
+        ClockGetTime(clock, &current_time);
+        DisplayWriteBCD(shield->display, &current_time.bcd[2], sizeof(current_time.bcd));
+    }
+}
+
+static void EnterState(uint8_t state) {
+    const display_profile_t * profile = &PROFILES[state];
+    bool on;
+
+    aux_30s = 0;
+    displayed_seconds = DISPLAY_REDRAW;
+    DisplayBlinkingDigits(shield->display, profile->blink_from, profile->blink_to, profile->blink_calls);
+
+    for (uint8_t i = 0; i < 4; i++) {
+        switch (profile->dots[i].mode) {
+        case DOT_ON:
+            on = true;
+            break;
+        case DOT_IF_RINGING:
+            on = ClockIsAlarmRinging(clock);
+            break;
+        case DOT_IF_ALARM_ACTIVE:
+            on = ClockIsAlarmActivated(clock);
+            break;
+        default:
+            on = false;
+            break;
+        }
+        if (profile->dots[i].mode != DOT_KEEP) {
+            DisplayDot(shield->display, i, on, profile->dots[i].calls);
+        }
+    }
+}
+
+static events_e NextEvent(void) {
+    events_e event = EVENT_NONE;
+    bool ringing = ClockIsAlarmRinging(clock);
+
+    if (ringing != alarm_was_ringing) {
+        alarm_was_ringing = ringing;
+        event = EVENT_ALARM_CHANGED;
+    } else if (remote_changed) {
+        remote_changed = false;
+        event = EVENT_REMOTE_CHANGED;
+    } else if (AppSuspendKeysHeld()) {
+        // Las teclas no generan eventos hasta soltar la que despertó al procesador
+    } else if (KeepedHoldButton(&set_time)) {
+        event = EVENT_SET_TIME;
+    } else if (KeepedHoldButton(&set_alarm)) {
+        event = EVENT_SET_ALARM;
+    } else if (DigitalInputWasActivated(shield->incremet)) {
+        event = EVENT_INCREMENT;
+    } else if (DigitalInputWasActivated(shield->decrement)) {
+        event = EVENT_DECREMENT;
+    } else if (DigitalInputWasActivated(shield->accept)) {
+        event = EVENT_ACCEPT;
+    } else if (DigitalInputWasActivated(shield->cancel)) {
+        event = EVENT_CANCEL;
+    } else if (Passed30s()) {
+        event = EVENT_TIMEOUT;
+    }
+
+    // Los eventos de los botones son los primeros de la lista, el resto no se cuenta
+    AppTelemetryCountButton((uint8_t)event);
+
+    return event;
+}
+
+static bool KeepedHoldButton(check_button_hold_p check_values) {
+    bool result = 0;
+    if (DigitalInputGetIsActive(check_values->button) && check_values->counter < check_values->time_to_hold) {
+        check_values->counter++;
+        if (check_values->counter == check_values->time_to_hold) {
+            check_values->counter = 0;
+            result = 1;
+        }
+    } else {
+        check_values->counter = 0;
+        result = 0;
+    }
+    return result;
+}
+
+void TurnOnAlarm(void) {
+    AppTelemetryCountRing();
+    OutputPatternStart(alarm_pattern, &OUTPUT_SEQUENCE_BEEP_BEEP);
+}
+
+void TurnOffAlarm(void) {
+    OutputPatternStop(alarm_pattern);
+}
+
+static void IncrementControl(uint8_t * array, const uint8_t * array_limits, int size) {
+    bool increment = false;
+
+    aux_30s = 0;
+
+    for (int i = 0; i < size; i++) {
+        if (array[i] != array_limits[i]) {
+            increment = true;
+        }
+    }
+
+    if (increment) {
+        for (int i = 0; i < size; i++) {
+            if (array[i] < 9) {
+                array[i]++;
+                for (int j = 0; j < i; j++) {
+                    array[j] = 0;
+                }
+                i = size;
+            }
+        }
+    } else {
+        for (int i = 0; i < size; i++) {
+            array[i] = 0;
+        }
+    }
+}
+
+static void DecrementControl(uint8_t * array, const uint8_t * array_limits, int size) {
+    bool decrement = false;
+
+    aux_30s = 0;
+
+    for (int i = 0; i < size; i++) {
+        if (array[i] != 0) {
+            decrement = true;
+        }
+    }
+
+    if (decrement) {
+        for (int i = 0; i < size; i++) {
+            if (array[i] > 0) {
+                array[i]--;
+                for (int j = 0; j < i; j++) {
+                    array[j] = 9;
+                }
+                i = size;
+            }
+        }
+    } else {
+        for (int i = 0; i < size; i++) {
+            array[i] = array_limits[i];
+        }
+    }
+}
+
+static bool Passed30s(void) {
+    bool result = false;
+
+    aux_30s++;
+    if (aux_30s == 3000) {
+        result = true;
+    }
+
+    return result;
+}
+
+static uint8_t StartAdjustTime(uint8_t next) {
+    ClockGetTime(clock, &new_time);
+    return next;
+}
+
+static uint8_t StartAdjustAlarm(uint8_t next) {
+    ClockGetAlarm(clock, &new_time);
+    new_time.bcd[0] = 0; // Para que los segundos no afecten la alarma
+    new_time.bcd[1] = 0; // Para que los segundos no afecten la alarma
+    return next;
+}
+
+static uint8_t IncrementMinutes(uint8_t next) {
+    IncrementControl(&new_time.bcd[2], MINUTES_LIMIT, 2);
+    return next;
+}
+
+static uint8_t DecrementMinutes(uint8_t next) {
+    DecrementControl(&new_time.bcd[2], MINUTES_LIMIT, 2);
+    return next;
+}
+
+static uint8_t IncrementHours(uint8_t next) {
+    IncrementControl(&new_time.bcd[4], HOURS_LIMIT, 2);
+    return next;
+}
+
+static uint8_t DecrementHours(uint8_t next) {
+    DecrementControl(&new_time.bcd[4], HOURS_LIMIT, 2);
+    return next;
+}
+
+static uint8_t CancelAdjustTime(uint8_t next) {
+    clock_time_u current_time;
+
+    if (!ClockGetTime(clock, &current_time)) {
+        next = invalid_time;
+    }
+    return next;
+}
+
+static uint8_t AcceptTime(uint8_t next) {
+    if (!ClockSetTime(clock, &new_time)) {
+        next = invalid_time;
+    }
+    return next;
+}
+
+static uint8_t AcceptAlarm(uint8_t next) {
+    ClockSetAlarm(clock, &new_time);
+    return next;
+}
+
+static uint8_t AcceptInValidTime(uint8_t next) {
+    clock_time_u alarm;
+
+    if (ClockIsAlarmRinging(clock)) {
+        AppTelemetryCountSnoozes((uint32_t)ClockSnoozeAlarm(clock));
+    } else if (ClockGetAlarm(clock, &alarm) && !ClockIsAlarmSnoozed(clock)) {
+        ClockSetAlarmState(clock, true);
+    }
+    return next;
+}
+
+static uint8_t CancelInValidTime(uint8_t next) {
+    clock_time_u alarm;
+
+    if (ClockIsAlarmRinging(clock)) {
+        ClockTurnOffAlarm(clock);
+    } else if (ClockGetAlarm(clock, &alarm) && !ClockIsAlarmSnoozed(clock)) {
+        ClockSetAlarmState(clock, false);
+    }
+    return next;
+}
+
+static uint8_t AcceptRemoteChange(uint8_t next) {
+    // Vuelve a entrar al estado para redibujar la hora y los puntos, o pasa a hora inválida si la hora no se ajustó
+    if (!ClockIsTimeValid(clock)) {
+        next = invalid_time;
+    }
+    return next;
+}
+
+/* === Public function implementation ========================================================= */
+
+void AppInit(const app_config_t * config) {
+    static const app_config_t defaults = {
+        .ticks_per_second = APP_TICKS_PER_SECOND,
+        .seconds_snoozed = APP_SECONDS_SNOOZED,
+        .alarm_policy = {.ring_timeout = APP_ALARM_RING_TIMEOUT},
+        .telemetry_period = APP_TELEMETRY_PERIOD,
+        .sync_period = APP_SYNC_PERIOD,
+        .display_timeout = APP_DISPLAY_TIMEOUT,
+    };
+    calendar_date_t date;
+    uint32_t boot_start;
+    bool restored;
+    int error;
+
+    // El contador se inicia antes que la interrupción periódica para medir el arranque
+    HalCycleCounterStart();
+    boot_start = HalTimestamp();
+
+    if (config == NULL) {
+        config = &defaults;
+    }
+
+    // Se reinicia todo el estado para poder iniciar la aplicación más de una vez, como hace el simulador
+    milliseconds = 0;
+    tick_period_ms = 1000 / config->ticks_per_second;
+    tick_period_counts = HalCycleCounterFrequency() / config->ticks_per_second;
+    tick_worst = 0;
+    tick_overruns = 0;
+    deadline_hook = config->deadline_hook;
+    aux_30s = 0;
+    alarm_was_ringing = false;
+    settings_stale = true;
+    remote_changed = false;
+    tick_fired = 0;
+    AppTelemetryInit(LastTick, config->telemetry_period, tick_period_ms, tick_period_counts);
+    displayed_seconds = DISPLAY_REDRAW;
+    PROFILER_START(tick_region);
+    PROFILER_START(deferred_region);
+    EventTraceInit(SchedulerNow);
+    TimersInit();
+    memset(&set_time, 0, sizeof(set_time));
+    memset(&set_alarm, 0, sizeof(set_alarm));
+
+    shield = ShieldCreate();
+    alarm_pattern = OutputPatternCreate(shield->buzzer, true); // Es activo en bajo
+
+    set_time.button = shield->set_time;
+    set_time.time_to_hold = TIME_TO_HOLD_TO_CHANGE_STATE_MS;
+    set_alarm.button = shield->set_alarm;
+    set_alarm.time_to_hold = TIME_TO_HOLD_TO_CHANGE_STATE_MS;
+
+    clock = ClockCreate(config->ticks_per_second, &alarm_driver, config->seconds_snoozed);
+    ClockSetAlarmPolicy(clock, &config->alarm_policy);
+    ClockAddHook(clock, CLOCK_HOOK_MINUTE, NULL, MinuteChanged, NULL);
+    zone_valid = (config->timezone != NULL) && (TimezoneParse(&zone, config->timezone) == 0);
+    if (zone_valid) {
+        ClockGetDate(clock, &date);
+        TimezoneCompile(&zone, date.year);
+        ClockSetTimezone(clock, &zone);
+    }
+    AppSyncInit(clock, config->sync_period);
+    AppSuspendInit(clock, shield, config->display_timeout, &suspend_driver);
+    // Si el RTC siguió contando durante el reinicio el reloj arranca con su hora
+    HalRtcStart(AppSuspendRtcAlarm);
+    ClockSetRtc(clock, &rtc_driver);
+    restored = RestoreSettings();
+    boot_latency = restored ? HalTimestamp() - boot_start : 0;
+
+    ConfigureSystick(config->ticks_per_second);
+    StateMachineInit(&state_machine, &CLOCK_STATE_MACHINE, restored ? valid_time : invalid_time);
+
+    scheduler = SchedulerCreate(&scheduler_driver);
+    assert(scheduler != NULL);
+    error = SchedulerAddTask(scheduler, PollInputs, INPUTS_POLL_PERIOD_MS);
+
+    AppConsoleInit(clock, RemoteChanged);
+    error |= SchedulerAddTask(scheduler, ConsolePoll, CONSOLE_POLL_PERIOD_MS);
+    error |= SchedulerAddTask(scheduler, AppTelemetryTask, TELEMETRY_TASK_PERIOD_MS);
+    error |= SchedulerAddTask(scheduler, AppSyncTask, SYNC_TASK_PERIOD_MS);
+    // Una tarea que no entra en el planificador no se ejecutaría nunca, se aumenta SCHEDULER_MAX_TASKS en config.h
+    assert(error == 0);
+    (void)error;
+}
+
+void AppRun(void) {
+    SchedulerRun(scheduler);
+}
+
+void AppGetDeadlineStats(app_deadline_stats_t * stats) {
+    scheduler_stats_t loop;
+    uint64_t busy;
+
+    SchedulerGetStats(scheduler, &loop);
+    stats->loop_worst = loop.worst;
+    stats->loop_skipped = loop.skipped;
+    stats->loop_wakeups = loop.wakeups;
+    // Después de muchas horas el producto por un millón desbordaría, se divide primero el tiempo total
+    busy = loop.elapsed - loop.idle;
+    if (loop.elapsed == 0) {
+        stats->loop_busy = 0;
+    } else if (busy > UINT64_MAX / 1000000) {
+        stats->loop_busy = (uint32_t)(busy / (loop.elapsed / 1000000));
+    } else {
+        stats->loop_busy = (uint32_t)(busy * 1000000 / loop.elapsed);
+    }
+    stats->tick_period = tick_period_counts;
+    HalInterruptsDisable();
+    stats->tick_worst = tick_worst;
+    stats->tick_overruns = tick_overruns;
+    HalInterruptsEnable();
+}
+
+uint32_t AppGetBootLatency(void) {
+    return boot_latency;
+}
+
+static void TickHandler(void) {
+    PROFILER_ENTER(tick_region, HalTickLatency());
+    uint32_t fired = HalTimestamp() - HalTickLatency();
+    digital_output_batch_t outputs;
+    uint32_t step;
+
+    // La deriva compara con los ticks contados, que en el simulador avanzan con el tiempo simulado y no con el real
+    tick_fired = HalCycleCounter() - HalTickLatency();
+    ClockNewTick(clock);
+    TimersTick(tick_period_ms);
+    // Las secuencias del zumbador están escritas con pasos de 1 ms, sus cambios se juntan en un lote y la salida se
+    // escribe como máximo una vez por tick
+    DigitalOutputBatchBegin(&outputs);
+    for (step = 0; step < tick_period_ms; step++) {
+        OutputPatternTickBatch(alarm_pattern, &outputs);
+    }
+    DigitalOutputBatchCommit(&outputs);
+    milliseconds += tick_period_ms;
+
+    DisplayRefresh(shield->display);
+
+#ifdef USE_DEFERRED_DISPLAY_UPDATE
+    // Solo se pide el trabajo diferido cuando cambió la hora o se debe volver a dibujar
+    if (ClockGetTimeInSeconds(clock) != displayed_seconds) {
+#ifdef USE_PROFILER
+        deferred_requested = HalTimestamp();
+#endif
+        HalDeferredRequest();
+    }
+#else
+    UpdateDisplayContent();
+#endif
+
+    CheckTickDeadline(fired);
+    PROFILER_EXIT(tick_region);
+}
+
+static void DeferredHandler(void) {
+    PROFILER_ENTER(deferred_region, HalTimestamp() - deferred_requested);
+
+    UpdateDisplayContent();
+
+    PROFILER_EXIT(deferred_region);
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -0,0 +1,378 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file app_console.c
+ ** @brief Código fuente de las órdenes de la consola serie de la aplicación - Electrónica 4 2025
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "app_console.h"
+#include "app.h"
+#include "app_suspend.h"
+#include "app_sync.h"
+#include "app_telemetry.h"
+#include "console.h"
+#include "event_trace.h"
+#include "hal.h"
+#include "profiler.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#ifndef APP_CONSOLE_BAUD_RATE
+//! Velocidad del puerto serie de la consola
+#define APP_CONSOLE_BAUD_RATE 115200
+#endif
+
+//! Tamaño del texto de una región medida o de un evento que se escribe en la consola
+#define CONSOLE_JSON_SIZE 512
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Función que inicia la recepción del puerto serie de la consola con la velocidad de la aplicación
+ *
+ * @param buffer buffer circular de recepción
+ * @param size tamaño del buffer
+ */
+static void SerialStart(uint8_t * buffer, size_t size);
+
+/**
+ * @brief Función que convierte los argumentos de una orden en una hora
+ *
+ * @param args argumentos, horas y minutos y opcionalmente segundos
+ * @param value hora en formato BCD
+ * @return true si los argumentos son una hora válida
+ */
+static bool ArgsToTime(const console_args_t * args, clock_time_u * value);
+
+/**
+ * @brief Función que escribe una hora en la consola, con guiones si no es válida
+ *
+ * @param value hora en formato BCD
+ * @param valid indica si la hora es válida
+ * @param digits cantidad de dígitos a escribir, 4 sin los segundos o 6 con ellos
+ */
+static void PrintTime(const clock_time_u * value, bool valid, uint8_t digits);
+
+/**
+ * @brief Órdenes de la consola
+ *
+ * @param args argumentos de la orden
+ */
+static void CommandHelp(const console_args_t * args);
+static void CommandTime(const console_args_t * args);
+static void CommandDate(const console_args_t * args);
+static void CommandAlarm(const console_args_t * args);
+static void CommandStats(const console_args_t * args);
+static void CommandTrace(const console_args_t * args);
+static void CommandTelemetry(const console_args_t * args);
+static void CommandSync(const console_args_t * args);
+static void CommandDisplay(const console_args_t * args);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Interface con el puerto serie que usa la consola
+static const struct console_driver_s console_driver = {
+    .Start = SerialStart,
+    .Received = HalSerialReceived,
+    .Send = HalSerialSend,
+    .Busy = HalSerialBusy,
+};
+
+//! Órdenes que atiende la consola
+static const console_command_t COMMANDS[] = {
+    {.name = "help", .handler = CommandHelp},   {.name = "time", .handler = CommandTime},
+    {.name = "date", .handler = CommandDate},   {.name = "alarm", .handler = CommandAlarm},
+    {.name = "stats", .handler = CommandStats}, {.name = "trace", .handler = CommandTrace},
+    {.name = "telemetry", .handler = CommandTelemetry}, {.name = "sync", .handler = CommandSync},
+    {.name = "display", .handler = CommandDisplay},
+};
+
+//! Reloj que leen y cambian las órdenes
+static HAL_BOARD_LOCAL clock_p clock;
+
+//! Función que se llama cuando una orden cambió el reloj
+static HAL_BOARD_LOCAL app_console_changed_p clock_changed;
+
+//! Próximo registro del trazado de eventos que escribe la orden trace
+static HAL_BOARD_LOCAL uint32_t trace_cursor = 0;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void SerialStart(uint8_t * buffer, size_t size) {
+    HalSerialStart(APP_CONSOLE_BAUD_RATE, buffer, size);
+}
+
+static bool ArgsToTime(const console_args_t * args, clock_time_u * value) {
+    static const uint32_t LIMITS[3] = {24, 60, 60};
+    uint32_t parts[3] = {0, 0, 0};
+    bool result = (args->count == 2 || args->count == 3);
+
+    for (uint8_t i = 0; i < args->count && result; i++) {
+        parts[i] = args->values[i].number;
+        result = args->values[i].numeric && parts[i] < LIMITS[i];
+    }
+    if (result) {
+        value->time.hours[1] = (uint8_t)(parts[0] / 10);
+        value->time.hours[0] = (uint8_t)(parts[0] % 10);
+        value->time.minutes[1] = (uint8_t)(parts[1] / 10);
+        value->time.minutes[0] = (uint8_t)(parts[1] % 10);
+        value->time.seconds[1] = (uint8_t)(parts[2] / 10);
+        value->time.seconds[0] = (uint8_t)(parts[2] % 10);
+    }
+
+    return result;
+}
+
+static void PrintTime(const clock_time_u * value, bool valid, uint8_t digits) {
+    if (!valid) {
+        ConsolePrint((digits == 6) ? "--:--:--" : "--:--");
+    } else if (digits == 6) {
+        ConsolePrint("%d%d:%d%d:%d%d", value->time.hours[1], value->time.hours[0], value->time.minutes[1],
+                     value->time.minutes[0], value->time.seconds[1], value->time.seconds[0]);
+    } else {
+        ConsolePrint("%d%d:%d%d", value->time.hours[1], value->time.hours[0], value->time.minutes[1],
+                     value->time.minutes[0]);
+    }
+}
+
+static void CommandHelp(const console_args_t * args) {
+    static const char HELP[] = "time [hh:mm[:ss]]\r\ndate [aaaa-mm-dd]\r\nalarm [hh:mm|on|off]\r\nstats\r\ntrace\r\n"
+                               "telemetry [segundos|off]\r\nsync\r\ndisplay [segundos|off]\r\n";
+
+    (void)args;
+    ConsoleWrite(HELP, sizeof(HELP) - 1);
+}
+
+static void CommandTime(const console_args_t * args) {
+    clock_time_u value;
+    bool valid;
+
+    if (args->count == 0) {
+        valid = ClockGetTime(clock, &value);
+        PrintTime(&value, valid, 6);
+        ConsolePrint("\r\n");
+    } else {
+        valid = ArgsToTime(args, &value);
+        if (valid) {
+            // La interrupción periódica avanza el reloj, no debe verlo a medio cambiar
+            HalInterruptsDisable();
+            valid = ClockSetTime(clock, &value);
+            HalInterruptsEnable();
+        }
+        if (valid) {
+            clock_changed();
+        }
+        ConsolePrint(valid ? "ok\r\n" : "error\r\n");
+    }
+}
+
+static void CommandDate(const console_args_t * args) {
+    calendar_date_t date = {0};
+    bool valid;
+
+    if (args->count == 0) {
+        valid = ClockGetDate(clock, &date);
+        if (valid) {
+            ConsolePrint("%04d-%02d-%02d\r\n", date.year, date.month, date.day);
+        } else {
+            ConsolePrint("----------\r\n");
+        }
+    } else {
+        valid = args->count == 3 && args->values[0].numeric && args->values[1].numeric && args->values[2].numeric &&
+                args->values[0].number <= INT16_MAX && args->values[1].number <= 12 && args->values[2].number <= 31;
+        if (valid) {
+            date.year = (int16_t)args->values[0].number;
+            date.month = (uint8_t)args->values[1].number;
+            date.day = (uint8_t)args->values[2].number;
+            HalInterruptsDisable();
+            valid = ClockSetDate(clock, &date);
+            HalInterruptsEnable();
+        }
+        if (valid) {
+            clock_changed();
+        }
+        ConsolePrint(valid ? "ok\r\n" : "error\r\n");
+    }
+}
+
+static void CommandAlarm(const console_args_t * args) {
+    clock_time_u value = {0};
+    bool valid = ClockGetAlarm(clock, &value);
+
+    if (args->count == 0) {
+        PrintTime(&value, valid, 4);
+        ConsolePrint(!valid ? "\r\n" : ClockIsAlarmActivated(clock) ? " on\r\n" : " off\r\n");
+    } else {
+        if (args->count == 1 && (ConsoleArgIs(args, 0, "on") || ConsoleArgIs(args, 0, "off"))) {
+            // Como con los botones, solo se activa una alarma que tiene hora
+            if (valid) {
+                HalInterruptsDisable();
+                ClockSetAlarmState(clock, ConsoleArgIs(args, 0, "on"));
+                HalInterruptsEnable();
+            }
+        } else {
+            valid = args->count == 2 && ArgsToTime(args, &value);
+            if (valid) {
+                HalInterruptsDisable();
+                valid = ClockSetAlarm(clock, &value);
+                HalInterruptsEnable();
+            }
+        }
+        if (valid) {
+            clock_changed();
+        }
+        ConsolePrint(valid ? "ok\r\n" : "error\r\n");
+    }
+}
+
+static void CommandStats(const console_args_t * args) {
+    app_deadline_stats_t deadlines;
+    console_stats_t console_stats;
+    profiler_region_t region;
+    time_sync_t sync;
+    char line[CONSOLE_JSON_SIZE];
+    int32_t adjustment;
+    int64_t offset;
+    int length;
+
+    (void)args;
+    AppGetDeadlineStats(&deadlines);
+    ConsoleGetStats(&console_stats);
+    ConsolePrint("tick: peor %lu de %lu, demoradas %lu\r\n", (unsigned long)deadlines.tick_worst,
+                 (unsigned long)deadlines.tick_period, (unsigned long)deadlines.tick_overruns);
+    ConsolePrint("lazo: peor atraso %lu ms, salteados %lu\r\n", (unsigned long)deadlines.loop_worst,
+                 (unsigned long)deadlines.loop_skipped);
+    ConsolePrint("lazo: despertares %lu, ocupado %lu.%04lu %%\r\n", (unsigned long)deadlines.loop_wakeups,
+                 (unsigned long)(deadlines.loop_busy / 10000), (unsigned long)(deadlines.loop_busy % 10000));
+    ConsolePrint("arranque: %lu\r\n", (unsigned long)AppGetBootLatency());
+    ConsolePrint("consola: %lu lineas, %lu errores, %lu descartados\r\n", (unsigned long)console_stats.lines,
+                 (unsigned long)console_stats.errors, (unsigned long)console_stats.dropped);
+    HalInterruptsDisable();
+    adjustment = ClockGetAdjustment(clock);
+    HalInterruptsEnable();
+    AppSyncGetState(&sync);
+    ConsolePrint("sync: %lu pedidos, %lu aceptados, %lu descartados\r\n", (unsigned long)sync.requests,
+                 (unsigned long)sync.accepted, (unsigned long)sync.rejected);
+    // El desplazamiento de la primera puesta en hora no entra en un long de 32 bits
+    offset = sync.last.offset;
+    offset = (offset > INT32_MAX) ? INT32_MAX : (offset < INT32_MIN) ? INT32_MIN : offset;
+    ConsolePrint("sync: desplazamiento %ld ms, demora %ld ms, falta corregir %ld ms\r\n", (long)offset,
+                 (long)sync.last.delay, (long)adjustment);
+    for (size_t index = 0; ProfilerSnapshot(index, &region) == 0; index++) {
+        length = ProfilerFormat(&region, line, sizeof(line));
+        if (length > 0) {
+            ConsoleWrite(line, ((size_t)length < sizeof(line)) ? (size_t)length : sizeof(line) - 1);
+        }
+    }
+}
+
+static void CommandTrace(const console_args_t * args) {
+    event_trace_record_t record;
+    uint32_t previous = trace_cursor;
+    uint32_t sequence;
+    char line[CONSOLE_JSON_SIZE];
+    bool full = false;
+    int length;
+
+    (void)args;
+    // Solo se escriben los registros que entran en el buffer de envío, los demás quedan para la próxima orden
+    while (!full && EventTraceRead(&trace_cursor, &sequence, &record) == 0) {
+        length = EventTraceFormat(sequence, &record, line, sizeof(line));
+        if (length <= 0 || (size_t)length >= sizeof(line) || (size_t)length > ConsoleFree()) {
+            trace_cursor = previous;
+            full = true;
+        } else {
+            ConsoleWrite(line, (size_t)length);
+            previous = trace_cursor;
+        }
+    }
+}
+
+static void CommandTelemetry(const console_args_t * args) {
+    bool valid = true;
+
+    if (args->count == 0) {
+        ConsolePrint("%u\r\n", AppTelemetryGetPeriod());
+    } else {
+        valid = args->count == 1 && (ConsoleArgIs(args, 0, "off") ||
+                                     (args->values[0].numeric && args->values[0].number <= UINT16_MAX));
+        if (valid) {
+            AppTelemetrySetPeriod(args->values[0].numeric ? (uint16_t)args->values[0].number : 0);
+        }
+        ConsolePrint(valid ? "ok\r\n" : "error\r\n");
+    }
+}
+
+static void CommandSync(const console_args_t * args) {
+    time_sync_sample_t sample;
+    int result = -1;
+
+    if (args->count == 0) {
+        AppSyncRequest();
+    } else {
+        if (args->count == 4 && args->values[0].numeric && args->values[1].numeric && args->values[2].numeric &&
+            args->values[3].numeric && args->values[2].number < 1000) {
+            result = AppSyncResponse(args->values[0].number,
+                                     (int64_t)args->values[1].number * 1000 + args->values[2].number,
+                                     args->values[3].number, &sample);
+        }
+        if (result == 1) {
+            clock_changed();
+        }
+        if (result == 0) {
+            ConsolePrint("offset %ld delay %ld\r\n", (long)sample.offset, (long)sample.delay);
+        } else {
+            ConsolePrint((result == 1) ? "ok\r\n" : "error\r\n");
+        }
+    }
+}
+
+static void CommandDisplay(const console_args_t * args) {
+    bool valid = true;
+
+    if (args->count == 0) {
+        ConsolePrint("%u\r\n", AppSuspendGetTimeout());
+    } else {
+        valid = args->count == 1 && (ConsoleArgIs(args, 0, "off") ||
+                                     (args->values[0].numeric && args->values[0].number <= UINT16_MAX));
+        if (valid) {
+            AppSuspendSetTimeout(args->values[0].numeric ? (uint16_t)args->values[0].number : 0);
+        }
+        ConsolePrint(valid ? "ok\r\n" : "error\r\n");
+    }
+}
+
+/* === Public function definitions ================================================================================= */
+
+void AppConsoleInit(clock_p reference, app_console_changed_p changed) {
+    clock = reference;
+    clock_changed = changed;
+    trace_cursor = 0;
+    ConsoleInit(&console_driver, COMMANDS, sizeof(COMMANDS) / sizeof(COMMANDS[0]));
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,179 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file app_suspend.c
+ ** @brief Código fuente del apagado de la pantalla de la aplicación sin usar las teclas - Electrónica 4 2025
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "app_suspend.h"
+#include "hal.h"
+#include <stddef.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Función que apaga la pantalla y detiene la interrupción periódica, el reloj sigue en el RTC
+ *
+ */
+static void TurnOffDisplay(void);
+
+/**
+ * @brief Función que prende la pantalla con la hora actual y vuelve a iniciar la interrupción periódica
+ *
+ * Se llama desde la interrupción que despierta al procesador.
+ *
+ * @param keys true si despertó una tecla, que no se toma como evento hasta soltar todas
+ */
+static void WakeUp(bool keys);
+
+/**
+ * @brief Función que atiende la interrupción de las teclas con la pantalla apagada
+ *
+ */
+static void KeysChanged(void);
+
+/**
+ * @brief Función que descarta los flancos de todas las teclas
+ *
+ * @return true si alguna tecla sigue presionada
+ */
+static bool KeysActive(void);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Reloj que se suspende con la pantalla apagada
+static HAL_BOARD_LOCAL clock_p clock;
+
+//! Poncho con la pantalla y las teclas
+static HAL_BOARD_LOCAL shield_p shield;
+
+//! Funciones que se llaman al apagar y al prender la pantalla
+static HAL_BOARD_LOCAL app_suspend_driver_p suspend_driver;
+
+//! Segundos sin usar las teclas hasta apagar la pantalla, 0 no la apaga
+static HAL_BOARD_LOCAL uint16_t display_timeout = 0;
+
+//! Milisegundos desde el último evento de las teclas o de la consola
+static HAL_BOARD_LOCAL uint32_t idle_ms = 0;
+
+//! Indica que la pantalla está apagada y la interrupción periódica detenida
+static HAL_BOARD_LOCAL volatile bool display_off = false;
+
+//! Indica que una tecla despertó al procesador y se ignoran las teclas hasta soltarlas todas
+static HAL_BOARD_LOCAL volatile bool wake_hold = false;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void TurnOffDisplay(void) {
+    bool suspended = false;
+
+    // La interrupción del RTC o de las teclas no debe llegar con el reloj a medio suspender
+    HalInterruptsDisable();
+    if (ClockSuspend(clock)) {
+        HalTickEnable(false);
+        DisplayTurnOff(shield->display);
+        display_off = true;
+        ShieldWakeOnKeys(KeysChanged);
+        suspended = true;
+    }
+    HalInterruptsEnable();
+    idle_ms = 0;
+    if (suspended) {
+        suspend_driver->Suspended();
+    }
+}
+
+static void WakeUp(bool keys) {
+    if (display_off) {
+        display_off = false;
+        ShieldWakeOnKeys(NULL);
+        ClockResume(clock);
+        wake_hold = keys;
+        suspend_driver->Resumed();
+        HalTickEnable(true);
+    }
+}
+
+static void KeysChanged(void) {
+    WakeUp(true);
+}
+
+static bool KeysActive(void) {
+    digital_input_p keys[] = {shield->set_time,  shield->set_alarm, shield->incremet,
+                              shield->decrement, shield->accept,    shield->cancel};
+    bool result = false;
+
+    for (size_t index = 0; index < sizeof(keys) / sizeof(keys[0]); index++) {
+        DigitalInputWasChanged(keys[index]);
+        result = DigitalInputGetIsActive(keys[index]) || result;
+    }
+
+    return result;
+}
+
+/* === Public function definitions ================================================================================= */
+
+void AppSuspendInit(clock_p reference, shield_p board, uint16_t timeout, app_suspend_driver_p driver) {
+    clock = reference;
+    shield = board;
+    suspend_driver = driver;
+    display_timeout = timeout;
+    idle_ms = 0;
+    display_off = false;
+    wake_hold = false;
+}
+
+void AppSuspendIdle(uint32_t elapsed, bool used, bool allowed) {
+    idle_ms = used ? 0 : idle_ms + elapsed;
+    if (display_timeout != 0 && idle_ms >= (uint32_t)display_timeout * 1000 && allowed) {
+        TurnOffDisplay();
+    }
+}
+
+bool AppSuspendKeysHeld(void) {
+    bool result = wake_hold;
+
+    if (result) {
+        wake_hold = KeysActive();
+    }
+
+    return result;
+}
+
+void AppSuspendRtcAlarm(void) {
+    WakeUp(false);
+}
+
+uint16_t AppSuspendGetTimeout(void) {
+    return display_timeout;
+}
+
+void AppSuspendSetTimeout(uint16_t timeout) {
+    display_timeout = timeout;
+}
+
+/* === End of documentation ======================================================================================== */
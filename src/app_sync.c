@@ -0,0 +1,122 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file app_sync.c
+ ** @brief Código fuente de la sincronización de la hora de la aplicación con el servidor - Electrónica 4 2025
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "app_sync.h"
+#include "console.h"
+#include "hal.h"
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Función que lee la hora del reloj sin que la interrupción periódica la cambie a la mitad
+ *
+ * @return milisegundos desde 1970
+ */
+static int64_t ClockNow(void);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Reloj que se corrige
+static HAL_BOARD_LOCAL clock_p clock;
+
+//! Estado de la sincronización de la hora con el servidor
+static HAL_BOARD_LOCAL time_sync_t time_sync;
+
+//! Segundos entre pedidos de la hora al servidor, 0 solo con la orden sync
+static HAL_BOARD_LOCAL uint16_t sync_period = 0;
+
+//! Segundos desde el último pedido de la hora al servidor
+static HAL_BOARD_LOCAL uint16_t sync_elapsed = 0;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static int64_t ClockNow(void) {
+    int64_t result;
+
+    HalInterruptsDisable();
+    result = ClockGetEpochMilliseconds(clock);
+    HalInterruptsEnable();
+
+    return result;
+}
+
+/* === Public function definitions ================================================================================= */
+
+void AppSyncInit(clock_p reference, uint16_t period) {
+    clock = reference;
+    TimeSyncInit(&time_sync);
+    sync_period = period;
+    sync_elapsed = 0;
+}
+
+void AppSyncTask(void) {
+    if (sync_period != 0) {
+        sync_elapsed++;
+        if (sync_elapsed >= sync_period) {
+            sync_elapsed = 0;
+            AppSyncRequest();
+        }
+    }
+}
+
+void AppSyncRequest(void) {
+    ConsolePrint("sync %u\r\n", TimeSyncRequest(&time_sync, ClockNow()));
+}
+
+int AppSyncResponse(uint32_t sequence, int64_t received, uint32_t hold, time_sync_sample_t * sample) {
+    int result = -1;
+
+    if (TimeSyncResponse(&time_sync, sequence, received, hold, ClockNow(), sample) == 0) {
+        HalInterruptsDisable();
+        if (ClockIsTimeValid(clock)) {
+            if (sample->offset >= -CLOCK_ADJUST_LIMIT && sample->offset <= CLOCK_ADJUST_LIMIT &&
+                ClockAdjustTime(clock, (int32_t)sample->offset)) {
+                result = 0;
+            }
+        } else if (ClockSetEpochMilliseconds(clock, ClockGetEpochMilliseconds(clock) + sample->offset)) {
+            result = 1;
+        }
+        HalInterruptsEnable();
+    }
+
+    return result;
+}
+
+uint16_t AppSyncGetPeriod(void) {
+    return sync_period;
+}
+
+void AppSyncGetState(time_sync_t * state) {
+    memcpy(state, &time_sync, sizeof(time_sync_t));
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,251 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file app_telemetry.c
+ ** @brief Código fuente de la telemetría de la aplicación - Electrónica 4 2025
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "app_telemetry.h"
+#include "app.h"
+#include "console.h"
+#include "event_trace.h"
+#include "hal.h"
+#include "profiler.h"
+#include "telemetry.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Función que envía las tramas de estado, de las regiones medidas y de los eventos nuevos de la alarma
+ *
+ */
+static void SendTelemetry(void);
+
+/**
+ * @brief Función que codifica una trama de telemetría y la agrega a la consola si entra entera
+ *
+ * @param type tipo de trama
+ * @param payload contenido
+ * @param size bytes del contenido
+ */
+static void SendFrame(uint8_t type, const void * payload, size_t size);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Función que devuelve los datos de la última interrupción periódica
+static HAL_BOARD_LOCAL app_telemetry_tick_p last_tick = NULL;
+
+//! Milisegundos que pasan en cada interrupción periódica
+static HAL_BOARD_LOCAL uint32_t tick_period_ms = 1;
+
+//! Periodo de la interrupción periódica en cuentas de HalCycleCounter
+static HAL_BOARD_LOCAL uint32_t tick_period_counts = 0;
+
+//! Segundos entre envíos de la telemetría, 0 no se envía
+static HAL_BOARD_LOCAL uint16_t telemetry_period = 0;
+
+//! Segundos desde el último envío de la telemetría
+static HAL_BOARD_LOCAL uint16_t telemetry_elapsed = 0;
+
+//! Número de la próxima trama de telemetría
+static HAL_BOARD_LOCAL uint8_t telemetry_sequence = 0;
+
+//! Tramas de telemetría descartadas porque no entraban en el buffer de envío
+static HAL_BOARD_LOCAL uint32_t telemetry_skipped = 0;
+
+//! Próximo registro del trazado de eventos que se revisa para la telemetría
+static HAL_BOARD_LOCAL uint32_t telemetry_cursor = 0;
+
+//! Disparo y milisegundos de la interrupción periódica en la última llamada a la tarea de telemetría
+static HAL_BOARD_LOCAL uint32_t drift_fired = 0;
+static HAL_BOARD_LOCAL uint32_t drift_milliseconds = 0;
+
+//! Indica si ya se tomó la primera referencia para medir la deriva
+static HAL_BOARD_LOCAL bool drift_started = false;
+
+//! Cuentas de HalCycleCounter que pasaron de más respecto de los ticks contados
+static HAL_BOARD_LOCAL int64_t tick_drift = 0;
+
+//! Veces que empezó a sonar la alarma
+static HAL_BOARD_LOCAL volatile uint32_t alarm_rings = 0;
+
+//! Veces que se pospuso la alarma
+static HAL_BOARD_LOCAL uint32_t alarm_snoozes = 0;
+
+//! Pulsaciones de cada botón
+static HAL_BOARD_LOCAL uint32_t button_presses[TELEMETRY_BUTTONS];
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void SendTelemetry(void) {
+    telemetry_status_t status = {0};
+    telemetry_region_t region;
+    telemetry_event_t events[TELEMETRY_MAX_EVENTS];
+    profiler_region_t measured;
+    app_deadline_stats_t deadlines;
+    event_trace_record_t record;
+    uint32_t fired;
+    uint32_t milliseconds;
+    uint32_t sequence;
+    size_t length;
+    size_t count = 0;
+
+    AppGetDeadlineStats(&deadlines);
+    last_tick(&fired, &milliseconds);
+    status.uptime = milliseconds / 1000;
+    status.tick_drift = (int32_t)((tick_drift > INT32_MAX) ? INT32_MAX : (tick_drift < INT32_MIN) ? INT32_MIN
+                                                                                                     : tick_drift);
+    status.tick_period = deadlines.tick_period;
+    status.tick_worst = deadlines.tick_worst;
+    status.tick_overruns = deadlines.tick_overruns;
+    status.loop_worst = deadlines.loop_worst;
+    status.loop_skipped = deadlines.loop_skipped;
+    status.loop_wakeups = deadlines.loop_wakeups;
+    status.loop_busy = deadlines.loop_busy;
+    status.alarm_rings = alarm_rings;
+    status.alarm_snoozes = alarm_snoozes;
+    status.frames_skipped = telemetry_skipped;
+    memcpy(status.buttons, button_presses, sizeof(status.buttons));
+    SendFrame(TELEMETRY_STATUS, &status, sizeof(status));
+
+    for (size_t index = 0; ProfilerSnapshot(index, &measured) == 0; index++) {
+        // El nombre se recorta sin el cero final si ocupa todo el campo
+        memset(&region, 0, sizeof(region));
+        length = strlen(measured.name);
+        memcpy(region.name, measured.name, (length < sizeof(region.name)) ? length : sizeof(region.name));
+        region.count = measured.count;
+        region.duration = measured.duration;
+        region.latency = measured.latency;
+        SendFrame(TELEMETRY_REGION, &region, sizeof(region));
+    }
+
+    // Solo se envían los eventos de la alarma, el resto se puede leer con la orden trace
+    while (EventTraceRead(&telemetry_cursor, &sequence, &record) == 0) {
+        if (record.event == EVENT_TRACE_ALARM_FIRED || record.event == EVENT_TRACE_ALARM_SNOOZED ||
+            record.event == EVENT_TRACE_ALARM_OFF || record.event == EVENT_TRACE_ALARM_SET) {
+            events[count].sequence = sequence;
+            events[count].record = record;
+            count++;
+        }
+        if (count == TELEMETRY_MAX_EVENTS) {
+            SendFrame(TELEMETRY_EVENTS, events, count * sizeof(telemetry_event_t));
+            count = 0;
+        }
+    }
+    if (count > 0) {
+        SendFrame(TELEMETRY_EVENTS, events, count * sizeof(telemetry_event_t));
+    }
+}
+
+static void SendFrame(uint8_t type, const void * payload, size_t size) {
+    uint8_t frame[TELEMETRY_MAX_FRAME];
+    size_t length = TelemetryEncode(type, telemetry_sequence, payload, size, frame);
+
+    // Una trama recortada no se puede decodificar, si no entra entera se descarta
+    if (length > 0 && length <= ConsoleFree()) {
+        ConsoleWrite((const char *)frame, length);
+        telemetry_sequence++;
+    } else {
+        telemetry_skipped++;
+    }
+}
+
+/* === Public function definitions ================================================================================= */
+
+void AppTelemetryInit(app_telemetry_tick_p tick, uint16_t period, uint32_t period_ms, uint32_t period_counts) {
+    last_tick = tick;
+    tick_period_ms = period_ms;
+    tick_period_counts = period_counts;
+    telemetry_period = period;
+    telemetry_elapsed = 0;
+    telemetry_sequence = 0;
+    telemetry_skipped = 0;
+    telemetry_cursor = 0;
+    drift_started = false;
+    drift_fired = 0;
+    drift_milliseconds = 0;
+    tick_drift = 0;
+    alarm_rings = 0;
+    alarm_snoozes = 0;
+    memset(button_presses, 0, sizeof(button_presses));
+}
+
+void AppTelemetryTask(void) {
+    uint32_t fired;
+    uint32_t now;
+
+    // El contador de ciclos da la vuelta en unos 21 s en la placa, por eso la deriva se acumula en cada llamada. Se
+    // comparan los disparos de las interrupciones para que la demora de esta tarea no se cuente como deriva.
+    last_tick(&fired, &now);
+    if (drift_started) {
+        tick_drift += (int64_t)(fired - drift_fired) -
+                      (int64_t)((now - drift_milliseconds) / tick_period_ms) * (int64_t)tick_period_counts;
+    }
+    drift_started = true;
+    drift_fired = fired;
+    drift_milliseconds = now;
+
+    if (telemetry_period != 0) {
+        telemetry_elapsed++;
+        if (telemetry_elapsed >= telemetry_period) {
+            telemetry_elapsed = 0;
+            SendTelemetry();
+        }
+    }
+}
+
+uint16_t AppTelemetryGetPeriod(void) {
+    return telemetry_period;
+}
+
+void AppTelemetrySetPeriod(uint16_t period) {
+    telemetry_period = period;
+    telemetry_elapsed = 0;
+}
+
+void AppTelemetryRestartDrift(void) {
+    drift_started = false;
+}
+
+void AppTelemetryCountRing(void) {
+    alarm_rings++;
+}
+
+void AppTelemetryCountSnoozes(uint32_t snoozes) {
+    alarm_snoozes += snoozes;
+}
+
+void AppTelemetryCountButton(uint8_t button) {
+    if (button < TELEMETRY_BUTTONS) {
+        button_presses[button]++;
+    }
+}
+
+/* === End of documentation ======================================================================================== */
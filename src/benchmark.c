@@ -0,0 +1,319 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file benchmark.c
+ ** @brief Código fuente de las mediciones del costo de los caminos críticos del reloj - Electrónica 4 2025
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "benchmark.h"
+#include "calendar.h"
+#include "clock.h"
+#include "display.h"
+#include "digital_input.h"
+#include "hal.h"
+#include "shield.h"
+#include "timers.h"
+#include "world_clock.h"
+#include <stdbool.h>
+#include <stdio.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! Frecuencia del reloj medido, la misma que usa la aplicación
+#define BENCHMARK_TICKS_PER_SECOND 1000
+
+/* === Private data type declarations ============================================================================== */
+
+//! Objetos sobre los que se miden las operaciones
+typedef struct benchmark_context_s {
+    clock_p clock;        //!< reloj
+    world_clock_p view;   //!< vista de otra zona sobre el reloj
+    shield_p shield;      //!< poncho con el display y las teclas
+    clock_time_u time;    //!< hora leída o escrita
+    uint8_t bcd[4];       //!< números que se escriben en el display
+    int32_t days;         //!< días desde 1970 que se convierten en fecha
+    calendar_date_t date; //!< fecha convertida
+} benchmark_context_t;
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Operación vacía que se usa para medir el costo del lazo y de la llamada indirecta
+ *
+ */
+static void Empty(void * context);
+
+/**
+ * @brief Función que mide un lote de operaciones
+ *
+ * @param operation operación a medir
+ * @param context contexto de la operación
+ * @return cuentas del contador de ciclos que demoró el lote
+ */
+static uint32_t MeasureBatch(benchmark_operation_p operation, void * context);
+
+/**
+ * @brief Función que calcula la raíz cuadrada entera
+ *
+ * @param value número
+ * @return parte entera de la raíz cuadrada
+ */
+static uint32_t SquareRoot(uint64_t value);
+
+/**
+ * @brief Funciones que no hacen nada en lugar de prender y apagar el zumbador
+ *
+ */
+static void AlarmNothing(void);
+
+/**
+ * @brief Operaciones que se miden, cada una llama a la función del mismo nombre con los objetos del contexto
+ *
+ */
+static void NewTick(void * context);
+static void GetTime(void * context);
+static void SetTime(void * context);
+static void WriteBCD(void * context);
+static void Refresh(void * context);
+static void WasChanged(void * context);
+static void CivilFromDays(void * context);
+static void DaysFromCivil(void * context);
+static void Tick(void * context);
+static void ViewGetTime(void * context);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Controlador de la alarma que no actúa sobre el hardware
+static const struct clock_alarm_driver_s alarm_driver = {
+    .TurnOffAlarm = AlarmNothing,
+    .TurnOnAlarm = AlarmNothing,
+};
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void Empty(void * context) {
+    (void)context;
+}
+
+static uint32_t MeasureBatch(benchmark_operation_p operation, void * context) {
+    uint32_t start;
+    uint32_t index;
+
+    start = HalCycleCounter();
+    for (index = 0; index < BENCHMARK_ITERATIONS; index++) {
+        operation(context);
+    }
+
+    return HalCycleCounter() - start;
+}
+
+static uint32_t SquareRoot(uint64_t value) {
+    uint64_t result = 0;
+    uint64_t bit = 1ULL << 62;
+
+    while (bit > value) {
+        bit >>= 2;
+    }
+    while (bit != 0) {
+        if (value >= result + bit) {
+            value -= result + bit;
+            result = (result >> 1) + bit;
+        } else {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    return (uint32_t)result;
+}
+
+static void AlarmNothing(void) {
+}
+
+static void NewTick(void * context) {
+    ClockNewTick(((benchmark_context_t *)context)->clock);
+}
+
+static void GetTime(void * context) {
+    benchmark_context_t * self = context;
+
+    ClockGetTime(self->clock, &self->time);
+}
+
+static void SetTime(void * context) {
+    benchmark_context_t * self = context;
+
+    ClockSetTime(self->clock, &self->time);
+}
+
+static void WriteBCD(void * context) {
+    benchmark_context_t * self = context;
+
+    DisplayWriteBCD(self->shield->display, self->bcd, sizeof(self->bcd));
+}
+
+static void Refresh(void * context) {
+    DisplayRefresh(((benchmark_context_t *)context)->shield->display);
+}
+
+static void WasChanged(void * context) {
+    DigitalInputWasChanged(((benchmark_context_t *)context)->shield->accept);
+}
+
+static void CivilFromDays(void * context) {
+    benchmark_context_t * self = context;
+
+    // Cada operación convierte un día distinto, así se recorren todos los meses y los cambios de año
+    CalendarCivilFromDays(self->days++, &self->date);
+}
+
+static void DaysFromCivil(void * context) {
+    benchmark_context_t * self = context;
+
+    self->days = CalendarDaysFromCivil(&self->date);
+}
+
+static void Tick(void * context) {
+    (void)context;
+    TimersTick(1);
+}
+
+static void ViewGetTime(void * context) {
+    benchmark_context_t * self = context;
+
+    // Cambiar el desplazamiento descarta la hora guardada, así cada operación calcula la hora y la fecha de la vista
+    WorldClockSetOffset(self->view, 9 * 3600);
+    WorldClockGetTime(self->view, &self->time);
+}
+
+/* === Public function definitions ================================================================================= */
+
+void BenchmarkRun(const char * name, benchmark_operation_p operation, void * context, benchmark_result_t * result) {
+    uint32_t samples[BENCHMARK_SAMPLES];
+    uint32_t elapsed, overhead, value;
+    uint64_t sum = 0, squares = 0;
+    uint16_t sample, index;
+
+    HalCycleCounterStart();
+    // Un lote previo para que el código y los datos ya estén en la cache y en el predictor de saltos
+    MeasureBatch(operation, context);
+
+    for (sample = 0; sample < BENCHMARK_SAMPLES; sample++) {
+        overhead = MeasureBatch(Empty, context);
+        elapsed = MeasureBatch(operation, context);
+        elapsed = (elapsed > overhead) ? elapsed - overhead : 0;
+        value = (uint32_t)((uint64_t)elapsed * 1000 / BENCHMARK_ITERATIONS);
+
+        // Inserción ordenada, las muestras son pocas
+        for (index = sample; index > 0 && samples[index - 1] > value; index--) {
+            samples[index] = samples[index - 1];
+        }
+        samples[index] = value;
+        sum += value;
+        squares += (uint64_t)value * value;
+    }
+
+    result->name = name;
+    result->frequency = HalCycleCounterFrequency();
+    result->iterations = BENCHMARK_ITERATIONS;
+    result->samples = BENCHMARK_SAMPLES;
+    result->min = samples[0];
+    result->median = samples[BENCHMARK_SAMPLES / 2];
+    result->max = samples[BENCHMARK_SAMPLES - 1];
+    result->mean = (uint32_t)(sum / BENCHMARK_SAMPLES);
+    result->stddev = SquareRoot(squares / BENCHMARK_SAMPLES - (uint64_t)result->mean * result->mean);
+}
+
+int BenchmarkFormat(const benchmark_result_t * result, const char * unit, char * buffer, size_t size) {
+    return snprintf(buffer, size,
+                    "{\"name\":\"%s\",\"unit\":\"%s\",\"frequency\":%lu,\"iterations\":%lu,\"samples\":%u,"
+                    "\"min\":%lu.%03lu,\"median\":%lu.%03lu,\"mean\":%lu.%03lu,\"max\":%lu.%03lu,"
+                    "\"stddev\":%lu.%03lu}\n",
+                    result->name, unit, (unsigned long)result->frequency, (unsigned long)result->iterations,
+                    (unsigned)result->samples, (unsigned long)(result->min / 1000),
+                    (unsigned long)(result->min % 1000), (unsigned long)(result->median / 1000),
+                    (unsigned long)(result->median % 1000), (unsigned long)(result->mean / 1000),
+                    (unsigned long)(result->mean % 1000), (unsigned long)(result->max / 1000),
+                    (unsigned long)(result->max % 1000), (unsigned long)(result->stddev / 1000),
+                    (unsigned long)(result->stddev % 1000));
+}
+
+int BenchmarkSuiteRun(benchmark_report_p report) {
+    static const clock_time_u time = {
+        .time = {.hours = {3, 2}, .minutes = {9, 5}, .seconds = {8, 4}},
+    };
+    benchmark_context_t context = {
+        .time = time,
+        .bcd = {1, 2, 3, 4},
+        .days = 20089, // 2025-01-01
+    };
+    benchmark_result_t result;
+    uint8_t index;
+    int status = -1;
+
+    context.clock = ClockCreate(BENCHMARK_TICKS_PER_SECOND, &alarm_driver, 300);
+    context.shield = ShieldCreate();
+
+    if (context.clock != NULL && context.shield != NULL) {
+        ClockSetTime(context.clock, &time);
+
+        BenchmarkRun("ClockNewTick", NewTick, &context, &result);
+        report(&result);
+        BenchmarkRun("ClockGetTime", GetTime, &context, &result);
+        report(&result);
+        BenchmarkRun("ClockSetTime", SetTime, &context, &result);
+        report(&result);
+        BenchmarkRun("DisplayWriteBCD", WriteBCD, &context, &result);
+        report(&result);
+        BenchmarkRun("DisplayRefresh", Refresh, &context, &result);
+        report(&result);
+        BenchmarkRun("DigitalInputWasChanged", WasChanged, &context, &result);
+        report(&result);
+        BenchmarkRun("CalendarCivilFromDays", CivilFromDays, &context, &result);
+        report(&result);
+        BenchmarkRun("CalendarDaysFromCivil", DaysFromCivil, &context, &result);
+        report(&result);
+
+        // Con el pool lleno y todo andando, ningún temporizador termina durante la medición
+        TimersInit();
+        for (index = 0; index < TIMERS_STOPWATCHES; index++) {
+            StopwatchStart(StopwatchCreate());
+        }
+        for (index = 0; index < TIMERS_COUNTDOWNS; index++) {
+            CountdownStart(CountdownCreate(NULL, NULL), TIMERS_MAX_DURATION);
+        }
+        BenchmarkRun("TimersTick", Tick, &context, &result);
+        report(&result);
+
+        WorldClockInit();
+        context.view = WorldClockCreate(context.clock, 9 * 3600);
+        BenchmarkRun("WorldClockGetTime", ViewGetTime, &context, &result);
+        report(&result);
+        status = 0;
+    }
+
+    return status;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,99 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file calendar.c
+ ** @brief Código fuente de la conversión entre días y fechas del calendario gregoriano - Electrónica 4 2025
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "calendar.h"
+
+/* === Macros definitions ========================================================================================== */
+
+//! Días de una era de 400 años
+#define DAYS_PER_ERA       146097L
+
+//! Días desde el 1 de marzo del año 0 hasta el 1 de enero de 1970
+#define DAYS_TO_UNIX_EPOCH 719468L
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+/* === Public function definitions ================================================================================= */
+
+int32_t CalendarDaysFromCivil(const calendar_date_t * date) {
+    // Los años empiezan el 1 de marzo, enero y febrero son los últimos meses del año anterior
+    int32_t year = date->year - (date->month <= 2);
+    int32_t era = (year >= 0 ? year : year - 399) / 400;
+    uint32_t year_of_era = (uint32_t)(year - era * 400);
+    uint32_t month = (date->month > 2) ? date->month - 3U : date->month + 9U;
+    uint32_t day_of_year = (153U * month + 2U) / 5U + date->day - 1U;
+    uint32_t day_of_era = year_of_era * 365U + year_of_era / 4U - year_of_era / 100U + day_of_year;
+
+    return era * DAYS_PER_ERA + (int32_t)day_of_era - DAYS_TO_UNIX_EPOCH;
+}
+
+void CalendarCivilFromDays(int32_t days, calendar_date_t * date) {
+    int32_t shifted = days + DAYS_TO_UNIX_EPOCH;
+    int32_t era = (shifted >= 0 ? shifted : shifted - (DAYS_PER_ERA - 1)) / DAYS_PER_ERA;
+    uint32_t day_of_era = (uint32_t)(shifted - era * DAYS_PER_ERA);
+    // Descuenta los días bisiestos que faltan en los años múltiplos de 100 para dividir por 365
+    uint32_t year_of_era = (day_of_era - day_of_era / 1460U + day_of_era / 36524U - day_of_era / 146096U) / 365U;
+    uint32_t day_of_year = day_of_era - (365U * year_of_era + year_of_era / 4U - year_of_era / 100U);
+    uint32_t month = (5U * day_of_year + 2U) / 153U;
+
+    date->day = (uint8_t)(day_of_year - (153U * month + 2U) / 5U + 1U);
+    date->month = (uint8_t)((month < 10U) ? month + 3U : month - 9U);
+    date->year = (int16_t)((int32_t)year_of_era + era * 400 + (date->month <= 2));
+    date->weekday = CalendarWeekday(days);
+}
+
+uint8_t CalendarWeekday(int32_t days) {
+    // El 1 de enero de 1970 fue jueves
+    return (uint8_t)((days >= -4) ? (days + 4) % 7 : (days + 5) % 7 + 6);
+}
+
+uint8_t CalendarDaysInMonth(int16_t year, uint8_t month) {
+    uint8_t result;
+
+    if (month == 2) {
+        result = ((year % 4 == 0) && ((year % 100 != 0) || (year % 400 == 0))) ? 29 : 28;
+    } else {
+        // Los meses alternan 31 y 30 días de enero a julio y otra vez desde agosto
+        result = (uint8_t)(30 + ((month + (month >> 3)) & 1));
+    }
+
+    return result;
+}
+
+bool CalendarValidDate(const calendar_date_t * date) {
+    return date->month >= 1 && date->month <= 12 && date->day >= 1 &&
+           date->day <= CalendarDaysInMonth(date->year, date->month);
+}
+
+/* === End of documentation ======================================================================================== */
@@ -24,27 +24,74 @@ SPDX-License-Identifier: MIT
 /* === Headers files inclusions ==================================================================================== */
 
 #include "clock.h"
+#include "config.h"
+#include "event_trace.h"
 #include <stddef.h>
+#include <stdlib.h>
 #include <string.h>
 
 /* === Macros definitions ========================================================================================== */
 
+//! Casilleros de las funciones programadas: los segundos del minuto, los minutos de la hora y las horas del día
+#define HOOK_SECONDS     0
+#define HOOK_MINUTES     60
+#define HOOK_HOURS       120
+#define HOOK_BUCKETS     144
+
+//! Índice que indica que no hay una función programada
+#define HOOK_NONE        UINT8_MAX
+
 /* === Private data type declarations ============================================================================== */
 
+//! Función programada en el reloj
+typedef struct hook_s {
+    clock_hook_p callback; //!< función que se llama, NULL si el lugar está libre
+    void * context;        //!< dato que recibe la función
+    uint32_t time;         //!< hora de la función, en segundos desde las 00:00:00
+    uint32_t deadline;     //!< próximo segundo del día en el que se llama a la función
+    uint8_t kind;          //!< momento en el que se llama, ver @ref clock_hook_e
+    uint8_t bucket;        //!< casillero en el que está guardada
+    uint8_t next;          //!< siguiente función del casillero, @ref HOOK_NONE si es la última
+    uint8_t previous;      //!< función anterior del casillero, @ref HOOK_NONE si es la primera
+} hook_t;
+
 struct clock_s {
     clock_time_u current_time;         //!< hora actual
     clock_time_u current_alarm;        //!< hora de la alarma
     uint32_t current_alarm_in_seconds; //!< hora de la alarma en segundos desde las 00:00:00
+    uint8_t alarm_days;                //!< días de la semana en los que suena la alarma, un bit por día
+    bool alarm_one_shot;               //!< indica si la alarma se desactiva después de sonar
+    int32_t alarm_day;                 //!< día de la próxima alarma, días desde 1970
+    int32_t alarm_skipped_day;         //!< día en el que no suena la alarma, @ref CLOCK_NO_DAY si no se saltea
+    int64_t alarm_deadline;            //!< instante UTC de la próxima alarma, @ref CLOCK_ALARM_NEVER si no suena
     bool valid;                        //!< indica si la hora del reloj es valida
     bool alarm_set;                    //!< indica si alarma se configuro alguna vez
     bool alarm_is_ringing;             //!< indica si la alarma esta sonado
     bool alarm_is_activated;           //!< indica si la alarma esta desactivada
-    bool snooze_alarm;                 //!< indica si se pospuso la alarma
     uint32_t seconds_counter;          //!< cantidad de segundos desde las 00:00:00
+    int64_t epoch_seconds;             //!< segundos UTC desde el 1 de enero de 1970 a las 00:00:00
+    int32_t days;                      //!< días desde el 1 de enero de 1970 hasta la fecha local
+    calendar_date_t date;              //!< fecha local, se convierte una sola vez por día
+    const timezone_t * zone;           //!< zona horaria, NULL si la hora local es la hora UTC
+    int32_t utc_offset;                //!< segundos que se suman a la hora UTC para obtener la hora local
+    int64_t next_transition;           //!< instante UTC del próximo cambio del desplazamiento
     uint32_t seconds_snoozed;          //!< cantidad de segundos que se pospone la alarma
+    clock_alarm_policy_t policy;       //!< límites de la alarma que suena y de sus posposiciones
+    uint8_t snooze_count;              //!< veces que se pospuso la alarma desde que empezó a sonar
+    int64_t snooze_deadline;           //!< instante UTC en el que termina la posposición, o @ref CLOCK_ALARM_NEVER
+    int64_t ring_deadline;             //!< instante UTC en el que se apaga sola la alarma, o @ref CLOCK_ALARM_NEVER
     uint16_t ticks_per_second;         //!< cantidad de llamadas a @ref ClockNewTick que equivalen a un segundo
     uint16_t ticks_counter;            //!< canntidad de veces que se llamó a @ref ClockNewTick
+    int32_t slew_ticks;                //!< ticks que faltan agregar, o saltear si es negativo, para corregir la hora
+    uint16_t slew_phase;               //!< ticks desde el último tick agregado o salteado
     clock_alarm_driver_p alarm_driver; //! punteros a función para controlar la alarma
+    clock_rtc_driver_p rtc;            //!< RTC que mantiene la hora con el reloj suspendido, NULL si no hay
+    int64_t rtc_offset;                //!< segundos que se suman a los del RTC para obtener los segundos UTC
+    bool rtc_stale;                    //!< indica que hay que guardar la hora en el RTC al empezar un segundo
+    bool rtc_aligning;                 //!< indica que el segundo termina cuando cambia el segundo del RTC
+    bool suspended;                    //!< indica que no se cuentan los ticks hasta @ref ClockResume()
+    hook_t hooks[CLOCK_HOOKS];         //!< funciones programadas
+    uint8_t buckets[HOOK_BUCKETS];     //!< primera función programada de cada casillero
 };
 
 /* === Private function declarations =============================================================================== */
@@ -87,8 +134,157 @@ static void SecondsToTime(uint32_t seconds, uint8_t * time);
  */
 static uint32_t BcdTimeToSeconds(const uint8_t * bcd_time);
 
+/**
+ * @brief Función que calcula los segundos UTC después de cambiar la fecha o la hora local
+ *
+ * Una hora local que no existe porque se adelantó el reloj al empezar el horario de verano se corre al horario nuevo.
+ *
+ * @param clock referencia al reloj
+ */
+static void LocalToUtc(clock_p clock);
+
+/**
+ * @brief Función que calcula la fecha y la hora local a partir de los segundos UTC y del desplazamiento
+ *
+ * @param clock referencia al reloj
+ * @param same_instant true si el instante UTC no cambió, así la alarma que ya sonó en este segundo no vuelve a sonar
+ */
+static void UtcToLocal(clock_p clock, bool same_instant);
+
+/**
+ * @brief Función que avanza el reloj un tick y compara la alarma y las funciones programadas al cambiar el segundo
+ *
+ * @param clock referencia al reloj
+ */
+static void AdvanceTick(clock_p clock);
+
+/**
+ * @brief Función que apaga, vuelve a encender o enciende la alarma al alcanzar sus instantes
+ *
+ * @param clock referencia al reloj
+ * @param alarm_due true si el instante de la alarma pasó aunque ya se haya calculado la próxima
+ */
+static void CheckDeadlines(clock_p clock, bool alarm_due);
+
+/**
+ * @brief Función que guarda la hora en el RTC, se llama al empezar un segundo
+ *
+ * @param clock referencia al reloj
+ */
+static void RtcSave(clock_p clock);
+
+/**
+ * @brief Función que adelanta el reloj hasta el instante leído del RTC al reanudarlo
+ *
+ * @param clock referencia al reloj
+ * @param now segundos UTC desde 1970, posteriores a los del reloj
+ */
+static void CatchUp(clock_p clock, int64_t now);
+
+/**
+ * @brief Función que aplica el cambio de desplazamiento de la zona horaria al alcanzar el instante del cambio
+ *
+ * Se llama desde @ref ClockNewTick(), solo mueve la hora local la diferencia entre los desplazamientos.
+ *
+ * @param clock referencia al reloj
+ */
+static void ApplyTransition(clock_p clock);
+
+/**
+ * @brief Función que calcula el instante UTC en el que suena la próxima alarma
+ *
+ * Busca el primer día desde hoy que está en los días de la alarma, sin contar el día salteado. Se llama al cambiar la
+ * alarma, la hora, la fecha o la zona y después de que suena, así @ref ClockNewTick() solo compara con un instante.
+ *
+ * @param clock referencia al reloj
+ * @param passed true si la alarma de hoy ya sonó aunque la hora sea la de la alarma
+ */
+static void ScheduleAlarm(clock_p clock, bool passed);
+
+/**
+ * @brief Función que indica si la hora local ya llegó a la alarma de hoy
+ *
+ * Es la misma condición con la que suena la alarma en @ref ClockNewTick(), se usa al volver a calcular la próxima
+ * alarma sin cambiar la hora para que la que acaba de sonar no vuelva a sonar en el mismo segundo.
+ *
+ * @param clock referencia al reloj
+ * @return true si la hora local es igual o posterior a la de la alarma
+ */
+static bool AlarmPassed(clock_p clock);
+
+/**
+ * @brief Función que enciende la alarma y calcula el instante en el que se apaga sola
+ *
+ * @param clock referencia al reloj
+ */
+static void RingAlarm(clock_p clock);
+
+/**
+ * @brief Función que apaga la alarma y termina la serie de posposiciones
+ *
+ * @param clock referencia al reloj
+ */
+static void SilenceAlarm(clock_p clock);
+
+/**
+ * @brief Función que calcula el próximo segundo del día en el que se llama a una función programada
+ *
+ * @param hook función programada
+ * @param now segundo actual del día, el resultado siempre es posterior salvo para @ref CLOCK_HOOK_TIME
+ * @return segundo del día
+ */
+static uint32_t HookDeadline(const hook_t * hook, uint32_t now);
+
+/**
+ * @brief Función que guarda una función programada en el casillero que corresponde a su próximo segundo
+ *
+ * Las funciones de la hora de first van a los casilleros de los segundos o de los minutos y las demás, también las
+ * que son anteriores a first y corresponden al día siguiente, a los casilleros de las horas.
+ *
+ * @param clock referencia al reloj
+ * @param index función programada
+ * @param first primer segundo del día que todavía no se revisó
+ */
+static void HookInsert(clock_p clock, uint8_t index, uint32_t first);
+
+/**
+ * @brief Función que saca una función programada de su casillero
+ *
+ * @param clock referencia al reloj
+ * @param index función programada
+ */
+static void HookUnlink(clock_p clock, uint8_t index);
+
+/**
+ * @brief Función que vuelve a repartir un casillero de los minutos o de las horas al empezar el minuto o la hora
+ *
+ * @param clock referencia al reloj
+ * @param bucket casillero a repartir
+ */
+static void HooksCascade(clock_p clock, uint8_t bucket);
+
+/**
+ * @brief Función que vuelve a repartir todas las funciones programadas después de un cambio de la hora local
+ *
+ * @param clock referencia al reloj
+ * @param pending true si todavía no se llamó a las funciones del segundo actual
+ */
+static void HooksRebuild(clock_p clock, bool pending);
+
+/**
+ * @brief Función que llama a las funciones programadas del segundo que empieza
+ *
+ * @param clock referencia al reloj
+ */
+static void HooksDispatch(clock_p clock);
+
 /* === Private variable definitions ================================================================================ */
 
+#ifndef USE_DYNAMIC_MEMORY
+//! Reloj del sistema, es usado en caso de NO tener memoria dinámica
+static struct clock_s instance;
+#endif
+
 /* === Public variable definitions ================================================================================= */
 
 /* === Private function definitions ================================================================================ */
@@ -147,31 +343,342 @@ static uint32_t BcdTimeToSeconds(const uint8_t * time) {
     return seconds;
 }
 
+static void LocalToUtc(clock_p self) {
+    int64_t local = (int64_t)self->days * CALENDAR_SECONDS_PER_DAY + self->seconds_counter;
+    int64_t previous = self->epoch_seconds;
+
+    if (self->zone != NULL) {
+        // El desplazamiento se busca con el instante que da el desplazamiento actual y después con el encontrado
+        self->utc_offset = TimezoneLookup(self->zone, local - self->utc_offset, &self->next_transition);
+        self->utc_offset = TimezoneLookup(self->zone, local - self->utc_offset, &self->next_transition);
+    }
+    self->epoch_seconds = local - self->utc_offset;
+    // La hora ajustada a mano reemplaza a la corrección pendiente
+    self->slew_ticks = 0;
+    self->rtc_stale = true;
+    self->rtc_aligning = false;
+
+    // La posposición y el apagado automático duran lo mismo aunque se cambie la hora
+    if (self->snooze_deadline != CLOCK_ALARM_NEVER) {
+        self->snooze_deadline += self->epoch_seconds - previous;
+    }
+    if (self->ring_deadline != CLOCK_ALARM_NEVER) {
+        self->ring_deadline += self->epoch_seconds - previous;
+    }
+    UtcToLocal(self, false);
+}
+
+static void UtcToLocal(clock_p self, bool same_instant) {
+    int64_t local = self->epoch_seconds + self->utc_offset;
+    int64_t days = local / (int64_t)CALENDAR_SECONDS_PER_DAY;
+
+    // Redondea hacia abajo también antes de 1970
+    if (days * (int64_t)CALENDAR_SECONDS_PER_DAY > local) {
+        days--;
+    }
+    self->days = (int32_t)days;
+    self->seconds_counter = (uint32_t)(local - days * (int64_t)CALENDAR_SECONDS_PER_DAY);
+    CalendarCivilFromDays(self->days, &self->date);
+    ScheduleAlarm(self, same_instant && AlarmPassed(self));
+    HooksRebuild(self, false);
+}
+
+static void ApplyTransition(clock_p self) {
+    int32_t delta = -self->utc_offset;
+    int32_t seconds;
+
+    self->utc_offset = TimezoneLookup(self->zone, self->epoch_seconds, &self->next_transition);
+    delta += self->utc_offset;
+
+    // La diferencia es menor que un día, la fecha cambia como máximo un día y sin divisiones
+    seconds = (int32_t)self->seconds_counter + delta;
+    if (seconds < 0) {
+        seconds += CALENDAR_SECONDS_PER_DAY;
+        self->days--;
+        CalendarCivilFromDays(self->days, &self->date);
+    } else if (seconds >= (int32_t)CALENDAR_SECONDS_PER_DAY) {
+        seconds -= CALENDAR_SECONDS_PER_DAY;
+        self->days++;
+        CalendarCivilFromDays(self->days, &self->date);
+    }
+    self->seconds_counter = (uint32_t)seconds;
+
+    // Al adelantar la hora la alarma salteada pasa al próximo día y al atrasarla la de hoy vuelve a sonar
+    ScheduleAlarm(self, false);
+    HooksRebuild(self, true);
+}
+
+static void ScheduleAlarm(clock_p self, bool passed) {
+    int32_t day = self->days;
+    uint8_t weekday = self->date.weekday;
+    uint8_t count;
+
+    self->alarm_day = CLOCK_NO_DAY;
+    self->alarm_deadline = CLOCK_ALARM_NEVER;
+    if (self->alarm_is_activated && (self->alarm_days & CLOCK_ALARM_EVERY_DAY) != 0) {
+        if (passed || self->seconds_counter > self->current_alarm_in_seconds) {
+            day++;
+            weekday = (weekday + 1) % 7;
+        }
+        // Una semana alcanza para encontrar un día de la alarma y uno más por si ese día se saltea
+        for (count = 0; count < 8 && self->alarm_day == CLOCK_NO_DAY; count++) {
+            if ((self->alarm_days & CLOCK_ALARM_DAY(weekday)) != 0 && day != self->alarm_skipped_day) {
+                self->alarm_day = day;
+            } else {
+                day++;
+                weekday = (weekday + 1) % 7;
+            }
+        }
+        if (self->alarm_day != CLOCK_NO_DAY) {
+            self->alarm_deadline = (int64_t)self->alarm_day * CALENDAR_SECONDS_PER_DAY;
+            self->alarm_deadline += (int64_t)self->current_alarm_in_seconds - self->utc_offset;
+        }
+    }
+}
+
+static bool AlarmPassed(clock_p self) {
+    return self->seconds_counter >= self->current_alarm_in_seconds;
+}
+
+static void RingAlarm(clock_p self) {
+    self->alarm_is_ringing = true;
+    self->alarm_driver->TurnOnAlarm();
+    self->ring_deadline = CLOCK_ALARM_NEVER;
+    if (self->policy.ring_timeout != 0) {
+        self->ring_deadline = self->epoch_seconds + self->policy.ring_timeout;
+    }
+}
+
+static void SilenceAlarm(clock_p self) {
+    self->alarm_is_ringing = false;
+    self->alarm_driver->TurnOffAlarm();
+    self->ring_deadline = CLOCK_ALARM_NEVER;
+    self->snooze_count = 0;
+}
+
+static uint32_t HookDeadline(const hook_t * hook, uint32_t now) {
+    uint32_t result;
+
+    switch (hook->kind) {
+    case CLOCK_HOOK_SECOND:
+        result = now + 1;
+        break;
+    case CLOCK_HOOK_MINUTE:
+        result = (now / 60 + 1) * 60;
+        break;
+    case CLOCK_HOOK_HOUR:
+        result = (now / 3600 + 1) * 3600;
+        break;
+    default:
+        result = hook->time;
+        break;
+    }
+
+    return result % CALENDAR_SECONDS_PER_DAY;
+}
+
+static void HookInsert(clock_p self, uint8_t index, uint32_t first) {
+    hook_t * hook = &self->hooks[index];
+    uint32_t deadline = hook->deadline;
+
+    if (deadline >= first && deadline / 3600 == first / 3600) {
+        hook->bucket = (deadline / 60 == first / 60) ? HOOK_SECONDS + deadline % 60
+                                                     : HOOK_MINUTES + (deadline / 60) % 60;
+    } else {
+        hook->bucket = HOOK_HOURS + deadline / 3600;
+    }
+
+    hook->previous = HOOK_NONE;
+    hook->next = self->buckets[hook->bucket];
+    if (hook->next != HOOK_NONE) {
+        self->hooks[hook->next].previous = index;
+    }
+    self->buckets[hook->bucket] = index;
+}
+
+static void HookUnlink(clock_p self, uint8_t index) {
+    hook_t * hook = &self->hooks[index];
+
+    if (hook->previous != HOOK_NONE) {
+        self->hooks[hook->previous].next = hook->next;
+    } else {
+        self->buckets[hook->bucket] = hook->next;
+    }
+    if (hook->next != HOOK_NONE) {
+        self->hooks[hook->next].previous = hook->previous;
+    }
+}
+
+static void HooksCascade(clock_p self, uint8_t bucket) {
+    uint8_t index = self->buckets[bucket];
+    uint8_t next;
+
+    self->buckets[bucket] = HOOK_NONE;
+    while (index != HOOK_NONE) {
+        next = self->hooks[index].next;
+        HookInsert(self, index, self->seconds_counter);
+        index = next;
+    }
+}
+
+static void HooksRebuild(clock_p self, bool pending) {
+    // Si ya se revisó el segundo actual una función programada para este segundo corresponde al día siguiente
+    uint32_t first = pending ? self->seconds_counter : self->seconds_counter + 1;
+    uint32_t previous = (first + CALENDAR_SECONDS_PER_DAY - 1) % CALENDAR_SECONDS_PER_DAY;
+    uint8_t index;
+
+    memset(self->buckets, HOOK_NONE, sizeof(self->buckets));
+    for (index = 0; index < CLOCK_HOOKS; index++) {
+        if (self->hooks[index].callback != NULL) {
+            self->hooks[index].deadline = HookDeadline(&self->hooks[index], previous);
+            HookInsert(self, index, first);
+        }
+    }
+}
+
+static void HooksDispatch(clock_p self) {
+    uint32_t now = self->seconds_counter;
+    uint8_t bucket = HOOK_SECONDS + now % 60;
+    uint8_t index;
+
+    if (now % 3600 == 0) {
+        HooksCascade(self, HOOK_HOURS + now / 3600);
+    }
+    if (now % 60 == 0) {
+        HooksCascade(self, HOOK_MINUTES + (now / 60) % 60);
+    }
+
+    // Cada función pasa a otro casillero antes de llamarla, así puede programar o quitar funciones
+    index = self->buckets[bucket];
+    while (index != HOOK_NONE) {
+        HookUnlink(self, index);
+        self->hooks[index].deadline = HookDeadline(&self->hooks[index], now);
+        HookInsert(self, index, now + 1);
+        self->hooks[index].callback(self, self->hooks[index].context);
+        index = (self->seconds_counter == now) ? self->buckets[bucket] : HOOK_NONE;
+    }
+}
+
+static void AdvanceTick(clock_p self) {
+    self->ticks_counter++;
+
+    if (self->ticks_counter == self->ticks_per_second) {
+        self->ticks_counter = 0;
+        self->seconds_counter++;
+        self->epoch_seconds++;
+    }
+
+    if (self->seconds_counter == CALENDAR_SECONDS_PER_DAY) {
+        self->seconds_counter = 0;
+        self->days++;
+        CalendarCivilFromDays(self->days, &self->date);
+    }
+
+    // La zona horaria solo se consulta al llegar al próximo cambio
+    if (self->epoch_seconds >= self->next_transition) {
+        ApplyTransition(self);
+    }
+
+    // La hora ajustada se guarda en el RTC al empezar un segundo, cuando ya no falta corregirla
+    if (self->ticks_counter == 0 && self->rtc_stale && self->slew_ticks == 0) {
+        RtcSave(self);
+    }
+
+    CheckDeadlines(self, false);
+
+    if (self->ticks_counter == 0) {
+        HooksDispatch(self);
+    }
+}
+
+static void CheckDeadlines(clock_p self, bool alarm_due) {
+    // Nadie atendió la alarma, se apaga sola hasta la próxima
+    if (self->epoch_seconds >= self->ring_deadline) {
+        SilenceAlarm(self);
+        EVENT_TRACE(EVENT_TRACE_ALARM_OFF, 1, 0);
+    }
+
+    if (self->epoch_seconds >= self->snooze_deadline) {
+        self->snooze_deadline = CLOCK_ALARM_NEVER;
+        RingAlarm(self);
+        EVENT_TRACE(EVENT_TRACE_ALARM_FIRED, 1, 0);
+    }
+
+    // Activa alarma, después de sonar se busca la próxima y no se vuelve a comparar en el mismo segundo
+    if (alarm_due || self->epoch_seconds >= self->alarm_deadline) {
+        EVENT_TRACE(EVENT_TRACE_ALARM_FIRED, 0, 0);
+        self->snooze_count = 0;
+        RingAlarm(self);
+        if (self->alarm_one_shot) {
+            self->alarm_is_activated = false;
+        }
+        ScheduleAlarm(self, true);
+    }
+}
+
+static void RtcSave(clock_p self) {
+    // El RTC cuenta segundos de 32 bits desde 1970
+    if (self->rtc != NULL && self->valid && self->epoch_seconds >= 0 && self->epoch_seconds <= UINT32_MAX) {
+        self->rtc->Write((uint32_t)self->epoch_seconds);
+        self->rtc_offset = 0;
+    }
+    self->rtc_stale = false;
+}
+
+static void CatchUp(clock_p self, int64_t now) {
+    // La alarma se compara antes de calcular la próxima a partir de la hora nueva
+    bool alarm_due = now >= self->alarm_deadline;
+
+    self->epoch_seconds = now;
+    self->ticks_counter = 0;
+    if (now >= self->next_transition) {
+        self->utc_offset = TimezoneLookup(self->zone, now, &self->next_transition);
+    }
+    UtcToLocal(self, false);
+    CheckDeadlines(self, alarm_due);
+}
+
 /* === Public function definitions ================================================================================= */
 
 clock_p ClockCreate(uint16_t ticks_per_second, clock_alarm_driver_p alarm_driver, uint32_t seconds_snoozed) {
-    static struct clock_s self[1];
-    clock_p result = self;
+    clock_p self = NULL;
 
     if (seconds_snoozed > 86400) {
-        result = NULL;
+        self = NULL;
     } else if (alarm_driver == NULL) {
-        result = NULL;
+        self = NULL;
     } else if (alarm_driver->TurnOffAlarm == NULL || alarm_driver->TurnOnAlarm == NULL) {
-        result = NULL;
+        self = NULL;
     } else {
+#ifdef USE_DYNAMIC_MEMORY
+        self = malloc(sizeof(struct clock_s));
+#else
+        // Sin memoria dinámica hay un único reloj, crearlo de nuevo lo reinicia
+        self = &instance;
+#endif
+    }
+
+    if (self != NULL) {
         memset(self, 0, sizeof(struct clock_s));
         self->valid = false;
         self->alarm_set = false;
         self->alarm_is_ringing = false;
         self->alarm_is_activated = false;
-        self->snooze_alarm = false;
         self->seconds_snoozed = seconds_snoozed;
+        self->snooze_deadline = CLOCK_ALARM_NEVER;
+        self->ring_deadline = CLOCK_ALARM_NEVER;
         self->ticks_per_second = ticks_per_second;
         self->alarm_driver = alarm_driver;
+        self->next_transition = TIMEZONE_NEVER;
+        self->alarm_days = CLOCK_ALARM_EVERY_DAY;
+        self->alarm_day = CLOCK_NO_DAY;
+        self->alarm_skipped_day = CLOCK_NO_DAY;
+        self->alarm_deadline = CLOCK_ALARM_NEVER;
+        memset(self->buckets, HOOK_NONE, sizeof(self->buckets));
+        CalendarCivilFromDays(0, &self->date);
     }
 
-    return result;
+    return self;
 }
 
 int ClockGetTime(clock_p self, clock_time_u * result) {
@@ -196,39 +703,38 @@ int ClockSetTime(clock_p self, const clock_time_u * new_time) {
         self->valid = true;
         memcpy(&self->current_time, new_time, sizeof(clock_time_u));
         self->seconds_counter = BcdTimeToSeconds(new_time->bcd);
+        LocalToUtc(self);
+        EVENT_TRACE(EVENT_TRACE_TIME_SET, self->seconds_counter / 3600, self->seconds_counter % 3600);
     }
 
     return result;
 }
 
 void ClockNewTick(clock_p self) {
-    static uint32_t snooze_counter = 0;
-
-    self->ticks_counter++;
-
-    if (self->ticks_counter == self->ticks_per_second) {
-        self->ticks_counter = 0;
-        self->seconds_counter++;
-        if (self->snooze_alarm) {
-            snooze_counter++;
+    uint32_t seconds;
+    uint8_t steps = 1;
+
+    if (self->suspended) {
+        steps = 0;
+    } else if (self->rtc_aligning) {
+        // El segundo termina cuando cambia el del RTC, así la fracción del segundo coincide con la del RTC
+        if (!self->rtc->Read(&seconds)) {
+            self->rtc_aligning = false;
+        } else if ((int64_t)seconds + self->rtc_offset > self->epoch_seconds) {
+            self->rtc_aligning = false;
+            self->ticks_counter = self->ticks_per_second - 1;
+        } else if (self->ticks_counter + 1 >= self->ticks_per_second) {
+            steps = 0;
         }
+    } else if (self->slew_ticks != 0 && ++self->slew_phase >= CLOCK_SLEW_INTERVAL) {
+        // La corrección agrega o saltea un tick cada tanto, los segundos siguen avanzando de a uno
+        self->slew_phase = 0;
+        steps = (self->slew_ticks > 0) ? 2 : 0;
+        self->slew_ticks += (self->slew_ticks > 0) ? -1 : 1;
+        self->rtc_stale = self->rtc_stale || self->slew_ticks == 0;
     }
-
-    if (self->seconds_counter == 86400) {
-        self->seconds_counter = 0;
-    }
-
-    if (snooze_counter == self->seconds_snoozed) {
-        snooze_counter = 0;
-        self->snooze_alarm = false;
-        self->alarm_is_ringing = true;
-        self->alarm_driver->TurnOnAlarm();
-    }
-
-    // Activa alarma
-    if ((self->seconds_counter == self->current_alarm_in_seconds) && self->alarm_is_activated) {
-        self->alarm_is_ringing = true;
-        self->alarm_driver->TurnOnAlarm();
+    for (; steps > 0; steps--) {
+        AdvanceTick(self);
     }
 }
 
@@ -243,11 +749,110 @@ int ClockSetAlarm(clock_p self, const clock_time_u * new_alarm) {
 
         memcpy(&self->current_alarm, new_alarm, sizeof(clock_time_u));
         self->current_alarm_in_seconds = BcdTimeToSeconds(self->current_alarm.bcd);
+        EVENT_TRACE(EVENT_TRACE_ALARM_SET, self->current_alarm_in_seconds / 3600,
+                    self->current_alarm_in_seconds % 3600);
+        ScheduleAlarm(self, false);
+    }
+
+    return result;
+}
+
+int ClockSetDate(clock_p self, const calendar_date_t * new_date) {
+    int result = 1;
+
+    // La cuenta de segundos desde 1970 no admite fechas anteriores
+    if (!CalendarValidDate(new_date) || new_date->year < 1970) {
+        result = 0;
+    } else {
+        self->days = CalendarDaysFromCivil(new_date);
+        LocalToUtc(self);
+    }
+
+    return result;
+}
+
+int ClockGetDate(clock_p self, calendar_date_t * current_date) {
+    memcpy(current_date, &self->date, sizeof(calendar_date_t));
+
+    return self->valid ? 1 : 0;
+}
+
+int64_t ClockGetEpochMilliseconds(clock_p self) {
+    return self->epoch_seconds * 1000 + (int64_t)self->ticks_counter * 1000 / self->ticks_per_second;
+}
+
+int ClockSetEpochMilliseconds(clock_p self, int64_t milliseconds) {
+    int64_t previous = self->epoch_seconds;
+    int result = 0;
+
+    if (milliseconds >= 0) {
+        self->valid = true;
+        self->epoch_seconds = milliseconds / 1000;
+        self->ticks_counter = (uint16_t)(milliseconds % 1000 * self->ticks_per_second / 1000);
+        self->slew_ticks = 0;
+        self->rtc_stale = true;
+        self->rtc_aligning = false;
+        self->next_transition = TIMEZONE_NEVER;
+        if (self->zone != NULL) {
+            self->utc_offset = TimezoneLookup(self->zone, self->epoch_seconds, &self->next_transition);
+        }
+        if (self->snooze_deadline != CLOCK_ALARM_NEVER) {
+            self->snooze_deadline += self->epoch_seconds - previous;
+        }
+        if (self->ring_deadline != CLOCK_ALARM_NEVER) {
+            self->ring_deadline += self->epoch_seconds - previous;
+        }
+        UtcToLocal(self, false);
+        EVENT_TRACE(EVENT_TRACE_TIME_SET, self->seconds_counter / 3600, self->seconds_counter % 3600);
+        result = 1;
     }
 
     return result;
 }
 
+int ClockAdjustTime(clock_p self, int32_t milliseconds) {
+    int result = 0;
+
+    if (self->valid && milliseconds >= -CLOCK_ADJUST_LIMIT && milliseconds <= CLOCK_ADJUST_LIMIT) {
+        self->slew_ticks = (int32_t)((int64_t)milliseconds * self->ticks_per_second / 1000);
+        self->slew_phase = 0;
+        result = 1;
+    }
+
+    return result;
+}
+
+int32_t ClockGetAdjustment(clock_p self) {
+    return (int32_t)((int64_t)self->slew_ticks * 1000 / self->ticks_per_second);
+}
+
+int64_t ClockGetEpochSeconds(clock_p self) {
+    return self->epoch_seconds;
+}
+
+int ClockIsTimeValid(clock_p self) {
+    return self->valid ? 1 : 0;
+}
+
+void ClockSetTimezone(clock_p self, const timezone_t * zone) {
+    self->zone = zone;
+    self->utc_offset = 0;
+    self->next_transition = TIMEZONE_NEVER;
+    if (!self->valid) {
+        // Sin una hora válida no hay un instante UTC que conservar, se mantiene la hora local
+        LocalToUtc(self);
+    } else {
+        if (zone != NULL) {
+            self->utc_offset = TimezoneLookup(zone, self->epoch_seconds, &self->next_transition);
+        }
+        UtcToLocal(self, true);
+    }
+}
+
+int32_t ClockGetUtcOffset(clock_p self) {
+    return self->utc_offset;
+}
+
 int ClockGetAlarm(clock_p self, clock_time_u * current_alarm) {
 
     memcpy(current_alarm, &self->current_alarm, sizeof(clock_time_u));
@@ -267,6 +872,36 @@ int ClockIsAlarmRinging(clock_p self) {
 
 void ClockSetAlarmState(clock_p self, bool activate) {
     self->alarm_is_activated = activate;
+    ScheduleAlarm(self, AlarmPassed(self));
+}
+
+void ClockSetAlarmDays(clock_p self, uint8_t weekdays) {
+    self->alarm_days = weekdays & CLOCK_ALARM_EVERY_DAY;
+    ScheduleAlarm(self, AlarmPassed(self));
+}
+
+uint8_t ClockGetAlarmDays(clock_p self) {
+    return self->alarm_days;
+}
+
+void ClockSetAlarmOneShot(clock_p self, bool one_shot) {
+    self->alarm_one_shot = one_shot;
+}
+
+void ClockSkipNextAlarm(clock_p self, bool skip) {
+    self->alarm_skipped_day = skip ? self->alarm_day : CLOCK_NO_DAY;
+    ScheduleAlarm(self, AlarmPassed(self));
+}
+
+int ClockGetNextAlarm(clock_p self, calendar_date_t * date) {
+    int result = 0;
+
+    if (self->alarm_day != CLOCK_NO_DAY) {
+        CalendarCivilFromDays(self->alarm_day, date);
+        result = 1;
+    }
+
+    return result;
 }
 
 int ClockIsAlarmActivated(clock_p self) {
@@ -279,14 +914,45 @@ int ClockIsAlarmActivated(clock_p self) {
     return result;
 }
 
-void ClockSnoozeAlarm(clock_p self) {
-    self->snooze_alarm = true;
-    ClockTurnOffAlarm(self);
+int ClockSetAlarmPolicy(clock_p self, const clock_alarm_policy_t * policy) {
+    int result = 1;
+
+    if (policy->ring_timeout > 86400 || policy->snooze_step < -86400 || policy->snooze_step > 86400) {
+        result = 0;
+    } else {
+        memcpy(&self->policy, policy, sizeof(clock_alarm_policy_t));
+    }
+
+    return result;
+}
+
+int ClockSnoozeAlarm(clock_p self) {
+    int64_t seconds = (int64_t)self->seconds_snoozed + (int64_t)self->snooze_count * self->policy.snooze_step;
+    int result = 0;
+
+    // Al llegar al máximo de posposiciones la alarma sigue sonando hasta que se apague
+    if (self->policy.max_snoozes == 0 || self->snooze_count < self->policy.max_snoozes) {
+        if (seconds < 1) {
+            seconds = 1;
+        }
+        if (self->snooze_count < UINT8_MAX) {
+            self->snooze_count++;
+        }
+        self->alarm_is_ringing = false;
+        self->alarm_driver->TurnOffAlarm();
+        self->ring_deadline = CLOCK_ALARM_NEVER;
+        self->snooze_deadline = self->epoch_seconds + seconds;
+        EVENT_TRACE(EVENT_TRACE_ALARM_SNOOZED, self->snooze_count,
+                    (uint16_t)((seconds > UINT16_MAX) ? UINT16_MAX : seconds));
+        result = 1;
+    }
+
+    return result;
 }
 
 void ClockTurnOffAlarm(clock_p self) {
-    self->alarm_is_ringing = false;
-    self->alarm_driver->TurnOffAlarm();
+    SilenceAlarm(self);
+    EVENT_TRACE(EVENT_TRACE_ALARM_OFF, 0, 0);
 }
 
 uint32_t ClockGetTimeInSeconds(clock_p self) {
@@ -295,9 +961,117 @@ uint32_t ClockGetTimeInSeconds(clock_p self) {
 
 int ClockIsAlarmSnoozed(clock_p self) {
     int result = 0;
-    if (self->snooze_alarm) {
+    if (self->snooze_deadline != CLOCK_ALARM_NEVER) {
         result = 1;
     }
     return result;
 }
+
+int ClockAddHook(clock_p self, clock_hook_e kind, const clock_time_u * time, clock_hook_p callback, void * context) {
+    hook_t * hook;
+    int result = -1;
+    int index;
+
+    if (callback != NULL && kind <= CLOCK_HOOK_TIME && (kind != CLOCK_HOOK_TIME || ValidTime(time))) {
+        for (index = 0; index < CLOCK_HOOKS && result < 0; index++) {
+            if (self->hooks[index].callback == NULL) {
+                result = index;
+            }
+        }
+    }
+
+    if (result >= 0) {
+        hook = &self->hooks[result];
+        hook->callback = callback;
+        hook->context = context;
+        hook->kind = (uint8_t)kind;
+        hook->time = (kind == CLOCK_HOOK_TIME) ? BcdTimeToSeconds(time->bcd) : 0;
+        hook->deadline = HookDeadline(hook, self->seconds_counter);
+        HookInsert(self, (uint8_t)result, self->seconds_counter + 1);
+    }
+
+    return result;
+}
+
+void ClockRemoveHook(clock_p self, int hook) {
+    if (hook >= 0 && hook < CLOCK_HOOKS && self->hooks[hook].callback != NULL) {
+        HookUnlink(self, (uint8_t)hook);
+        self->hooks[hook].callback = NULL;
+    }
+}
+
+int ClockSetRtc(clock_p self, clock_rtc_driver_p rtc) {
+    uint32_t seconds;
+    int result = 0;
+
+    self->rtc = NULL;
+    self->rtc_offset = 0;
+    self->rtc_aligning = false;
+    self->suspended = false;
+    if (rtc != NULL && rtc->Read != NULL && rtc->Write != NULL && rtc->SetAlarm != NULL) {
+        self->rtc = rtc;
+    }
+
+    if (self->rtc != NULL && self->rtc->Read(&seconds)) {
+        ClockSetEpochMilliseconds(self, (int64_t)seconds * 1000);
+        self->rtc_stale = false;
+        self->rtc_aligning = true;
+        result = 1;
+    } else {
+        // El RTC perdió la hora, se le guarda la del reloj si ya es válida
+        self->rtc_stale = self->valid;
+    }
+
+    return result;
+}
+
+int ClockSuspend(clock_p self) {
+    int64_t wake = self->alarm_deadline;
+    uint32_t alarm = CLOCK_RTC_NO_ALARM;
+    uint32_t seconds;
+    int result = 0;
+
+    if (self->rtc != NULL && self->valid && !self->suspended) {
+        // Se guarda la diferencia entre el RTC y el reloj, que pudo corregirse mientras contaba los ticks, salvo que
+        // el segundo todavía siga al RTC porque se acaba de reanudar
+        if (self->rtc_stale || !self->rtc->Read(&seconds)) {
+            RtcSave(self);
+        } else if (!self->rtc_aligning) {
+            self->rtc_offset = self->epoch_seconds - seconds;
+        }
+        if (self->rtc->Read(&seconds)) {
+            if (self->snooze_deadline < wake) {
+                wake = self->snooze_deadline;
+            }
+            if (self->ring_deadline < wake) {
+                wake = self->ring_deadline;
+            }
+            if (wake != CLOCK_ALARM_NEVER && wake - self->rtc_offset < CLOCK_RTC_NO_ALARM) {
+                alarm = (wake - self->rtc_offset > 0) ? (uint32_t)(wake - self->rtc_offset) : 0;
+            }
+            self->rtc->SetAlarm(alarm);
+            self->rtc_aligning = false;
+            self->suspended = true;
+            result = 1;
+        }
+    }
+
+    return result;
+}
+
+void ClockResume(clock_p self) {
+    uint32_t seconds;
+
+    if (self->suspended) {
+        self->suspended = false;
+        self->rtc->SetAlarm(CLOCK_RTC_NO_ALARM);
+        if (self->rtc->Read(&seconds)) {
+            if ((int64_t)seconds + self->rtc_offset > self->epoch_seconds) {
+                CatchUp(self, (int64_t)seconds + self->rtc_offset);
+            }
+            self->rtc_aligning = true;
+        }
+    }
+}
+
 /* === End of documentation ======================================================================================== */
@@ -0,0 +1,292 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file console.c
+ ** @brief Código fuente de la consola de órdenes por el puerto serie - Electrónica 4 2025
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "console.h"
+#include "hal.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! Valor inicial del hash FNV-1a de 32 bits
+#define HASH_OFFSET 2166136261UL
+
+//! Multiplicador del hash FNV-1a de 32 bits
+#define HASH_PRIME  16777619UL
+
+/* === Private data type declarations ============================================================================== */
+
+//! Estado de la consola, la línea que se está leyendo se guarda ya interpretada
+typedef struct console_s {
+    console_driver_p driver;            //!< funciones del puerto serie
+    const console_command_t * commands; //!< órdenes que se atienden
+    uint8_t count;                      //!< cantidad de órdenes
+    size_t rx_tail;                     //!< posición del próximo byte recibido que se interpreta
+    uint32_t tx_head;                   //!< bytes escritos en el buffer de envío desde el inicio
+    uint32_t tx_tail;                   //!< bytes enviados desde el inicio
+    uint32_t sending;                   //!< bytes que el DMA está enviando a partir de tx_tail
+    uint32_t hash;                      //!< hash de la palabra que se está leyendo
+    uint32_t number;                    //!< valor de la palabra que se está leyendo si es un número
+    uint8_t length;                     //!< largo de la palabra que se está leyendo, 0 entre palabras
+    bool numeric;                       //!< indica si la palabra que se está leyendo es un número
+    bool named;                         //!< indica si ya se leyó el nombre de la orden
+    bool failed;                        //!< indica si la línea tiene demasiados argumentos o números muy largos
+    uint32_t name_hash;                 //!< hash del nombre de la orden
+    uint8_t name_length;                //!< largo del nombre de la orden
+    console_args_t args;                //!< argumentos leídos
+    console_stats_t stats;              //!< contadores
+} console_t;
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Función que calcula el hash de un texto, el mismo que se calcula al recibir una palabra
+ *
+ * @param text texto terminado en cero
+ * @param length variable en la que se devuelve el largo del texto
+ * @return hash del texto
+ */
+static uint32_t Hash(const char * text, uint8_t * length);
+
+/**
+ * @brief Función que termina la palabra que se está leyendo y la guarda como nombre o como argumento
+ *
+ */
+static void EndWord(void);
+
+/**
+ * @brief Función que busca y atiende la orden de la línea que terminó y prepara la lectura de la siguiente
+ *
+ */
+static void EndLine(void);
+
+/**
+ * @brief Función que interpreta un byte recibido
+ *
+ * @param byte byte recibido
+ */
+static void Feed(uint8_t byte);
+
+/**
+ * @brief Función que termina el envío en curso si el DMA lo completó y empieza el siguiente
+ *
+ */
+static void Flush(void);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Estado de la consola, propio de cada placa simulada
+static HAL_BOARD_LOCAL console_t console;
+
+//! Buffer circular en el que el DMA escribe los bytes recibidos
+static HAL_BOARD_LOCAL uint8_t rx_buffer[CONSOLE_RX_SIZE];
+
+//! Buffer circular de las respuestas, el DMA las envía desde aquí
+static HAL_BOARD_LOCAL uint8_t tx_buffer[CONSOLE_TX_SIZE];
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static uint32_t Hash(const char * text, uint8_t * length) {
+    uint32_t result = HASH_OFFSET;
+
+    *length = 0;
+    while (*text != 0) {
+        result = (result ^ (uint8_t)*text++) * HASH_PRIME;
+        (*length)++;
+    }
+
+    return result;
+}
+
+static void EndWord(void) {
+    console_arg_t * arg;
+
+    if (console.length > 0) {
+        if (!console.named) {
+            console.named = true;
+            console.name_hash = console.hash;
+            console.name_length = console.length;
+        } else if (console.args.count < CONSOLE_ARGS) {
+            arg = &console.args.values[console.args.count++];
+            arg->number = console.number;
+            arg->hash = console.hash;
+            arg->length = console.length;
+            arg->numeric = console.numeric;
+        } else {
+            console.failed = true;
+        }
+        console.length = 0;
+    }
+}
+
+static void EndLine(void) {
+    const console_command_t * command = NULL;
+    uint8_t length;
+    uint8_t index;
+
+    EndWord();
+    // Las líneas vacías no son órdenes, así el \r\n de las terminales no genera errores
+    if (console.named) {
+        console.stats.lines++;
+        for (index = 0; index < console.count && command == NULL; index++) {
+            if (Hash(console.commands[index].name, &length) == console.name_hash && length == console.name_length) {
+                command = &console.commands[index];
+            }
+        }
+        if (command == NULL) {
+            console.stats.errors++;
+            ConsolePrint("error: orden desconocida\r\n");
+        } else if (console.failed) {
+            console.stats.errors++;
+            ConsolePrint("error: argumentos\r\n");
+        } else {
+            command->handler(&console.args);
+        }
+    }
+
+    console.named = false;
+    console.failed = false;
+    console.args.count = 0;
+}
+
+static void Feed(uint8_t byte) {
+    if (byte == '\r' || byte == '\n') {
+        EndLine();
+    } else if (byte == ' ' || byte == '\t' || byte == ':' || byte == '-' || byte == '/' || byte == ',') {
+        EndWord();
+    } else {
+        if (console.length == 0) {
+            console.hash = HASH_OFFSET;
+            console.number = 0;
+            console.numeric = true;
+        }
+        console.hash = (console.hash ^ byte) * HASH_PRIME;
+        if (console.length < UINT8_MAX) {
+            console.length++;
+        }
+        if (byte < '0' || byte > '9') {
+            console.numeric = false;
+        } else if (console.numeric && console.number > (UINT32_MAX - (uint32_t)(byte - '0')) / 10) {
+            console.failed = true;
+        } else if (console.numeric) {
+            console.number = console.number * 10 + (uint32_t)(byte - '0');
+        }
+    }
+}
+
+static void Flush(void) {
+    uint32_t start;
+    uint32_t size;
+    bool progress = true;
+
+    // Con un puerto que envía en el mismo llamado se sigue hasta vaciar el buffer, incluso si dio la vuelta
+    while (progress) {
+        progress = false;
+        if (console.sending != 0 && !console.driver->Busy()) {
+            console.tx_tail += console.sending;
+            console.sending = 0;
+        }
+        if (console.sending == 0 && console.tx_head != console.tx_tail) {
+            start = console.tx_tail % CONSOLE_TX_SIZE;
+            size = console.tx_head - console.tx_tail;
+            if (size > CONSOLE_TX_SIZE - start) {
+                size = CONSOLE_TX_SIZE - start;
+            }
+            if (console.driver->Send(&tx_buffer[start], size)) {
+                console.sending = size;
+                progress = !console.driver->Busy();
+            }
+        }
+    }
+}
+
+/* === Public function definitions ================================================================================= */
+
+void ConsoleInit(console_driver_p driver, const console_command_t * commands, uint8_t count) {
+    memset(&console, 0, sizeof(console));
+    console.driver = driver;
+    console.commands = commands;
+    console.count = count;
+    driver->Start(rx_buffer, sizeof(rx_buffer));
+}
+
+void ConsolePoll(void) {
+    size_t head = console.driver->Received();
+
+    while (console.rx_tail != head) {
+        Feed(rx_buffer[console.rx_tail]);
+        console.rx_tail = (console.rx_tail + 1) % CONSOLE_RX_SIZE;
+    }
+    Flush();
+}
+
+void ConsoleWrite(const char * text, size_t size) {
+    size_t available = ConsoleFree();
+    size_t index;
+
+    if (size > available) {
+        console.stats.dropped += (uint32_t)(size - available);
+        size = available;
+    }
+    for (index = 0; index < size; index++) {
+        tx_buffer[(console.tx_head + index) % CONSOLE_TX_SIZE] = (uint8_t)text[index];
+    }
+    console.tx_head += (uint32_t)size;
+}
+
+void ConsolePrint(const char * format, ...) {
+    char line[CONSOLE_LINE_SIZE];
+    va_list arguments;
+    int length;
+
+    va_start(arguments, format);
+    length = vsnprintf(line, sizeof(line), format, arguments);
+    va_end(arguments);
+
+    if (length > 0) {
+        ConsoleWrite(line, ((size_t)length < sizeof(line)) ? (size_t)length : sizeof(line) - 1);
+    }
+}
+
+size_t ConsoleFree(void) {
+    return CONSOLE_TX_SIZE - (console.tx_head - console.tx_tail);
+}
+
+bool ConsoleArgIs(const console_args_t * args, uint8_t index, const char * word) {
+    uint8_t length;
+
+    return index < args->count && Hash(word, &length) == args->values[index].hash &&
+           length == args->values[index].length;
+}
+
+void ConsoleGetStats(console_stats_t * stats) {
+    memcpy(stats, &console.stats, sizeof(console_stats_t));
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,61 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file crc.c
+ ** @brief Código fuente del cálculo del CRC de 16 bits para datos guardados y transmitidos - Electrónica 4 2025
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "crc.h"
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+//! CRC de cada valor de 4 bits, la tabla de 16 entradas ocupa 32 bytes de flash en lugar de los 512 de la de 8 bits
+static const uint16_t NIBBLE_TABLE[16] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+};
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+/* === Public function definitions ================================================================================= */
+
+uint16_t Crc16(uint16_t crc, const void * data, size_t size) {
+    const uint8_t * bytes = data;
+    size_t index;
+
+    for (index = 0; index < size; index++) {
+        crc = (uint16_t)((crc << 4) ^ NIBBLE_TABLE[(crc >> 12) ^ (bytes[index] >> 4)]);
+        crc = (uint16_t)((crc << 4) ^ NIBBLE_TABLE[(crc >> 12) ^ (bytes[index] & 0x0F)]);
+    }
+
+    return crc;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -25,7 +25,8 @@ SPDX-License-Identifier: MIT
 
 #include "digital_input.h"
 #include "config.h"
-#include "chip.h"
+#include "event_trace.h"
+#include "hal.h"
 #include <stdlib.h>
 
 /* === Macros definitions ========================================================================================== */
@@ -42,6 +43,7 @@ struct digital_input_s {
     uint32_t pin;   //!< Pin al que pertenece la entrada digital
     bool inverted;  //!< Indica si la entrada digital tiene logica invertida
     bool laststate; //!< Recuerda el estado anterior independiente de si es logica invertida o no
+    bool level;     //!< Último nivel eléctrico leído del pin
 #ifndef USE_DYNAMIC_MEMORY
     bool used; //!< Indica si la entrada digital esta siendo usada. Solo es usado cuando NO se tiene memoria dinamcia
 #endif
@@ -67,6 +69,9 @@ static digital_input_p CreateInstance(void);
 
 /* === Private variable definitions ================================================================================ */
 
+//! Función que recibe los cambios de nivel leídos, es propia de cada placa simulada
+static HAL_BOARD_LOCAL digital_input_observer_p observer = NULL;
+
 /* === Public variable definitions ================================================================================= */
 
 /* === Private function definitions ================================================================================ */
@@ -101,7 +106,11 @@ digital_input_p DigitalInputCreate(uint8_t port, uint32_t pin, bool inverted) {
         self->port = port;
         self->pin = pin;
         self->inverted = inverted;
-        Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, self->port, self->pin, false);
+        HalGpioSetDirection(self->port, self->pin, false);
+        self->level = (HalGpioReadBit(self->port, self->pin) != 0);
+        if (observer != NULL) {
+            observer(self->port, self->pin, self->level);
+        }
         self->laststate = DigitalInputGetIsActive(self);
     }
 
@@ -109,9 +118,14 @@ digital_input_p DigitalInputCreate(uint8_t port, uint32_t pin, bool inverted) {
 }
 
 bool DigitalInputGetIsActive(digital_input_p self) {
-    bool state = false; //!< estado real del pin
-    if (Chip_GPIO_ReadPortBit(LPC_GPIO_PORT, self->port, self->pin) != 0) {
-        state = true;
+    bool state = (HalGpioReadBit(self->port, self->pin) != 0); //!< estado real del pin
+
+    if (state != self->level) {
+        self->level = state;
+        EVENT_TRACE(EVENT_TRACE_INPUT_EDGE, state, (uint16_t)(self->port << 8 | self->pin));
+        if (observer != NULL) {
+            observer(self->port, self->pin, state);
+        }
     }
     if (self->inverted) {
         state = !state;
@@ -134,6 +148,10 @@ digital_input_changes_t DigitalInputWasChanged(digital_input_p self) {
     return result;
 }
 
+void DigitalInputSetObserver(digital_input_observer_p function) {
+    observer = function;
+}
+
 bool DigitalInputWasActivated(digital_input_p self) {
     return DIGITAL_INPUT_WAS_ACTIVATED == DigitalInputWasChanged(self);
 }
@@ -25,7 +25,7 @@ SPDX-License-Identifier: MIT
 
 #include "digital_output.h"
 #include "config.h"
-#include "chip.h"
+#include "hal.h"
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
@@ -36,12 +36,23 @@ SPDX-License-Identifier: MIT
 #define DIGITAL_OUTPUT_MAX_INSTANCE 4
 #endif
 
+#ifndef DIGITAL_OUTPUT_PORTS
+#define DIGITAL_OUTPUT_PORTS 8
+#endif
+
+//! Cantidad de pines de cada puerto, uno por bit del registro
+#define DIGITAL_OUTPUT_PINS 32
+
+//! Valor del puerto de un lote que todavía no tiene salidas
+#define BATCH_NO_PORT 0xFF
+
 /* === Private data type declarations ============================================================================== */
 
 //! Estructura que representa una salida digital
 struct digital_output_s {
-    uint8_t port; //!< Puerto al que pertenece la salida digital
-    uint32_t pin; //!< Pin al que pertenece la salida digital
+    uint8_t port;  //!< Puerto al que pertenece la salida digital
+    uint32_t pin;  //!< Pin al que pertenece la salida digital
+    uint32_t mask; //!< Mascara del pin dentro del puerto
 #ifndef USE_DYNAMIC_MEMORY
     bool used; //!< Indica si la salida digital esta siendo usada. Solo es usado cuando NO se tiene memoria dinamcia
 #endif
@@ -60,6 +71,14 @@ struct digital_output_s {
 static digital_output_p CreateInstance();
 #endif
 
+/**
+ * @brief Funcion para escribir el estado de un pin y mantener actualizada la copia en memoria del puerto
+ *
+ * @param self Referencia a la salida digital
+ * @param state Nuevo estado del pin
+ */
+static void WritePin(digital_output_p self, bool state);
+
 /* === Private variable definitions ================================================================================ */
 
 #ifndef USE_DYNAMIC_MEMORY
@@ -67,6 +86,11 @@ static digital_output_p CreateInstance();
 static struct digital_output_s instances[DIGITAL_OUTPUT_MAX_INSTANCE] = {0};
 #endif
 
+#ifdef DIGITAL_OUTPUT_USE_SHADOW
+//! Copia en memoria del valor escrito en cada puerto, evita leer el periférico para conocer el estado
+static HAL_BOARD_LOCAL uint32_t shadow[DIGITAL_OUTPUT_PORTS] = {0};
+#endif
+
 /* === Public variable definitions ================================================================================= */
 
 /* === Private function definitions ================================================================================ */
@@ -88,35 +112,105 @@ static digital_output_p CreateInstance() {
 }
 #endif
 
+static void WritePin(digital_output_p self, bool state) {
+#ifdef DIGITAL_OUTPUT_USE_SHADOW
+    if (state) {
+        shadow[self->port] |= self->mask;
+    } else {
+        shadow[self->port] &= ~self->mask;
+    }
+#endif
+    HalGpioWriteBit(self->port, self->pin, state);
+}
+
+/* === Public function definitions ================================================================================= */
+
 digital_output_p DigitalOutputCreate(uint8_t port, uint32_t pin) {
-    digital_output_p self;
+    digital_output_p self = NULL;
 
+    if (port < DIGITAL_OUTPUT_PORTS && pin < DIGITAL_OUTPUT_PINS) {
 #ifdef USE_DYNAMIC_MEMORY
-    self = malloc(sizeof(struct digital_output_s));
+        self = malloc(sizeof(struct digital_output_s));
 #else
-    self = CreateInstance();
+        self = CreateInstance();
 #endif
+    }
 
     if (self != NULL) {
         self->port = port;
         self->pin = pin;
-        Chip_GPIO_SetPinState(LPC_GPIO_PORT, self->port, self->pin, false);
-        Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, self->port, self->pin, true);
+        self->mask = (1UL << pin);
+        WritePin(self, false);
+        HalGpioSetDirection(self->port, self->pin, true);
     }
 
     return self;
 }
 
 void DigitalOutputActivate(digital_output_p self) {
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, self->port, self->pin, true);
+    WritePin(self, true);
 }
 
 void DigitalOutputDeactivate(digital_output_p self) {
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, self->port, self->pin, false);
+    WritePin(self, false);
 }
 
 void DigitalOutputToggle(digital_output_p self) {
-    Chip_GPIO_SetPinToggle(LPC_GPIO_PORT, self->port, self->pin);
+#ifdef DIGITAL_OUTPUT_USE_SHADOW
+    WritePin(self, (shadow[self->port] & self->mask) == 0);
+#else
+    HalGpioToggleBit(self->port, self->pin);
+#endif
+}
+
+bool DigitalOutputGetIsActive(digital_output_p self) {
+#ifdef DIGITAL_OUTPUT_USE_SHADOW
+    return (shadow[self->port] & self->mask) != 0;
+#else
+    return HalGpioReadBit(self->port, self->pin);
+#endif
+}
+
+void DigitalOutputBatchBegin(digital_output_batch_t * batch) {
+    batch->port = BATCH_NO_PORT;
+    batch->mask = 0;
+    batch->value = 0;
+}
+
+int DigitalOutputBatchSet(digital_output_batch_t * batch, digital_output_p output, bool active) {
+    int result = 0;
+
+    if (batch->port == BATCH_NO_PORT) {
+        batch->port = output->port;
+    }
+
+    if (batch->port != output->port) {
+        result = -1;
+    } else {
+        batch->mask |= output->mask;
+        if (active) {
+            batch->value |= output->mask;
+        } else {
+            batch->value &= ~output->mask;
+        }
+    }
+
+    return result;
+}
+
+int DigitalOutputBatchCommit(digital_output_batch_t * batch) {
+    int result = 0;
+
+    if (batch->mask == 0) {
+        result = -1;
+    } else {
+#ifdef DIGITAL_OUTPUT_USE_SHADOW
+        shadow[batch->port] = (shadow[batch->port] & ~batch->mask) | (batch->value & batch->mask);
+#endif
+        HalGpioWriteMasked(batch->port, batch->mask, batch->value);
+    }
+
+    return result;
 }
 
 /* === End of documentation ======================================================================================== */
@@ -241,6 +241,10 @@ void DisplayRefresh(display_p self) {
     self->driver->TurnOnDigit(self->current_digit);
 }
 
+void DisplayTurnOff(display_p self) {
+    self->driver->TurnOffDigits();
+}
+
 int DisplayBlinkingDigits(display_p self, uint8_t from, uint8_t to, uint16_t number_calls) {
     int result = 0;
 
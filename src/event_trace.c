@@ -0,0 +1,143 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file event_trace.c
+ ** @brief Código fuente del registro circular de eventos del reloj y de la interfaz - Electrónica 4 2025
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "event_trace.h"
+#include "hal.h"
+#include <stdio.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! Máscara que convierte un número de registro en su posición en el buffer
+#define EVENT_TRACE_MASK (EVENT_TRACE_SIZE - 1)
+
+#if (EVENT_TRACE_SIZE & EVENT_TRACE_MASK) != 0
+#error "EVENT_TRACE_SIZE debe ser una potencia de 2"
+#endif
+
+/* === Private data type declarations ============================================================================== */
+
+//! Posición del buffer circular
+typedef struct event_trace_slot_s {
+    uint32_t sequence;           //!< número del registro más 1, 0 mientras se escribe
+    event_trace_record_t record; //!< registro
+} event_trace_slot_t;
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+//! Nombres de los eventos en el texto JSON
+static const char * const EVENT_NAMES[EVENT_TRACE_EVENTS_COUNT] = {
+    [EVENT_TRACE_ALARM_FIRED] = "alarm_fired",
+    [EVENT_TRACE_ALARM_SNOOZED] = "alarm_snoozed",
+    [EVENT_TRACE_ALARM_OFF] = "alarm_off",
+    [EVENT_TRACE_TIME_SET] = "time_set",
+    [EVENT_TRACE_ALARM_SET] = "alarm_set",
+    [EVENT_TRACE_STATE_CHANGED] = "state_changed",
+    [EVENT_TRACE_INPUT_EDGE] = "input_edge",
+    [EVENT_TRACE_DEADLINE_MISSED] = "deadline_missed",
+};
+
+//! Buffer circular de registros, propio de cada placa simulada
+static HAL_BOARD_LOCAL event_trace_slot_t slots[EVENT_TRACE_SIZE];
+
+//! Cantidad de registros reservados por los escritores
+static HAL_BOARD_LOCAL uint32_t head = 0;
+
+//! Función que devuelve el tiempo de los registros
+static HAL_BOARD_LOCAL event_trace_clock_p time_source = NULL;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+/* === Public function definitions ================================================================================= */
+
+void EventTraceInit(event_trace_clock_p clock) {
+    uint32_t index;
+
+    for (index = 0; index < EVENT_TRACE_SIZE; index++) {
+        slots[index].sequence = 0;
+    }
+    time_source = clock;
+    __atomic_store_n(&head, 0, __ATOMIC_RELEASE);
+}
+
+void EventTraceWrite(uint8_t event, uint8_t detail, uint16_t value) {
+    // En el Cortex-M4 el incremento atómico es un lazo LDREX/STREX, una interrupción que escribe en el medio lo repite
+    uint32_t sequence = __atomic_fetch_add(&head, 1, __ATOMIC_RELAXED);
+    event_trace_slot_t * slot = &slots[sequence & EVENT_TRACE_MASK];
+
+    // Primero se invalida la posición para que el lector no mezcle el registro viejo con el nuevo
+    __atomic_store_n(&slot->sequence, 0, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    slot->record.time = (time_source != NULL) ? time_source() : 0;
+    slot->record.event = event;
+    slot->record.detail = detail;
+    slot->record.value = value;
+    __atomic_store_n(&slot->sequence, sequence + 1, __ATOMIC_RELEASE);
+}
+
+uint32_t EventTraceCount(void) {
+    return __atomic_load_n(&head, __ATOMIC_ACQUIRE);
+}
+
+int EventTraceRead(uint32_t * cursor, uint32_t * sequence, event_trace_record_t * record) {
+    uint32_t written = __atomic_load_n(&head, __ATOMIC_ACQUIRE);
+    const event_trace_slot_t * slot;
+    int result = -1;
+
+    // Los registros anteriores al tamaño del buffer ya fueron reemplazados
+    if (written - *cursor > EVENT_TRACE_SIZE) {
+        *cursor = written - EVENT_TRACE_SIZE;
+    }
+
+    while (*cursor != written && result != 0) {
+        slot = &slots[*cursor & EVENT_TRACE_MASK];
+        if (__atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE) == *cursor + 1) {
+            *record = slot->record;
+            // Si la secuencia cambió durante la copia un escritor reemplazó el registro
+            __atomic_thread_fence(__ATOMIC_ACQUIRE);
+            if (__atomic_load_n(&slot->sequence, __ATOMIC_RELAXED) == *cursor + 1) {
+                *sequence = *cursor;
+                result = 0;
+            }
+        }
+        (*cursor)++;
+    }
+
+    return result;
+}
+
+int EventTraceFormat(uint32_t sequence, const event_trace_record_t * record, char * buffer, size_t size) {
+    const char * name = (record->event < EVENT_TRACE_EVENTS_COUNT) ? EVENT_NAMES[record->event] : "unknown";
+
+    return snprintf(buffer, size, "{\"sequence\":%lu,\"time\":%lu,\"event\":\"%s\",\"detail\":%u,\"value\":%u}\n",
+                    (unsigned long)sequence, (unsigned long)record->time, name, (unsigned)record->detail,
+                    (unsigned)record->value);
+}
+
+/* === End of documentation ======================================================================================== */
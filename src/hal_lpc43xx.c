@@ -0,0 +1,461 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file hal_lpc43xx.c
+ ** @brief Implementación de la capa de abstracción del hardware para el LPC43xx de la EDU-CIAA - Electrónica 4 2025
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "hal.h"
+#include "calendar.h"
+#include "chip.h"
+#include <stddef.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! Páginas de la EEPROM que se usan como almacenamiento, la última queda reservada
+#define STORAGE_PAGES (EEPROM_PAGE_NUM - 1)
+
+//! Palabras de 32 bits en una página de la EEPROM
+#define STORAGE_PAGE_WORDS (EEPROM_PAGE_SIZE / sizeof(uint32_t))
+
+//! USART conectada al USB de depuración de la EDU-CIAA, sus pines son P7_1 (TXD) y P7_2 (RXD)
+#define SERIAL_UART        LPC_USART2
+
+//! Registro de la memoria con respaldo de batería que indica si el RTC conserva la hora
+#define RTC_VALID_REGISTER 0
+
+//! Valor del registro @ref RTC_VALID_REGISTER que se escribe al poner en hora el RTC
+#define RTC_VALID_MAGIC    0x52544331UL
+
+//! Campos que no se comparan en la alarma del RTC, los días de la semana y del año dependen de la fecha
+#define RTC_ALARM_IGNORED  (RTC_AMR_CIIR_IMDOW | RTC_AMR_CIIR_IMDOY)
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Función que inicia el controlador de la EEPROM la primera vez que se usa el almacenamiento
+ *
+ */
+static void StorageStart(void);
+
+/**
+ * @brief Función que convierte segundos desde 1970 en la hora y la fecha de los registros del RTC
+ *
+ * @param seconds segundos UTC desde el 1 de enero de 1970
+ * @param time hora y fecha para los registros del RTC
+ */
+static void RtcFromSeconds(uint32_t seconds, RTC_TIME_T * time);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Función que atiende la interrupción periódica
+static hal_handler_p tick_handler = NULL;
+
+//! Función que realiza el trabajo diferido
+static hal_handler_p deferred_handler = NULL;
+
+//! Función que atiende la alarma del RTC
+static hal_handler_p rtc_handler = NULL;
+
+//! Función que atiende el cambio de las entradas vigiladas
+static hal_handler_p wake_handler = NULL;
+
+//! Indica si ya se inició el controlador de la EEPROM
+static bool storage_started = false;
+
+//! Descriptor de la recepción por DMA, apunta a sí mismo para que el buffer sea circular
+static DMA_TransferDescriptor_t serial_descriptor;
+
+//! Buffer circular de recepción del puerto serie
+static uint8_t * serial_buffer = NULL;
+
+//! Tamaño del buffer de recepción
+static size_t serial_size = 0;
+
+//! Canal del DMA que recibe del puerto serie
+static uint8_t serial_rx_channel = 0;
+
+//! Canal del DMA que envía al puerto serie
+static uint8_t serial_tx_channel = 0;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void StorageStart(void) {
+    if (!storage_started) {
+        Chip_EEPROM_Init(LPC_EEPROM);
+        // Cada página se programa explícitamente una vez cargado su registro completo
+        Chip_EEPROM_SetAutoProg(LPC_EEPROM, EEPROM_AUTOPROG_OFF);
+        storage_started = true;
+    }
+}
+
+static void RtcFromSeconds(uint32_t seconds, RTC_TIME_T * time) {
+    calendar_date_t date;
+
+    CalendarCivilFromDays((int32_t)(seconds / CALENDAR_SECONDS_PER_DAY), &date);
+    seconds = seconds % CALENDAR_SECONDS_PER_DAY;
+    time->time[RTC_TIMETYPE_SECOND] = seconds % 60;
+    time->time[RTC_TIMETYPE_MINUTE] = (seconds / 60) % 60;
+    time->time[RTC_TIMETYPE_HOUR] = seconds / 3600;
+    time->time[RTC_TIMETYPE_DAYOFMONTH] = date.day;
+    time->time[RTC_TIMETYPE_DAYOFWEEK] = date.weekday;
+    time->time[RTC_TIMETYPE_DAYOFYEAR] = 1;
+    time->time[RTC_TIMETYPE_MONTH] = date.month;
+    time->time[RTC_TIMETYPE_YEAR] = (uint32_t)date.year;
+}
+
+/* === Public function definitions ================================================================================= */
+
+void HalPinMux(uint8_t port, uint8_t pin, hal_pin_mode_t mode, uint8_t function) {
+    uint16_t config = SCU_MODE_INBUFF_EN | SCU_MODE_INACT;
+
+    if (mode == HAL_PIN_INPUT_PULLUP) {
+        config = SCU_MODE_INBUFF_EN | SCU_MODE_PULLUP;
+    }
+    // Los valores de HAL_PIN_FUNCx coinciden con los de SCU_MODE_FUNCx
+    Chip_SCU_PinMuxSet(port, pin, config | function);
+}
+
+void HalGpioSetDirection(uint8_t gpio, uint8_t bit, bool output) {
+    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, gpio, bit, output);
+}
+
+bool HalGpioReadBit(uint8_t gpio, uint8_t bit) {
+    return Chip_GPIO_ReadPortBit(LPC_GPIO_PORT, gpio, bit);
+}
+
+void HalGpioWriteBit(uint8_t gpio, uint8_t bit, bool state) {
+    Chip_GPIO_SetPinState(LPC_GPIO_PORT, gpio, bit, state);
+}
+
+void HalGpioToggleBit(uint8_t gpio, uint8_t bit) {
+    Chip_GPIO_SetPinToggle(LPC_GPIO_PORT, gpio, bit);
+}
+
+uint32_t HalGpioReadPort(uint8_t gpio) {
+    return Chip_GPIO_GetPortValue(LPC_GPIO_PORT, gpio);
+}
+
+void HalGpioSetBits(uint8_t gpio, uint32_t mask) {
+    Chip_GPIO_SetValue(LPC_GPIO_PORT, gpio, mask);
+}
+
+void HalGpioClearBits(uint8_t gpio, uint32_t mask) {
+    Chip_GPIO_ClearValue(LPC_GPIO_PORT, gpio, mask);
+}
+
+void HalGpioWriteMasked(uint8_t gpio, uint32_t mask, uint32_t value) {
+    // En el registro de máscara un bit en cero habilita la escritura del pin en MPIN
+    Chip_GPIO_SetPortMask(LPC_GPIO_PORT, gpio, ~mask);
+    Chip_GPIO_SetMaskedPortValue(LPC_GPIO_PORT, gpio, value);
+    Chip_GPIO_SetPortMask(LPC_GPIO_PORT, gpio, 0);
+}
+
+void HalTickStart(uint32_t ticks_per_second, hal_handler_p handler) {
+    tick_handler = handler;
+
+    SystemCoreClockUpdate();
+    SysTick_Config((SystemCoreClock / ticks_per_second) - 1);
+
+    // El trabajo diferido tiene la menor prioridad para que nunca demore al SysTick
+    NVIC_SetPriority(SysTick_IRQn, (1 << __NVIC_PRIO_BITS) - 2);
+    NVIC_SetPriority(PendSV_IRQn, (1 << __NVIC_PRIO_BITS) - 1);
+
+    // Habilita el contador de ciclos para medir el tiempo que el procesador esta dormido
+    HalCycleCounterStart();
+}
+
+void HalTickEnable(bool enabled) {
+    if (enabled) {
+        // Empieza un periodo completo, como si la interrupción acabara de ocurrir
+        SysTick->VAL = 0;
+        SysTick->CTRL |= SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk;
+    } else {
+        SysTick->CTRL &= ~(SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk);
+        SCB->ICSR = SCB_ICSR_PENDSTCLR_Msk;
+    }
+}
+
+void HalCycleCounterStart(void) {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+void HalDeferredStart(hal_handler_p handler) {
+    deferred_handler = handler;
+}
+
+void HalDeferredRequest(void) {
+    SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
+}
+
+uint32_t HalCycleCounter(void) {
+    return DWT->CYCCNT;
+}
+
+uint32_t HalCycleCounterFrequency(void) {
+    SystemCoreClockUpdate();
+    return SystemCoreClock;
+}
+
+uint32_t HalTimestamp(void) {
+    return DWT->CYCCNT;
+}
+
+uint32_t HalTickLatency(void) {
+    // El SysTick cuenta hacia abajo desde LOAD y se recarga al pedir la interrupción, el núcleo lo incrementa a la
+    // frecuencia del procesador
+    return SysTick->LOAD - SysTick->VAL;
+}
+
+bool HalTickOverrun(void) {
+    // Dentro de la rutina el bit de pendiente solo se prende si llegó el siguiente tick
+    return (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0;
+}
+
+void HalInterruptsDisable(void) {
+    __disable_irq();
+}
+
+void HalInterruptsEnable(void) {
+    __enable_irq();
+}
+
+void HalSleep(void) {
+    __WFI();
+}
+
+uint32_t HalStorageSize(void) {
+    return STORAGE_PAGES * EEPROM_PAGE_SIZE;
+}
+
+void HalStorageRead(uint32_t address, void * data, size_t size) {
+    const volatile uint32_t * source = (const volatile uint32_t *)(EEPROM_START + address);
+    uint8_t * bytes = data;
+    uint32_t word;
+
+    StorageStart();
+    // La EEPROM solo admite lecturas de palabras completas
+    for (size_t index = 0; index < size / sizeof(word); index++) {
+        word = source[index];
+        memcpy(&bytes[index * sizeof(word)], &word, sizeof(word));
+    }
+}
+
+bool HalStorageWrite(uint32_t address, const void * data, size_t size) {
+    const uint8_t * bytes = data;
+    uint32_t page_data[STORAGE_PAGE_WORDS];
+    volatile uint32_t * page;
+    uint32_t offset;
+    uint32_t count;
+    bool result = ((address | size) & (sizeof(uint32_t) - 1)) == 0 && address <= HalStorageSize() &&
+                  size <= HalStorageSize() - address;
+
+    if (result) {
+        StorageStart();
+    }
+    while (result && size > 0) {
+        offset = address % EEPROM_PAGE_SIZE;
+        count = (size < EEPROM_PAGE_SIZE - offset) ? size : EEPROM_PAGE_SIZE - offset;
+        page = (volatile uint32_t *)EEPROM_ADDRESS(address / EEPROM_PAGE_SIZE, 0);
+
+        // Se programa la página completa, los bytes que no cambian se copian antes al registro de página
+        for (uint32_t index = 0; index < STORAGE_PAGE_WORDS; index++) {
+            page_data[index] = page[index];
+        }
+        memcpy((uint8_t *)page_data + offset, bytes, count);
+        for (uint32_t index = 0; index < STORAGE_PAGE_WORDS; index++) {
+            page[index] = page_data[index];
+        }
+        Chip_EEPROM_EraseProgramPage(LPC_EEPROM);
+
+        address += count;
+        bytes += count;
+        size -= count;
+    }
+    return result;
+}
+
+void HalSerialStart(uint32_t baud_rate, uint8_t * buffer, size_t size) {
+    serial_buffer = buffer;
+    serial_size = size;
+
+    Chip_SCU_PinMuxSet(7, 1, SCU_MODE_INACT | SCU_MODE_FUNC6);
+    Chip_SCU_PinMuxSet(7, 2, SCU_MODE_INACT | SCU_MODE_INBUFF_EN | SCU_MODE_ZIF_DIS | SCU_MODE_FUNC6);
+    Chip_UART_Init(SERIAL_UART);
+    Chip_UART_SetBaud(SERIAL_UART, baud_rate);
+    Chip_UART_ConfigData(SERIAL_UART, UART_LCR_WLEN8 | UART_LCR_SBS_1BIT | UART_LCR_PARITY_DIS);
+    // Cada byte recibido pide una transferencia al DMA, la USART no interrumpe al procesador
+    Chip_UART_SetupFIFOS(SERIAL_UART, UART_FCR_FIFO_EN | UART_FCR_DMAMODE_SEL | UART_FCR_TRG_LEV0);
+    Chip_UART_TXEnable(SERIAL_UART);
+
+    Chip_GPDMA_Init(LPC_GPDMA);
+    serial_rx_channel = Chip_GPDMA_GetFreeChannel(LPC_GPDMA, GPDMA_CONN_UART2_Rx);
+    serial_tx_channel = Chip_GPDMA_GetFreeChannel(LPC_GPDMA, GPDMA_CONN_UART2_Tx);
+    Chip_GPDMA_PrepareDescriptor(LPC_GPDMA, &serial_descriptor, GPDMA_CONN_UART2_Rx, (uint32_t)buffer, size,
+                                 GPDMA_TRANSFERTYPE_P2M_CONTROLLER_DMA, &serial_descriptor);
+    Chip_GPDMA_SGTransfer(LPC_GPDMA, serial_rx_channel, &serial_descriptor, GPDMA_TRANSFERTYPE_P2M_CONTROLLER_DMA);
+}
+
+size_t HalSerialReceived(void) {
+    // El registro de destino del canal apunta al byte que el DMA escribe a continuación
+    size_t result = LPC_GPDMA->CH[serial_rx_channel].DESTADDR - (uint32_t)serial_buffer;
+
+    return (result < serial_size) ? result : 0;
+}
+
+bool HalSerialSend(const void * data, size_t size) {
+    bool result = !HalSerialBusy();
+
+    if (result) {
+        result = Chip_GPDMA_Transfer(LPC_GPDMA, serial_tx_channel, (uint32_t)data, GPDMA_CONN_UART2_Tx,
+                                     GPDMA_TRANSFERTYPE_M2P_CONTROLLER_DMA, size) == SUCCESS;
+    }
+    return result;
+}
+
+bool HalSerialBusy(void) {
+    // El canal se deshabilita solo al terminar la transferencia
+    return (LPC_GPDMA->ENBLDCHNS & (1UL << serial_tx_channel)) != 0;
+}
+
+void HalRtcStart(hal_handler_p handler) {
+    rtc_handler = handler;
+
+    // Iniciar el RTC lo detiene y espera que arranque el oscilador, solo se hace si no estaba contando
+    if ((LPC_RTC->CCR & RTC_CCR_CLKEN) == 0) {
+        Chip_RTC_Init(LPC_RTC);
+        Chip_RTC_Enable(LPC_RTC, ENABLE);
+    }
+    LPC_RTC->AMR = RTC_AMR_CIIR_BITMASK;
+    Chip_RTC_ClearIntPending(LPC_RTC, RTC_INT_ALARM);
+    NVIC_ClearPendingIRQ(RTC_IRQn);
+    NVIC_EnableIRQ(RTC_IRQn);
+}
+
+bool HalRtcRead(uint32_t * seconds) {
+    RTC_TIME_T time;
+    calendar_date_t date;
+    bool result = LPC_REGFILE->REGFILE[RTC_VALID_REGISTER] == RTC_VALID_MAGIC;
+
+    if (result) {
+        // Los registros se leen de a uno, se repite la lectura si cambió el segundo entre medio
+        do {
+            Chip_RTC_GetFullTime(LPC_RTC, &time);
+        } while (Chip_RTC_GetTime(LPC_RTC, RTC_TIMETYPE_SECOND) != time.time[RTC_TIMETYPE_SECOND]);
+        date.year = (int16_t)time.time[RTC_TIMETYPE_YEAR];
+        date.month = (uint8_t)time.time[RTC_TIMETYPE_MONTH];
+        date.day = (uint8_t)time.time[RTC_TIMETYPE_DAYOFMONTH];
+        *seconds = (uint32_t)CalendarDaysFromCivil(&date) * CALENDAR_SECONDS_PER_DAY +
+                   time.time[RTC_TIMETYPE_HOUR] * 3600 + time.time[RTC_TIMETYPE_MINUTE] * 60 +
+                   time.time[RTC_TIMETYPE_SECOND];
+    }
+    return result;
+}
+
+void HalRtcWrite(uint32_t seconds) {
+    RTC_TIME_T time;
+
+    RtcFromSeconds(seconds, &time);
+    // Reinicia el divisor del oscilador para que el segundo nuevo empiece al escribir la hora
+    Chip_RTC_Enable(LPC_RTC, DISABLE);
+    Chip_RTC_ResetClockTickCounter(LPC_RTC);
+    Chip_RTC_SetFullTime(LPC_RTC, &time);
+    Chip_RTC_Enable(LPC_RTC, ENABLE);
+    LPC_REGFILE->REGFILE[RTC_VALID_REGISTER] = RTC_VALID_MAGIC;
+}
+
+void HalRtcSetAlarm(uint32_t seconds) {
+    RTC_TIME_T time;
+    uint32_t now;
+
+    LPC_RTC->AMR = RTC_AMR_CIIR_BITMASK;
+    Chip_RTC_ClearIntPending(LPC_RTC, RTC_INT_ALARM);
+    NVIC_ClearPendingIRQ(RTC_IRQn);
+    if (seconds != HAL_RTC_NO_ALARM) {
+        RtcFromSeconds(seconds, &time);
+        Chip_RTC_SetFullAlarmTime(LPC_RTC, &time);
+        LPC_RTC->AMR = RTC_ALARM_IGNORED;
+        // La alarma solo compara por igualdad, si el instante ya pasó se pide la interrupción directamente
+        if (HalRtcRead(&now) && now >= seconds) {
+            NVIC_SetPendingIRQ(RTC_IRQn);
+        }
+    }
+}
+
+void HalWakeOnChange(uint8_t gpio, uint32_t mask, hal_handler_p handler) {
+    uint32_t levels = Chip_GPIO_GetPortValue(LPC_GPIO_PORT, gpio);
+
+    NVIC_DisableIRQ(GINT0_IRQn);
+    wake_handler = handler;
+    Chip_GPIOGP_DisableGroupPins(LPC_GPIOGROUP, 0, gpio, mask);
+    Chip_GPIOGP_ClearIntStatus(LPC_GPIOGROUP, 0);
+    NVIC_ClearPendingIRQ(GINT0_IRQn);
+    if (handler != NULL) {
+        // El grupo interrumpe cuando alguno de los bits llega al nivel contrario al que tiene ahora
+        Chip_GPIOGP_SelectLowLevel(LPC_GPIOGROUP, 0, gpio, mask & levels);
+        Chip_GPIOGP_SelectHighLevel(LPC_GPIOGROUP, 0, gpio, mask & ~levels);
+        Chip_GPIOGP_SelectOrMode(LPC_GPIOGROUP, 0);
+        Chip_GPIOGP_SelectEdgeMode(LPC_GPIOGROUP, 0);
+        Chip_GPIOGP_EnableGroupPins(LPC_GPIOGROUP, 0, gpio, mask);
+        NVIC_EnableIRQ(GINT0_IRQn);
+    }
+}
+
+void SysTick_Handler(void) {
+    if (tick_handler != NULL) {
+        tick_handler();
+    }
+}
+
+void PendSV_Handler(void) {
+    if (deferred_handler != NULL) {
+        deferred_handler();
+    }
+}
+
+void RTC_IRQHandler(void) {
+    // La alarma se pide una sola vez, se deja de comparar antes de llamar a la función
+    LPC_RTC->AMR = RTC_AMR_CIIR_BITMASK;
+    Chip_RTC_ClearIntPending(LPC_RTC, RTC_INT_ALARM);
+    if (rtc_handler != NULL) {
+        rtc_handler();
+    }
+}
+
+void GINT0_IRQHandler(void) {
+    hal_handler_p handler = wake_handler;
+
+    NVIC_DisableIRQ(GINT0_IRQn);
+    Chip_GPIOGP_ClearIntStatus(LPC_GPIOGROUP, 0);
+    wake_handler = NULL;
+    if (handler != NULL) {
+        handler();
+    }
+}
+
+/* === End of documentation ======================================================================================== */
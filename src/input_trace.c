@@ -0,0 +1,321 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file input_trace.c
+ ** @brief Código fuente del registro binario compacto de cambios de las entradas digitales - Electrónica 4 2025
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "input_trace.h"
+#include "config.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#ifndef INPUT_TRACE_MAX_INSTANCE
+#define INPUT_TRACE_MAX_INSTANCE 2
+#endif
+
+//! Canal reservado para el registro final
+#define END_CHANNEL   7
+
+//! Bytes máximos de un número de 64 bits codificado en grupos de 7 bits
+#define VARINT_LENGTH 10
+
+/* === Private data type declarations ============================================================================== */
+
+//! Estructura que representa un registro
+struct input_trace_s {
+    uint8_t * buffer;                       //!< registro en escritura, NULL si se abrió para leer
+    const uint8_t * data;                   //!< contenido del registro
+    size_t size;                            //!< tamaño del buffer o del registro
+    size_t position;                        //!< próximo byte a escribir o a leer
+    uint64_t ticks;                         //!< ticks del último cambio escrito o leído
+    uint64_t duration;                      //!< ticks totales de la sesión
+    bool finished;                          //!< el registro tiene el registro final
+    uint16_t ticks_per_second;              //!< frecuencia de la interrupción periódica
+    uint8_t channels;                       //!< cantidad de entradas distintas
+    uint8_t gpio[INPUT_TRACE_MAX_CHANNELS]; //!< puerto GPIO de cada canal
+    uint8_t bit[INPUT_TRACE_MAX_CHANNELS];  //!< bit de cada canal
+#ifndef USE_DYNAMIC_MEMORY
+    bool used; //!< indica si el struct esta siendo usado en caso de no usar memoria dinamica
+#endif
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Función para crear un registro con memoria estática o dinámica
+ *
+ * @return input_trace_p referencia al registro creado, NULL si no hay espacio
+ */
+static input_trace_p CreateInstance(void);
+
+/**
+ * @brief Función que escribe un número en grupos de 7 bits
+ *
+ * @param self referencia al registro
+ * @param value número a escribir
+ * @return true si entró en el buffer
+ */
+static bool WriteVarint(input_trace_p self, uint64_t value);
+
+/**
+ * @brief Función que lee un número escrito en grupos de 7 bits
+ *
+ * @param self referencia al registro
+ * @param value número leído
+ * @return true si el número está completo
+ */
+static bool ReadVarint(input_trace_p self, uint64_t * value);
+
+/* === Private variable definitions ================================================================================ */
+
+#ifndef USE_DYNAMIC_MEMORY
+//! Array con los registros creados si no se utiliza memoria dinámica
+static struct input_trace_s instances[INPUT_TRACE_MAX_INSTANCE] = {0};
+#endif
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static input_trace_p CreateInstance(void) {
+    input_trace_p self = NULL;
+
+#ifdef USE_DYNAMIC_MEMORY
+    self = malloc(sizeof(struct input_trace_s));
+    if (self != NULL) {
+        memset(self, 0, sizeof(struct input_trace_s));
+    }
+#else
+    int i;
+
+    for (i = 0; i < INPUT_TRACE_MAX_INSTANCE; i++) {
+        if (!instances[i].used) {
+            memset(&instances[i], 0, sizeof(struct input_trace_s));
+            instances[i].used = true;
+            self = &instances[i];
+            break;
+        }
+    }
+#endif
+
+    return self;
+}
+
+static bool WriteVarint(input_trace_p self, uint64_t value) {
+    uint8_t bytes[VARINT_LENGTH];
+    size_t length = 0;
+    bool result;
+
+    do {
+        bytes[length] = (uint8_t)(value & 0x7F);
+        value >>= 7;
+        if (value != 0) {
+            bytes[length] |= 0x80;
+        }
+        length++;
+    } while (value != 0);
+
+    // Un cambio se escribe completo o no se escribe, así el registro sigue siendo válido si se llena el buffer
+    result = (self->size - self->position >= length);
+    if (result) {
+        memcpy(&self->buffer[self->position], bytes, length);
+        self->position += length;
+    }
+
+    return result;
+}
+
+static bool ReadVarint(input_trace_p self, uint64_t * value) {
+    unsigned shift = 0;
+    uint8_t byte = 0x80;
+
+    *value = 0;
+    while ((byte & 0x80) && self->position < self->size && shift < 7 * VARINT_LENGTH) {
+        byte = self->data[self->position++];
+        *value |= (uint64_t)(byte & 0x7F) << shift;
+        shift += 7;
+    }
+
+    return (byte & 0x80) == 0;
+}
+
+/* === Public function definitions ================================================================================= */
+
+input_trace_p InputTraceCreate(uint8_t * buffer, size_t size, uint16_t ticks_per_second) {
+    input_trace_p self = NULL;
+
+    if (buffer != NULL && size >= INPUT_TRACE_HEADER_SIZE) {
+        self = CreateInstance();
+    }
+
+    if (self != NULL) {
+        self->buffer = buffer;
+        self->data = buffer;
+        self->size = size;
+        self->position = INPUT_TRACE_HEADER_SIZE;
+        self->ticks_per_second = ticks_per_second;
+
+        // Los canales se completan en el encabezado a medida que aparecen
+        memset(buffer, 0, INPUT_TRACE_HEADER_SIZE);
+        memcpy(buffer, "RTRC", 4);
+        buffer[4] = INPUT_TRACE_VERSION;
+        buffer[6] = (uint8_t)(ticks_per_second & 0xFF);
+        buffer[7] = (uint8_t)(ticks_per_second >> 8);
+    }
+
+    return self;
+}
+
+input_trace_p InputTraceOpen(const uint8_t * buffer, size_t size) {
+    input_trace_p self = NULL;
+    input_trace_event_t event;
+    uint8_t channel;
+    bool valid;
+
+    valid = (buffer != NULL) && (size >= INPUT_TRACE_HEADER_SIZE) && (memcmp(buffer, "RTRC", 4) == 0) &&
+            (buffer[4] == INPUT_TRACE_VERSION) && (buffer[5] <= INPUT_TRACE_MAX_CHANNELS) &&
+            ((buffer[6] | buffer[7]) != 0);
+    if (valid) {
+        self = CreateInstance();
+    }
+
+    if (self != NULL) {
+        self->data = buffer;
+        self->size = size;
+        self->channels = buffer[5];
+        self->ticks_per_second = (uint16_t)(buffer[6] | (buffer[7] << 8));
+        for (channel = 0; channel < self->channels; channel++) {
+            self->gpio[channel] = buffer[8 + 2 * channel];
+            self->bit[channel] = buffer[9 + 2 * channel];
+        }
+
+        // Se recorre una vez para validarlo y conocer la duración antes de reproducirlo, lo que sigue al registro
+        // final se ignora
+        self->position = INPUT_TRACE_HEADER_SIZE;
+        while (InputTraceNext(self, &event)) {
+        }
+        valid = self->finished;
+        self->size = self->position;
+        self->position = INPUT_TRACE_HEADER_SIZE;
+        self->ticks = 0;
+        self->finished = false;
+        if (!valid) {
+            InputTraceDestroy(self);
+            self = NULL;
+        }
+    }
+
+    return self;
+}
+
+void InputTraceDestroy(input_trace_p self) {
+    if (self != NULL) {
+#ifdef USE_DYNAMIC_MEMORY
+        free(self);
+#else
+        self->used = false;
+#endif
+    }
+}
+
+bool InputTraceRecord(input_trace_p self, uint64_t ticks, uint8_t gpio, uint8_t bit, bool level) {
+    uint8_t channel = 0;
+    bool result = (self->buffer != NULL) && !self->finished && (ticks >= self->ticks);
+
+    while (channel < self->channels && (self->gpio[channel] != gpio || self->bit[channel] != bit)) {
+        channel++;
+    }
+    if (result && channel == self->channels) {
+        result = (channel < INPUT_TRACE_MAX_CHANNELS);
+        if (result) {
+            self->gpio[channel] = gpio;
+            self->bit[channel] = bit;
+            self->buffer[8 + 2 * channel] = gpio;
+            self->buffer[9 + 2 * channel] = bit;
+        }
+    }
+
+    if (result) {
+        result = WriteVarint(self, ((ticks - self->ticks) << 4) | ((uint64_t)channel << 1) | (level ? 1 : 0));
+    }
+    if (result) {
+        self->ticks = ticks;
+        // El canal nuevo solo cuenta si su primer cambio entró en el buffer
+        if (channel == self->channels) {
+            self->channels++;
+            self->buffer[5] = self->channels;
+        }
+    }
+
+    return result;
+}
+
+size_t InputTraceFinish(input_trace_p self, uint64_t ticks) {
+    size_t result = 0;
+
+    if (self->buffer != NULL && !self->finished && ticks >= self->ticks &&
+        WriteVarint(self, ((ticks - self->ticks) << 4) | (END_CHANNEL << 1) | 1)) {
+        self->duration = ticks;
+        self->finished = true;
+        result = self->position;
+    }
+
+    return result;
+}
+
+uint16_t InputTraceTicksPerSecond(input_trace_p self) {
+    return self->ticks_per_second;
+}
+
+uint64_t InputTraceDuration(input_trace_p self) {
+    return self->duration;
+}
+
+bool InputTraceNext(input_trace_p self, input_trace_event_t * event) {
+    uint64_t value;
+    uint8_t channel;
+    bool result = (self->buffer == NULL) && !self->finished && ReadVarint(self, &value);
+
+    if (result) {
+        channel = (uint8_t)((value >> 1) & 0x07);
+        self->ticks += value >> 4;
+        if (channel == END_CHANNEL) {
+            self->duration = self->ticks;
+            self->finished = true;
+            result = false;
+        } else if (channel < self->channels) {
+            event->ticks = self->ticks;
+            event->gpio = self->gpio[channel];
+            event->bit = self->bit[channel];
+            event->level = (value & 1) != 0;
+        } else {
+            result = false;
+        }
+    }
+
+    return result;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,281 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file output_pattern.c
+ ** @brief Código fuente del modulo generador de patrones sobre salidas digitales - Electrónica 4 2025
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "output_pattern.h"
+#include "config.h"
+#include <stddef.h>
+#include <stdlib.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#ifndef OUTPUT_PATTERN_MAX_INSTANCE
+#define OUTPUT_PATTERN_MAX_INSTANCE 1
+#endif
+
+//! Ciclo de trabajo con la salida siempre activa
+#define DUTY_ON OUTPUT_PATTERN_PWM_PERIOD
+
+//! Cantidad de elementos de un array
+#define LENGTH(array) (sizeof(array) / sizeof(array[0]))
+
+/* === Private data type declarations ============================================================================== */
+
+/**
+ * @brief Estructura que representa un generador de patrones
+ *
+ * Los campos del paso en curso son volátiles porque @ref OutputPatternStart() puede ejecutarse fuera de la
+ * interrupción que llama a @ref OutputPatternTick(), así el compilador mantiene el orden en que se escriben y la
+ * secuencia se publica recién cuando el paso está cargado.
+ */
+struct output_pattern_s {
+    digital_output_p output;                     //!< salida digital que se controla
+    const output_sequence_t * volatile sequence; //!< secuencia en reproducción, NULL si está detenido
+    const output_pattern_step_t * volatile step; //!< paso actual de la secuencia
+    volatile uint16_t remaining;                 //!< ticks que faltan para terminar el paso actual
+    volatile uint8_t index;                      //!< número del paso actual
+    volatile uint8_t phase;                      //!< tick dentro del periodo de PWM
+    bool inverted;                               //!< indica si la salida es activa en bajo
+    bool level;                                  //!< último estado lógico escrito en la salida
+#ifndef USE_DYNAMIC_MEMORY
+    bool used; //!< indica si el struct esta siendo usado en caso de no usar memoria dinamica
+#endif
+};
+
+/* === Private function declarations =============================================================================== */
+
+#ifndef USE_DYNAMIC_MEMORY
+/**
+ * @brief Función para crear un generador de patrones si no se usa memoria dinámica
+ *
+ * @return output_pattern_p referencia al generador creado, NULL si no hay espacio
+ */
+static output_pattern_p CreateInstance(void);
+#endif
+
+/**
+ * @brief Función que escribe el estado lógico en la salida teniendo en cuenta si es activa en bajo
+ *
+ * @param self referencia al generador
+ * @param level nuevo estado lógico
+ */
+static void WriteLevel(output_pattern_p self, bool level);
+
+/**
+ * @brief Función que agrega a un lote el estado lógico de la salida teniendo en cuenta si es activa en bajo
+ *
+ * @param self referencia al generador
+ * @param batch lote en el que se escribe la salida
+ * @param level nuevo estado lógico
+ */
+static void BatchLevel(output_pattern_p self, digital_output_batch_t * batch, bool level);
+
+/**
+ * @brief Función que carga el paso indicado de una secuencia
+ *
+ * @param self referencia al generador
+ * @param sequence secuencia de la que se toma el paso
+ * @param index número de paso a cargar
+ */
+static void LoadStep(output_pattern_p self, const output_sequence_t * sequence, uint8_t index);
+
+/* === Private variable definitions ================================================================================ */
+
+#ifndef USE_DYNAMIC_MEMORY
+//! Array con los generadores de patrones creados si no se utiliza memoria dinámica
+static struct output_pattern_s instances[OUTPUT_PATTERN_MAX_INSTANCE] = {0};
+#endif
+
+//! Pasos de @ref OUTPUT_SEQUENCE_BEEP_BEEP, con un tick de 1 ms
+static const output_pattern_step_t BEEP_BEEP_STEPS[] = {
+    {DUTY_ON, 100}, {0, 100}, {DUTY_ON, 100}, {0, 700},
+};
+
+//! Pasos de @ref OUTPUT_SEQUENCE_ESCALATING, con un tick de 1 ms
+static const output_pattern_step_t ESCALATING_STEPS[] = {
+    {2, 150}, {0, 350}, {4, 150}, {0, 350}, {6, 150}, {0, 350}, {8, 150}, {0, 350}, {DUTY_ON, 500}, {0, 500},
+};
+
+//! Pasos de @ref OUTPUT_SEQUENCE_PULSE, con un tick de 1 ms
+static const output_pattern_step_t PULSE_STEPS[] = {
+    {1, 50}, {2, 50}, {3, 50}, {4, 50}, {5, 50}, {6, 50}, {7, 50}, {8, 50}, {9, 50},
+    {DUTY_ON, 50}, {9, 50}, {8, 50}, {7, 50}, {6, 50}, {5, 50}, {4, 50}, {3, 50}, {2, 50},
+};
+
+/* === Public variable definitions ================================================================================= */
+
+const output_sequence_t OUTPUT_SEQUENCE_BEEP_BEEP = {
+    .steps = BEEP_BEEP_STEPS,
+    .count = LENGTH(BEEP_BEEP_STEPS),
+    .loop = true,
+};
+
+const output_sequence_t OUTPUT_SEQUENCE_ESCALATING = {
+    .steps = ESCALATING_STEPS,
+    .count = LENGTH(ESCALATING_STEPS),
+    .loop = true,
+};
+
+const output_sequence_t OUTPUT_SEQUENCE_PULSE = {
+    .steps = PULSE_STEPS,
+    .count = LENGTH(PULSE_STEPS),
+    .loop = true,
+};
+
+/* === Private function definitions ================================================================================ */
+
+#ifndef USE_DYNAMIC_MEMORY
+static output_pattern_p CreateInstance(void) {
+    output_pattern_p self = NULL;
+    int i;
+
+    for (i = 0; i < OUTPUT_PATTERN_MAX_INSTANCE; i++) {
+        if (!instances[i].used) {
+            instances[i].used = true;
+            self = &instances[i];
+            break;
+        }
+    }
+
+    return self;
+}
+#endif
+
+static void WriteLevel(output_pattern_p self, bool level) {
+    self->level = level;
+    if (level != self->inverted) {
+        DigitalOutputActivate(self->output);
+    } else {
+        DigitalOutputDeactivate(self->output);
+    }
+}
+
+static void BatchLevel(output_pattern_p self, digital_output_batch_t * batch, bool level) {
+    // Si el lote es de otro puerto el estado no cambia y se vuelve a intentar en el próximo tick
+    if (DigitalOutputBatchSet(batch, self->output, level != self->inverted) == 0) {
+        self->level = level;
+    }
+}
+
+static void LoadStep(output_pattern_p self, const output_sequence_t * sequence, uint8_t index) {
+    self->index = index;
+    self->step = &sequence->steps[index];
+    self->remaining = self->step->ticks;
+    self->phase = 0;
+}
+
+/* === Public function definitions ================================================================================= */
+
+output_pattern_p OutputPatternCreate(digital_output_p output, bool inverted) {
+    output_pattern_p self = NULL;
+
+    if (output != NULL) {
+#ifdef USE_DYNAMIC_MEMORY
+        self = malloc(sizeof(struct output_pattern_s));
+#else
+        self = CreateInstance();
+#endif
+    }
+
+    if (self != NULL) {
+        self->output = output;
+        self->inverted = inverted;
+        self->sequence = NULL;
+        self->step = NULL;
+        WriteLevel(self, false);
+    }
+
+    return self;
+}
+
+int OutputPatternStart(output_pattern_p self, const output_sequence_t * sequence) {
+    int result = 0;
+
+    if (sequence == NULL || sequence->count == 0) {
+        result = -1;
+    } else {
+        // El tick no debe ver la secuencia nueva con el paso de la anterior, por eso se publica al final
+        self->sequence = NULL;
+        LoadStep(self, sequence, 0);
+        self->sequence = sequence;
+    }
+
+    return result;
+}
+
+void OutputPatternStop(output_pattern_p self) {
+    // Solo el tick escribe la salida y la copia del puerto, así no compite con la interrupción que lo llama
+    self->sequence = NULL;
+    self->step = NULL;
+}
+
+bool OutputPatternIsRunning(output_pattern_p self) {
+    return self->sequence != NULL;
+}
+
+void OutputPatternTick(output_pattern_p self) {
+    digital_output_batch_t batch;
+
+    DigitalOutputBatchBegin(&batch);
+    OutputPatternTickBatch(self, &batch);
+    DigitalOutputBatchCommit(&batch);
+}
+
+void OutputPatternTickBatch(output_pattern_p self, digital_output_batch_t * batch) {
+    const output_sequence_t * sequence = self->sequence;
+    bool level;
+
+    if (sequence != NULL) {
+        level = self->phase < self->step->duty;
+        if (level != self->level) {
+            BatchLevel(self, batch, level);
+        }
+
+        self->phase++;
+        if (self->phase == OUTPUT_PATTERN_PWM_PERIOD) {
+            self->phase = 0;
+        }
+
+        if (self->remaining > 0) {
+            self->remaining--;
+        }
+        if (self->remaining == 0) {
+            if (self->index + 1 < sequence->count) {
+                LoadStep(self, sequence, self->index + 1);
+            } else if (sequence->loop) {
+                LoadStep(self, sequence, 0);
+            } else {
+                self->sequence = NULL;
+                self->step = NULL;
+                if (self->level) {
+                    BatchLevel(self, batch, false);
+                }
+            }
+        }
+    } else if (self->level) {
+        BatchLevel(self, batch, false);
+    }
+}
+
+/* === End of documentation ======================================================================================== */
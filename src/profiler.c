@@ -0,0 +1,210 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file profiler.c
+ ** @brief Código fuente de las mediciones de duración y latencia de las rutinas de interrupción - Electrónica 4 2025
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "profiler.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+//! Texto que se arma en partes, como snprintf sigue contando el largo aunque no entre en el buffer
+typedef struct text_s {
+    char * buffer; //!< texto resultante
+    size_t size;   //!< tamaño del buffer
+    int length;    //!< largo del texto completo, negativo si hubo un error de formato
+} text_t;
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Función que reinicia las estadísticas de una magnitud
+ *
+ * @param stats estadísticas
+ */
+static void ResetStats(profiler_stats_t * stats);
+
+/**
+ * @brief Función que agrega una medición a las estadísticas de una magnitud
+ *
+ * @param stats estadísticas
+ * @param value medición
+ */
+static void AddValue(profiler_stats_t * stats, uint32_t value);
+
+/**
+ * @brief Función que agrega texto con formato al final de un texto
+ *
+ * @param text texto
+ * @param format formato de printf
+ */
+static void Append(text_t * text, const char * format, ...);
+
+/**
+ * @brief Función que agrega las estadísticas de una magnitud como un objeto JSON
+ *
+ * @param text texto
+ * @param stats estadísticas
+ * @param count cantidad de mediciones
+ */
+static void AppendStats(text_t * text, const profiler_stats_t * stats, uint32_t count);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Regiones que se pueden leer en tiempo de ejecución
+static HAL_BOARD_LOCAL profiler_region_t * regions[PROFILER_MAX_REGIONS];
+
+//! Cantidad de regiones en la lista
+static HAL_BOARD_LOCAL size_t regions_count = 0;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void ResetStats(profiler_stats_t * stats) {
+    memset(stats, 0, sizeof(profiler_stats_t));
+    stats->min = UINT32_MAX;
+}
+
+static void AddValue(profiler_stats_t * stats, uint32_t value) {
+    uint32_t bucket = 0;
+
+    stats->last = value;
+    if (value < stats->min) {
+        stats->min = value;
+    }
+    if (value > stats->max) {
+        stats->max = value;
+    }
+    stats->total += value;
+
+    // El cubo es la cantidad de bits significativos, CLZ es una sola instrucción en el Cortex-M4
+    if (value != 0) {
+        bucket = 32 - (uint32_t)__builtin_clz(value);
+    }
+    if (bucket >= PROFILER_BUCKETS) {
+        bucket = PROFILER_BUCKETS - 1;
+    }
+    stats->histogram[bucket]++;
+}
+
+static void Append(text_t * text, const char * format, ...) {
+    size_t used;
+    int written;
+    va_list arguments;
+
+    if (text->length >= 0) {
+        used = ((size_t)text->length < text->size) ? (size_t)text->length : text->size;
+        va_start(arguments, format);
+        written = vsnprintf(text->buffer + used, text->size - used, format, arguments);
+        va_end(arguments);
+        text->length = (written < 0) ? written : text->length + written;
+    }
+}
+
+static void AppendStats(text_t * text, const profiler_stats_t * stats, uint32_t count) {
+    uint32_t bucket;
+
+    Append(text, "{\"last\":%lu,\"min\":%lu,\"max\":%lu,\"mean\":%lu,\"histogram\":[", (unsigned long)stats->last,
+           (unsigned long)((count != 0) ? stats->min : 0), (unsigned long)stats->max,
+           (unsigned long)((count != 0) ? stats->total / count : 0));
+    for (bucket = 0; bucket < PROFILER_BUCKETS; bucket++) {
+        Append(text, "%s%lu", (bucket != 0) ? "," : "", (unsigned long)stats->histogram[bucket]);
+    }
+    Append(text, "]}");
+}
+
+/* === Public function definitions ================================================================================= */
+
+int ProfilerStart(profiler_region_t * region) {
+    size_t index = 0;
+    int result = 0;
+
+    HalInterruptsDisable();
+    region->count = 0;
+    ResetStats(&region->duration);
+    ResetStats(&region->latency);
+    HalInterruptsEnable();
+
+    while (index < regions_count && regions[index] != region) {
+        index++;
+    }
+    if (index == regions_count) {
+        if (regions_count < PROFILER_MAX_REGIONS) {
+            regions[regions_count++] = region;
+        } else {
+            result = -1;
+        }
+    }
+
+    return result;
+}
+
+void ProfilerEnter(profiler_region_t * region, uint32_t latency) {
+    AddValue(&region->latency, latency);
+}
+
+void ProfilerExit(profiler_region_t * region, uint32_t start) {
+    AddValue(&region->duration, HalTimestamp() - start);
+    region->count++;
+}
+
+size_t ProfilerCount(void) {
+    return regions_count;
+}
+
+int ProfilerSnapshot(size_t index, profiler_region_t * copy) {
+    int result = -1;
+
+    if (index < regions_count) {
+        HalInterruptsDisable();
+        memcpy(copy, regions[index], sizeof(profiler_region_t));
+        HalInterruptsEnable();
+        result = 0;
+    }
+
+    return result;
+}
+
+int ProfilerFormat(const profiler_region_t * region, char * buffer, size_t size) {
+    text_t text = {.buffer = buffer, .size = size, .length = 0};
+
+    if (size != 0) {
+        buffer[0] = 0;
+    }
+    Append(&text, "{\"name\":\"%s\",\"frequency\":%lu,\"count\":%lu,\"duration\":", region->name,
+           (unsigned long)HalCycleCounterFrequency(), (unsigned long)region->count);
+    AppendStats(&text, &region->duration, region->count);
+    Append(&text, ",\"latency\":");
+    AppendStats(&text, &region->latency, region->count);
+    Append(&text, "}\n");
+
+    return text.length;
+}
+
+/* === End of documentation ======================================================================================== */
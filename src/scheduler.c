@@ -0,0 +1,259 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file scheduler.c
+ ** @brief Código fuente del planificador de tareas periódicas con bajo consumo - Electrónica 4 2025
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "scheduler.h"
+#include "config.h"
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#ifndef SCHEDULER_MAX_INSTANCE
+#define SCHEDULER_MAX_INSTANCE 1
+#endif
+
+#ifndef SCHEDULER_MAX_TASKS
+#define SCHEDULER_MAX_TASKS 4
+#endif
+
+/* === Private data type declarations ============================================================================== */
+
+//! Tarea periódica registrada en el planificador
+struct scheduler_task_s {
+    scheduler_task_p task; //!< función a ejecutar
+    uint32_t period;       //!< periodo en ticks
+    uint32_t deadline;     //!< cantidad de ticks a partir de la cual se debe ejecutar
+};
+
+//! Estructura que representa un planificador
+struct scheduler_s {
+    scheduler_driver_p driver;                          //!< funciones de tiempo y de bajo consumo
+    struct scheduler_task_s tasks[SCHEDULER_MAX_TASKS]; //!< tareas registradas
+    uint8_t count;                                      //!< cantidad de tareas registradas
+    scheduler_stats_t stats;                            //!< estadísticas de uso del procesador
+    uint32_t stats_last;                                //!< valor de Cycles en la última medición de los tiempos
+#ifndef USE_DYNAMIC_MEMORY
+    bool used; //!< indica si el struct esta siendo usado en caso de no usar memoria dinamica
+#endif
+};
+
+/* === Private function declarations =============================================================================== */
+
+#ifndef USE_DYNAMIC_MEMORY
+/**
+ * @brief Función para crear un planificador si no se usa memoria dinámica
+ *
+ * @return scheduler_p referencia al planificador creado, NULL si no hay espacio
+ */
+static scheduler_p CreateInstance(void);
+#endif
+
+/**
+ * @brief Función que lee el contador usado para medir el tiempo dormido
+ *
+ * @param self referencia al planificador
+ * @return valor del contador
+ */
+static uint32_t Cycles(scheduler_p self);
+
+/**
+ * @brief Función para saber si se cumplió un plazo, tolera el desborde del contador de ticks
+ *
+ * @param now cantidad de ticks actual
+ * @param deadline plazo
+ * @return devuelve true si @p now es mayor o igual a @p deadline
+ */
+static bool IsDue(uint32_t now, uint32_t deadline);
+
+/**
+ * @brief Función que ejecuta las tareas cuyo plazo se cumplió en el instante indicado
+ *
+ * @param self referencia al planificador
+ * @param now cantidad de ticks leída antes de despachar las tareas
+ * @return devuelve true si se ejecutó alguna tarea
+ */
+static bool RunDue(scheduler_p self, uint32_t now);
+
+/* === Private variable definitions ================================================================================ */
+
+#ifndef USE_DYNAMIC_MEMORY
+//! Array con los planificadores creados si no se utiliza memoria dinámica
+static struct scheduler_s instances[SCHEDULER_MAX_INSTANCE] = {0};
+#endif
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+#ifndef USE_DYNAMIC_MEMORY
+static scheduler_p CreateInstance(void) {
+    scheduler_p self = NULL;
+    int i;
+
+    for (i = 0; i < SCHEDULER_MAX_INSTANCE; i++) {
+        if (!instances[i].used) {
+            instances[i].used = true;
+            self = &instances[i];
+            break;
+        }
+    }
+
+    return self;
+}
+#endif
+
+static uint32_t Cycles(scheduler_p self) {
+    uint32_t result;
+
+    if (self->driver->Cycles != NULL) {
+        result = self->driver->Cycles();
+    } else {
+        result = self->driver->Now();
+    }
+
+    return result;
+}
+
+static bool IsDue(uint32_t now, uint32_t deadline) {
+    return (int32_t)(now - deadline) >= 0;
+}
+
+static bool RunDue(scheduler_p self, uint32_t now) {
+    struct scheduler_task_s * task;
+    uint32_t lateness;
+    bool result = false;
+
+    for (uint8_t i = 0; i < self->count; i++) {
+        task = &self->tasks[i];
+        if (IsDue(now, task->deadline)) {
+            lateness = now - task->deadline;
+            if (lateness > self->stats.worst) {
+                self->stats.worst = lateness;
+            }
+            task->deadline += task->period;
+            if (IsDue(now, task->deadline)) {
+                task->deadline = now + task->period;
+                self->stats.skipped += lateness / task->period;
+                if (self->driver->Missed != NULL) {
+                    self->driver->Missed(task->task, lateness);
+                }
+            }
+            task->task();
+            self->stats.runs++;
+            result = true;
+        }
+    }
+
+    return result;
+}
+
+/* === Public function definitions ================================================================================= */
+
+scheduler_p SchedulerCreate(scheduler_driver_p driver) {
+    scheduler_p self = NULL;
+
+    if (driver != NULL && driver->Now != NULL && driver->Sleep != NULL) {
+#ifdef USE_DYNAMIC_MEMORY
+        self = malloc(sizeof(struct scheduler_s));
+#else
+        self = CreateInstance();
+#endif
+    }
+
+    if (self != NULL) {
+        self->driver = driver;
+        self->count = 0;
+        SchedulerResetStats(self);
+    }
+
+    return self;
+}
+
+int SchedulerAddTask(scheduler_p self, scheduler_task_p task, uint32_t period) {
+    int result = 0;
+
+    if (task == NULL || period == 0 || self->count >= SCHEDULER_MAX_TASKS) {
+        result = -1;
+    } else {
+        self->tasks[self->count].task = task;
+        self->tasks[self->count].period = period;
+        self->tasks[self->count].deadline = self->driver->Now() + period;
+        self->count++;
+    }
+
+    return result;
+}
+
+int SchedulerRemoveTask(scheduler_p self, scheduler_task_p task) {
+    int result = -1;
+    uint8_t i = 0;
+
+    while (i < self->count) {
+        if (self->tasks[i].task == task) {
+            self->count--;
+            self->tasks[i] = self->tasks[self->count];
+            result = 0;
+        } else {
+            i++;
+        }
+    }
+
+    return result;
+}
+
+bool SchedulerRunPending(scheduler_p self) {
+    return RunDue(self, self->driver->Now());
+}
+
+void SchedulerRun(scheduler_p self) {
+    // Se lee el tiempo una sola vez, si llega un tick después de despachar Sleep no duerme y se revisan los plazos
+    uint32_t now = self->driver->Now();
+    uint32_t before;
+    uint32_t after;
+
+    if (!RunDue(self, now)) {
+        before = Cycles(self);
+        self->driver->Sleep(now);
+        after = Cycles(self);
+        // Cada diferencia es menor que una vuelta del contador, la suma de 64 bits no desborda
+        self->stats.idle += (uint32_t)(after - before);
+        self->stats.elapsed += (uint32_t)(after - self->stats_last);
+        self->stats_last = after;
+        self->stats.wakeups++;
+    }
+}
+
+void SchedulerGetStats(scheduler_p self, scheduler_stats_t * stats) {
+    memcpy(stats, &self->stats, sizeof(scheduler_stats_t));
+    stats->elapsed += (uint32_t)(Cycles(self) - self->stats_last);
+}
+
+void SchedulerResetStats(scheduler_p self) {
+    memset(&self->stats, 0, sizeof(scheduler_stats_t));
+    self->stats_last = Cycles(self);
+}
+
+/* === End of documentation ======================================================================================== */
@@ -29,7 +29,7 @@ SPDX-License-Identifier: MIT
 #include "shield.h"
 #include "edusia_config.h"
 #include "shield_config.h"
-#include "chip.h"
+#include "hal.h"
 #include <stddef.h>
 #include <stdlib.h>
 
@@ -134,89 +134,89 @@ static struct shield_s * CreateInstance() {
 #endif
 
 static void InputInit(struct shield_s * self) {
-    Chip_SCU_PinMuxSet(KEY_ACCEPT_PORT, KEY_ACCEPT_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_PULLUP | KEY_ACCEPT_FUNC);
+    HalPinMux(KEY_ACCEPT_PORT, KEY_ACCEPT_PIN, HAL_PIN_INPUT_PULLUP, KEY_ACCEPT_FUNC);
     self->accept = DigitalInputCreate(KEY_ACCEPT_GPIO, KEY_ACCEPT_BIT, false);
 
-    Chip_SCU_PinMuxSet(KEY_CANCEL_PORT, KEY_CANCEL_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_PULLUP | KEY_CANCEL_FUNC);
+    HalPinMux(KEY_CANCEL_PORT, KEY_CANCEL_PIN, HAL_PIN_INPUT_PULLUP, KEY_CANCEL_FUNC);
     self->cancel = DigitalInputCreate(KEY_CANCEL_GPIO, KEY_CANCEL_BIT, false);
 
-    Chip_SCU_PinMuxSet(KEY_F1_PORT, KEY_F1_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_PULLUP | KEY_F1_FUNC);
+    HalPinMux(KEY_F1_PORT, KEY_F1_PIN, HAL_PIN_INPUT_PULLUP, KEY_F1_FUNC);
     self->set_time = DigitalInputCreate(KEY_F1_GPIO, KEY_F1_BIT, false);
 
-    Chip_SCU_PinMuxSet(KEY_F2_PORT, KEY_F2_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_PULLUP | KEY_F2_FUNC);
+    HalPinMux(KEY_F2_PORT, KEY_F2_PIN, HAL_PIN_INPUT_PULLUP, KEY_F2_FUNC);
     self->set_alarm = DigitalInputCreate(KEY_F2_GPIO, KEY_F2_BIT, false);
 
-    Chip_SCU_PinMuxSet(KEY_F3_PORT, KEY_F3_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_PULLUP | KEY_F3_FUNC);
+    HalPinMux(KEY_F3_PORT, KEY_F3_PIN, HAL_PIN_INPUT_PULLUP, KEY_F3_FUNC);
     self->decrement = DigitalInputCreate(KEY_F3_GPIO, KEY_F3_BIT, false);
 
-    Chip_SCU_PinMuxSet(KEY_F4_PORT, KEY_F4_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_PULLUP | KEY_F4_FUNC);
+    HalPinMux(KEY_F4_PORT, KEY_F4_PIN, HAL_PIN_INPUT_PULLUP, KEY_F4_FUNC);
     self->incremet = DigitalInputCreate(KEY_F4_GPIO, KEY_F4_BIT, false);
 }
 
 static void OutputInit(struct shield_s * self) {
-    Chip_SCU_PinMuxSet(RGB_RED_PORT, RGB_RED_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | RGB_RED_FUNC);
+    HalPinMux(RGB_RED_PORT, RGB_RED_PIN, HAL_PIN_OUTPUT, RGB_RED_FUNC);
     self->buzzer = DigitalOutputCreate(RGB_RED_GPIO, RGB_RED_BIT);
 }
 
 static void DigitisInit(void) {
-    Chip_GPIO_ClearValue(LPC_GPIO_PORT, DIGITS_GPIO, DIGITS_MASK);
+    HalGpioClearBits(DIGITS_GPIO, DIGITS_MASK);
 
-    Chip_SCU_PinMuxSet(DIGIT_0_PORT, DIGIT_0_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | DIGIT_0_FUNC);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, DIGIT_0_GPIO, DIGIT_0_BIT, true);
+    HalPinMux(DIGIT_0_PORT, DIGIT_0_PIN, HAL_PIN_OUTPUT, DIGIT_0_FUNC);
+    HalGpioSetDirection(DIGIT_0_GPIO, DIGIT_0_BIT, true);
 
-    Chip_SCU_PinMuxSet(DIGIT_1_PORT, DIGIT_1_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | DIGIT_1_FUNC);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, DIGIT_1_GPIO, DIGIT_1_BIT, true);
+    HalPinMux(DIGIT_1_PORT, DIGIT_1_PIN, HAL_PIN_OUTPUT, DIGIT_1_FUNC);
+    HalGpioSetDirection(DIGIT_1_GPIO, DIGIT_1_BIT, true);
 
-    Chip_SCU_PinMuxSet(DIGIT_2_PORT, DIGIT_2_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | DIGIT_2_FUNC);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, DIGIT_2_GPIO, DIGIT_2_BIT, true);
+    HalPinMux(DIGIT_2_PORT, DIGIT_2_PIN, HAL_PIN_OUTPUT, DIGIT_2_FUNC);
+    HalGpioSetDirection(DIGIT_2_GPIO, DIGIT_2_BIT, true);
 
-    Chip_SCU_PinMuxSet(DIGIT_3_PORT, DIGIT_3_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | DIGIT_3_FUNC);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, DIGIT_3_GPIO, DIGIT_3_BIT, true);
+    HalPinMux(DIGIT_3_PORT, DIGIT_3_PIN, HAL_PIN_OUTPUT, DIGIT_3_FUNC);
+    HalGpioSetDirection(DIGIT_3_GPIO, DIGIT_3_BIT, true);
 }
 
 static void SegmentsInit(void) {
-    Chip_GPIO_ClearValue(LPC_GPIO_PORT, SEGMENTS_GPIO, SEGMENTS_MASK);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_DOT_GPIO, SEGMENT_DOT_BIT, false);
+    HalGpioClearBits(SEGMENTS_GPIO, SEGMENTS_MASK);
+    HalGpioWriteBit(SEGMENT_DOT_GPIO, SEGMENT_DOT_BIT, false);
 
-    Chip_SCU_PinMuxSet(SEGMENT_A_PORT, SEGMENT_A_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_A_FUNC);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_A_GPIO, SEGMENT_A_BIT, true);
+    HalPinMux(SEGMENT_A_PORT, SEGMENT_A_PIN, HAL_PIN_OUTPUT, SEGMENT_A_FUNC);
+    HalGpioSetDirection(SEGMENT_A_GPIO, SEGMENT_A_BIT, true);
 
-    Chip_SCU_PinMuxSet(SEGMENT_B_PORT, SEGMENT_B_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_B_FUNC);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_B_GPIO, SEGMENT_B_BIT, true);
+    HalPinMux(SEGMENT_B_PORT, SEGMENT_B_PIN, HAL_PIN_OUTPUT, SEGMENT_B_FUNC);
+    HalGpioSetDirection(SEGMENT_B_GPIO, SEGMENT_B_BIT, true);
 
-    Chip_SCU_PinMuxSet(SEGMENT_C_PORT, SEGMENT_C_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_C_FUNC);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_C_GPIO, SEGMENT_C_BIT, true);
+    HalPinMux(SEGMENT_C_PORT, SEGMENT_C_PIN, HAL_PIN_OUTPUT, SEGMENT_C_FUNC);
+    HalGpioSetDirection(SEGMENT_C_GPIO, SEGMENT_C_BIT, true);
 
-    Chip_SCU_PinMuxSet(SEGMENT_D_PORT, SEGMENT_D_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_D_FUNC);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_D_GPIO, SEGMENT_D_BIT, true);
+    HalPinMux(SEGMENT_D_PORT, SEGMENT_D_PIN, HAL_PIN_OUTPUT, SEGMENT_D_FUNC);
+    HalGpioSetDirection(SEGMENT_D_GPIO, SEGMENT_D_BIT, true);
 
-    Chip_SCU_PinMuxSet(SEGMENT_E_PORT, SEGMENT_E_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_E_FUNC);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_E_GPIO, SEGMENT_E_BIT, true);
+    HalPinMux(SEGMENT_E_PORT, SEGMENT_E_PIN, HAL_PIN_OUTPUT, SEGMENT_E_FUNC);
+    HalGpioSetDirection(SEGMENT_E_GPIO, SEGMENT_E_BIT, true);
 
-    Chip_SCU_PinMuxSet(SEGMENT_F_PORT, SEGMENT_F_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_F_FUNC);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_F_GPIO, SEGMENT_F_BIT, true);
+    HalPinMux(SEGMENT_F_PORT, SEGMENT_F_PIN, HAL_PIN_OUTPUT, SEGMENT_F_FUNC);
+    HalGpioSetDirection(SEGMENT_F_GPIO, SEGMENT_F_BIT, true);
 
-    Chip_SCU_PinMuxSet(SEGMENT_G_PORT, SEGMENT_G_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_G_FUNC);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_G_GPIO, SEGMENT_G_BIT, true);
+    HalPinMux(SEGMENT_G_PORT, SEGMENT_G_PIN, HAL_PIN_OUTPUT, SEGMENT_G_FUNC);
+    HalGpioSetDirection(SEGMENT_G_GPIO, SEGMENT_G_BIT, true);
 
-    Chip_SCU_PinMuxSet(SEGMENT_DOT_PORT, SEGMENT_DOT_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_DOT_FUNC);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_DOT_GPIO, SEGMENT_DOT_BIT, true);
+    HalPinMux(SEGMENT_DOT_PORT, SEGMENT_DOT_PIN, HAL_PIN_OUTPUT, SEGMENT_DOT_FUNC);
+    HalGpioSetDirection(SEGMENT_DOT_GPIO, SEGMENT_DOT_BIT, true);
 }
 
 static void TurnOffDigits(void) {
-    Chip_GPIO_ClearValue(LPC_GPIO_PORT, DIGITS_GPIO, DIGITS_MASK);
+    HalGpioClearBits(DIGITS_GPIO, DIGITS_MASK);
 }
 
 static void TurnOnDigit(uint8_t digit) {
-    Chip_GPIO_SetValue(LPC_GPIO_PORT, DIGITS_GPIO, (1 << digit) & DIGITS_MASK);
+    HalGpioSetBits(DIGITS_GPIO, (1 << digit) & DIGITS_MASK);
 }
 
 static void UpdateSegments(uint8_t segments) {
-    Chip_GPIO_ClearValue(LPC_GPIO_PORT, SEGMENTS_GPIO, SEGMENTS_MASK);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_DOT_GPIO, SEGMENT_DOT_BIT, false);
+    HalGpioClearBits(SEGMENTS_GPIO, SEGMENTS_MASK);
+    HalGpioWriteBit(SEGMENT_DOT_GPIO, SEGMENT_DOT_BIT, false);
 
-    Chip_GPIO_SetValue(LPC_GPIO_PORT, SEGMENTS_GPIO, (segments & SEGMENTS_MASK));
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_DOT_GPIO, SEGMENT_DOT_BIT, (segments & SEGMENT_DOT_MASK));
+    HalGpioSetBits(SEGMENTS_GPIO, (segments & SEGMENTS_MASK));
+    HalGpioWriteBit(SEGMENT_DOT_GPIO, SEGMENT_DOT_BIT, (segments & SEGMENT_DOT_MASK));
 }
 
 /* === Public function definition ================================================================================== */
@@ -243,4 +243,8 @@ shield_p ShieldCreate(void) {
     return self;
 }
 
+void ShieldWakeOnKeys(hal_handler_p handler) {
+    HalWakeOnChange(KEYS_GPIO, KEYS_MASK, handler);
+}
+
 /* === End of documentation ======================================================================================== */
@@ -0,0 +1,221 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file snapshot.c
+ ** @brief Código fuente de la copia de la configuración del reloj en el almacenamiento no volátil - Electrónica 4 2025
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "snapshot.h"
+#include "crc.h"
+#include "hal.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! Secuencia de un registro borrado
+#define SNAPSHOT_ERASED 0xFFFFFFFFUL
+
+/* === Private data type declarations ============================================================================== */
+
+//! Registro guardado en el almacenamiento, ocupa 16 bytes para que ninguno quede repartido en dos páginas
+typedef struct snapshot_record_s {
+    uint32_t sequence; //!< número de secuencia, crece en uno con cada registro
+    uint8_t version;   //!< versión del formato, SNAPSHOT_VERSION
+    uint8_t flags;     //!< combinación de SNAPSHOT_TIME_VALID, SNAPSHOT_ALARM_SET y SNAPSHOT_ALARM_ACTIVE
+    uint16_t crc;      //!< CRC del registro calculado con este campo en cero
+    uint8_t time[4];   //!< minutos y horas de la hora en BCD
+    uint8_t alarm[4];  //!< minutos y horas de la alarma en BCD
+} snapshot_record_t;
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Función que lee el número de secuencia de un registro
+ *
+ * @param slot posición del registro
+ * @return número de secuencia, SNAPSHOT_ERASED si está borrado
+ */
+static uint32_t ReadSequence(uint32_t slot);
+
+/**
+ * @brief Función que lee un registro y verifica su versión y su CRC
+ *
+ * @param slot posición del registro
+ * @param record variable en la que se devuelve el registro
+ * @return true si el registro es válido
+ */
+static bool ReadRecord(uint32_t slot, snapshot_record_t * record);
+
+/**
+ * @brief Función que calcula el CRC de un registro
+ *
+ * @param record registro, el campo crc no se tiene en cuenta
+ * @return CRC del registro
+ */
+static uint16_t RecordCrc(const snapshot_record_t * record);
+
+/**
+ * @brief Función que busca la posición del último registro escrito
+ *
+ * Las secuencias crecen desde la primera posición hasta el último registro escrito, y después siguen los registros de
+ * la vuelta anterior, con secuencias menores que la de la primera posición, o los borrados.
+ *
+ * @param first secuencia del registro de la primera posición, no debe estar borrado
+ * @return posición del último registro escrito
+ */
+static uint32_t FindNewest(uint32_t first);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Cantidad de registros que entran en el almacenamiento
+static HAL_BOARD_LOCAL uint32_t slots = 0;
+
+//! Posición del próximo registro
+static HAL_BOARD_LOCAL uint32_t next_slot = 0;
+
+//! Secuencia del próximo registro
+static HAL_BOARD_LOCAL uint32_t next_sequence = 0;
+
+//! Última configuración guardada o restaurada
+static HAL_BOARD_LOCAL snapshot_t last;
+
+//! Indica si la variable last tiene una configuración
+static HAL_BOARD_LOCAL bool last_valid = false;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static uint32_t ReadSequence(uint32_t slot) {
+    uint32_t sequence;
+
+    HalStorageRead(slot * sizeof(snapshot_record_t), &sequence, sizeof(sequence));
+
+    return sequence;
+}
+
+static bool ReadRecord(uint32_t slot, snapshot_record_t * record) {
+    HalStorageRead(slot * sizeof(snapshot_record_t), record, sizeof(*record));
+
+    return record->sequence != SNAPSHOT_ERASED && record->version == SNAPSHOT_VERSION &&
+           record->crc == RecordCrc(record);
+}
+
+static uint16_t RecordCrc(const snapshot_record_t * record) {
+    snapshot_record_t copy = *record;
+
+    copy.crc = 0;
+
+    return Crc16(CRC16_INITIAL, &copy, sizeof(copy));
+}
+
+static uint32_t FindNewest(uint32_t first) {
+    uint32_t newest = 0;
+    uint32_t older = slots;
+    uint32_t middle;
+    uint32_t sequence;
+
+    // Se mantiene que la posición newest es de la vuelta actual y la posición older no
+    while (older - newest > 1) {
+        middle = newest + (older - newest) / 2;
+        sequence = ReadSequence(middle);
+        if (sequence != SNAPSHOT_ERASED && sequence >= first) {
+            newest = middle;
+        } else {
+            older = middle;
+        }
+    }
+
+    return newest;
+}
+
+/* === Public function definitions ================================================================================= */
+
+int SnapshotRestore(snapshot_t * snapshot) {
+    snapshot_record_t record;
+    uint32_t first;
+    uint32_t slot;
+    uint32_t tries;
+    int result = -1;
+
+    slots = HalStorageSize() / sizeof(snapshot_record_t);
+    next_slot = 0;
+    next_sequence = 0;
+    last_valid = false;
+
+    first = (slots > 0) ? ReadSequence(0) : SNAPSHOT_ERASED;
+    if (first != SNAPSHOT_ERASED) {
+        slot = FindNewest(first);
+        next_slot = (slot + 1) % slots;
+        next_sequence = ReadSequence(slot) + 1;
+
+        // Solo el último registro puede estar dañado por un corte, los anteriores se revisan si cambió la versión
+        for (tries = 0; tries < slots && result != 0; tries++) {
+            if (ReadRecord(slot, &record)) {
+                snapshot->flags = record.flags;
+                memcpy(snapshot->time, record.time, sizeof(snapshot->time));
+                memcpy(snapshot->alarm, record.alarm, sizeof(snapshot->alarm));
+                last = *snapshot;
+                last_valid = true;
+                // El registro dañado se vuelve a escribir para que las secuencias sigan creciendo
+                next_slot = (slot + 1) % slots;
+                next_sequence = record.sequence + 1;
+                result = 0;
+            }
+            slot = (slot == 0) ? slots - 1 : slot - 1;
+        }
+    }
+
+    return result;
+}
+
+int SnapshotSave(const snapshot_t * snapshot) {
+    snapshot_record_t record;
+    int result = 1;
+
+    if (slots == 0) {
+        result = -1;
+    } else if (!last_valid || memcmp(&last, snapshot, sizeof(last)) != 0) {
+        record.sequence = next_sequence;
+        record.version = SNAPSHOT_VERSION;
+        record.flags = snapshot->flags;
+        memcpy(record.time, snapshot->time, sizeof(record.time));
+        memcpy(record.alarm, snapshot->alarm, sizeof(record.alarm));
+        record.crc = RecordCrc(&record);
+
+        if (HalStorageWrite(next_slot * sizeof(record), &record, sizeof(record))) {
+            last = *snapshot;
+            last_valid = true;
+            next_slot = (next_slot + 1) % slots;
+            next_sequence++;
+            result = 0;
+        } else {
+            result = -1;
+        }
+    }
+
+    return result;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,100 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file state_machine.c
+ ** @brief Código fuente del despachador de máquinas de estado definidas por tablas - Electrónica 4 2025
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "state_machine.h"
+#include "event_trace.h"
+#include <stddef.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Función que cambia el estado actual y ejecuta la función de entrada
+ *
+ * @param machine máquina de estados
+ * @param state estado al que se entra
+ */
+static void Enter(state_machine_t * machine, uint8_t state);
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void Enter(state_machine_t * machine, uint8_t state) {
+    machine->current = state;
+    if (machine->table->Enter != NULL) {
+        machine->table->Enter(state);
+    }
+}
+
+/* === Public function definitions ================================================================================= */
+
+int StateMachineInit(state_machine_t * machine, const state_machine_table_t * table, uint8_t initial) {
+    int result = 0;
+
+    if (table == NULL || initial >= table->states) {
+        result = -1;
+    } else {
+        machine->table = table;
+        Enter(machine, initial);
+    }
+
+    return result;
+}
+
+bool StateMachineDispatch(state_machine_t * machine, uint8_t event) {
+    const state_transition_t * transition;
+    uint8_t previous = machine->current;
+    uint8_t next;
+    bool result = false;
+
+    if (event < machine->table->events) {
+        transition = &machine->table->transitions[machine->current * machine->table->events + event];
+        if (transition->handled) {
+            result = true;
+            next = transition->next;
+            if (transition->action != NULL) {
+                next = transition->action(next);
+            }
+            if (next < machine->table->states) {
+                Enter(machine, next);
+            }
+            EVENT_TRACE(EVENT_TRACE_STATE_CHANGED, event, (uint16_t)(previous << 8 | next));
+        }
+    }
+
+    return result;
+}
+
+uint8_t StateMachineGetState(const state_machine_t * machine) {
+    return machine->current;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,144 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file telemetry.c
+ ** @brief Código fuente de las tramas binarias de telemetría - Electrónica 4 2025
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "telemetry.h"
+#include "crc.h"
+#include <stdbool.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! Cantidad máxima de bytes sin ceros de un bloque COBS
+#define COBS_BLOCK 254
+
+/* === Private data type declarations ============================================================================== */
+
+//! Estado del codificador COBS
+typedef struct cobs_s {
+    uint8_t * output; //!< trama que se está armando
+    size_t code;      //!< posición del byte que indica el largo del bloque actual
+    size_t length;    //!< bytes escritos en la trama
+} cobs_t;
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Función que agrega bytes a la trama codificada
+ *
+ * @param cobs estado del codificador
+ * @param data bytes a agregar
+ * @param size cantidad de bytes
+ */
+static void CobsWrite(cobs_t * cobs, const uint8_t * data, size_t size);
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void CobsWrite(cobs_t * cobs, const uint8_t * data, size_t size) {
+    size_t index;
+
+    for (index = 0; index < size; index++) {
+        // Un cero cierra el bloque, el byte de largo del bloque indica donde estaba
+        if (data[index] == 0) {
+            cobs->output[cobs->code] = (uint8_t)(cobs->length - cobs->code);
+            cobs->code = cobs->length++;
+        } else {
+            cobs->output[cobs->length++] = data[index];
+            if (cobs->length - cobs->code == COBS_BLOCK + 1) {
+                cobs->output[cobs->code] = COBS_BLOCK + 1;
+                cobs->code = cobs->length++;
+            }
+        }
+    }
+}
+
+/* === Public function definitions ================================================================================= */
+
+size_t TelemetryEncode(uint8_t type, uint8_t sequence, const void * payload, size_t size, uint8_t * frame) {
+    uint8_t header[2] = {type, sequence};
+    uint8_t trailer[2];
+    uint16_t crc;
+    cobs_t cobs = {.output = frame, .code = 1, .length = 2};
+    size_t result = 0;
+
+    if (size <= TELEMETRY_MAX_PAYLOAD) {
+        crc = Crc16(Crc16(CRC16_INITIAL, header, sizeof(header)), payload, size);
+        trailer[0] = (uint8_t)crc;
+        trailer[1] = (uint8_t)(crc >> 8);
+
+        frame[0] = 0;
+        CobsWrite(&cobs, header, sizeof(header));
+        CobsWrite(&cobs, payload, size);
+        CobsWrite(&cobs, trailer, sizeof(trailer));
+        frame[cobs.code] = (uint8_t)(cobs.length - cobs.code);
+        frame[cobs.length++] = 0;
+        result = cobs.length;
+    }
+
+    return result;
+}
+
+int TelemetryDecode(const uint8_t * data, size_t size, telemetry_frame_t * frame) {
+    uint8_t decoded[TELEMETRY_MAX_PAYLOAD + TELEMETRY_OVERHEAD];
+    size_t length = 0;
+    size_t index = 0;
+    size_t block;
+    bool valid = (size > 0);
+    int result = -1;
+
+    while (valid && index < size) {
+        block = data[index++];
+        valid = (block != 0) && (index + block - 1 <= size) && (length + block - 1 <= sizeof(decoded));
+        if (valid) {
+            memcpy(&decoded[length], &data[index], block - 1);
+            length += block - 1;
+            index += block - 1;
+            // Un bloque corto termina en un cero, salvo el último de la trama
+            if (block <= COBS_BLOCK && index < size) {
+                valid = (length < sizeof(decoded));
+                if (valid) {
+                    decoded[length++] = 0;
+                }
+            }
+        }
+    }
+
+    if (valid && length >= TELEMETRY_OVERHEAD &&
+        Crc16(CRC16_INITIAL, decoded, length - 2) == (decoded[length - 2] | (decoded[length - 1] << 8))) {
+        frame->type = decoded[0];
+        frame->sequence = decoded[1];
+        frame->size = (uint16_t)(length - TELEMETRY_OVERHEAD);
+        memcpy(frame->payload.bytes, &decoded[2], frame->size);
+        result = 0;
+    }
+
+    return result;
+}
+
+/* === End of documentation ======================================================================================== */
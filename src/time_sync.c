@@ -0,0 +1,80 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file time_sync.c
+ ** @brief Código fuente de la sincronización de la hora con un servidor por el puerto serie - Electrónica 4 2025
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "time_sync.h"
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+/* === Public function definitions ================================================================================= */
+
+void TimeSyncInit(time_sync_t * sync) {
+    memset(sync, 0, sizeof(time_sync_t));
+}
+
+uint8_t TimeSyncRequest(time_sync_t * sync, int64_t now) {
+    sync->sequence++;
+    sync->sent = now;
+    sync->pending = true;
+    sync->requests++;
+
+    return sync->sequence;
+}
+
+int TimeSyncResponse(time_sync_t * sync, uint32_t sequence, int64_t received, uint32_t hold, int64_t now,
+                     time_sync_sample_t * sample) {
+    int64_t sent = (int64_t)received + hold;
+    int result = -1;
+
+    // Cada pedido se usa una sola vez, una respuesta repetida o atrasada no corrige dos veces el reloj
+    if (sync->pending && sequence == sync->sequence) {
+        sync->pending = false;
+        sample->offset = ((received - sync->sent) + (sent - now)) / 2;
+        sample->delay = (now - sync->sent) - (int64_t)hold;
+        result = (sample->delay >= 0 && sample->delay <= TIME_SYNC_MAX_DELAY) ? 0 : -2;
+    }
+
+    if (result == 0) {
+        sync->accepted++;
+        sync->last = *sample;
+    } else {
+        sync->rejected++;
+    }
+
+    return result;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,272 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file timers.c
+ ** @brief Código fuente de los cronómetros y temporizadores que comparten el tick del reloj - Electrónica 4 2025
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "timers.h"
+#include "hal.h"
+#include <stddef.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+struct stopwatch_s {
+    bool used;            //!< indica si el cronómetro fue tomado del pool
+    bool running;         //!< indica si el cronómetro está andando
+    uint32_t start;       //!< base de tiempo cuando arrancó por última vez
+    uint32_t accumulated; //!< milisegundos medidos antes de la última vez que arrancó
+    uint32_t lap;         //!< tiempo parcial de la última vuelta marcada
+};
+
+struct countdown_s {
+    bool used;                   //!< indica si el temporizador fue tomado del pool
+    bool running;                //!< indica si el temporizador está andando
+    uint32_t deadline;           //!< base de tiempo en la que termina si está andando
+    uint32_t remaining;          //!< milisegundos que faltaban al detenerlo
+    countdown_expired_p expired; //!< función que se llama al terminar
+    void * context;              //!< dato que recibe la función
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Función que busca el temporizador que termina primero entre los que están andando
+ */
+static void Rearm(void);
+
+/**
+ * @brief Función que detiene los temporizadores que terminaron, llama a sus funciones y vuelve a buscar el próximo
+ */
+static void ExpireCountdowns(void);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Cronómetros del pool, propios de cada placa simulada
+static HAL_BOARD_LOCAL struct stopwatch_s stopwatches[TIMERS_STOPWATCHES];
+
+//! Temporizadores del pool, propios de cada placa simulada
+static HAL_BOARD_LOCAL struct countdown_s countdowns[TIMERS_COUNTDOWNS];
+
+//! Base de tiempo en milisegundos
+static HAL_BOARD_LOCAL volatile uint32_t now = 0;
+
+//! Base de tiempo en la que termina el próximo temporizador, solo vale si @ref armed es true
+static HAL_BOARD_LOCAL uint32_t next_deadline = 0;
+
+//! Indica si hay algún temporizador andando
+static HAL_BOARD_LOCAL bool armed = false;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void Rearm(void) {
+    uint8_t index;
+
+    armed = false;
+    for (index = 0; index < TIMERS_COUNTDOWNS; index++) {
+        if (countdowns[index].running) {
+            // La resta con signo compara bien aunque la base de tiempo dé la vuelta
+            if (!armed || (int32_t)(countdowns[index].deadline - next_deadline) < 0) {
+                next_deadline = countdowns[index].deadline;
+                armed = true;
+            }
+        }
+    }
+}
+
+static void ExpireCountdowns(void) {
+    struct countdown_s * countdown;
+    uint8_t index;
+
+    for (index = 0; index < TIMERS_COUNTDOWNS; index++) {
+        countdown = &countdowns[index];
+        if (countdown->running && (int32_t)(now - countdown->deadline) >= 0) {
+            countdown->running = false;
+            countdown->remaining = 0;
+            if (countdown->expired != NULL) {
+                countdown->expired(countdown, countdown->context);
+            }
+        }
+    }
+    Rearm();
+}
+
+/* === Public function definitions ================================================================================= */
+
+void TimersInit(void) {
+    memset(stopwatches, 0, sizeof(stopwatches));
+    memset(countdowns, 0, sizeof(countdowns));
+    now = 0;
+    next_deadline = 0;
+    armed = false;
+}
+
+void TimersTick(uint32_t milliseconds) {
+    now += milliseconds;
+
+    // Los cronómetros no se tocan y los temporizadores solo se revisan cuando termina el más cercano
+    if (armed && (int32_t)(now - next_deadline) >= 0) {
+        ExpireCountdowns();
+    }
+}
+
+uint32_t TimersNow(void) {
+    return now;
+}
+
+stopwatch_p StopwatchCreate(void) {
+    stopwatch_p self = NULL;
+    uint8_t index;
+
+    for (index = 0; index < TIMERS_STOPWATCHES && self == NULL; index++) {
+        if (!stopwatches[index].used) {
+            self = &stopwatches[index];
+            memset(self, 0, sizeof(struct stopwatch_s));
+            self->used = true;
+        }
+    }
+
+    return self;
+}
+
+void StopwatchDestroy(stopwatch_p self) {
+    self->used = false;
+    self->running = false;
+}
+
+void StopwatchStart(stopwatch_p self) {
+    if (!self->running) {
+        self->start = now;
+        self->running = true;
+    }
+}
+
+void StopwatchStop(stopwatch_p self) {
+    if (self->running) {
+        self->accumulated += now - self->start;
+        self->running = false;
+    }
+}
+
+void StopwatchReset(stopwatch_p self) {
+    self->start = now;
+    self->accumulated = 0;
+    self->lap = 0;
+}
+
+uint32_t StopwatchElapsed(stopwatch_p self) {
+    uint32_t result = self->accumulated;
+
+    if (self->running) {
+        result += now - self->start;
+    }
+
+    return result;
+}
+
+uint32_t StopwatchLap(stopwatch_p self) {
+    uint32_t elapsed = StopwatchElapsed(self);
+    uint32_t result = elapsed - self->lap;
+
+    self->lap = elapsed;
+
+    return result;
+}
+
+bool StopwatchIsRunning(stopwatch_p self) {
+    return self->running;
+}
+
+countdown_p CountdownCreate(countdown_expired_p expired, void * context) {
+    countdown_p self = NULL;
+    uint8_t index;
+
+    for (index = 0; index < TIMERS_COUNTDOWNS && self == NULL; index++) {
+        if (!countdowns[index].used) {
+            self = &countdowns[index];
+            memset(self, 0, sizeof(struct countdown_s));
+            self->used = true;
+            self->expired = expired;
+            self->context = context;
+        }
+    }
+
+    return self;
+}
+
+void CountdownDestroy(countdown_p self) {
+    self->running = false;
+    self->used = false;
+    Rearm();
+}
+
+int CountdownStart(countdown_p self, uint32_t milliseconds) {
+    int result = -1;
+
+    if (milliseconds > 0 && milliseconds <= TIMERS_MAX_DURATION) {
+        self->remaining = milliseconds;
+        CountdownResume(self);
+        result = 0;
+    }
+
+    return result;
+}
+
+void CountdownStop(countdown_p self) {
+    if (self->running) {
+        self->remaining = self->deadline - now;
+        self->running = false;
+        Rearm();
+    }
+}
+
+void CountdownResume(countdown_p self) {
+    if (self->remaining > 0) {
+        self->deadline = now + self->remaining;
+        self->running = true;
+        if (!armed || (int32_t)(self->deadline - next_deadline) < 0) {
+            next_deadline = self->deadline;
+            armed = true;
+        }
+    }
+}
+
+uint32_t CountdownRemaining(countdown_p self) {
+    uint32_t result = self->remaining;
+
+    if (self->running) {
+        result = self->deadline - now;
+    }
+
+    return result;
+}
+
+bool CountdownIsRunning(countdown_p self) {
+    return self->running;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,308 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file timezone.c
+ ** @brief Código fuente de las zonas horarias con horario de verano - Electrónica 4 2025
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "timezone.h"
+#include "calendar.h"
+#include <stddef.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! Hora local de un cambio si la regla no la indica
+#define TIMEZONE_DEFAULT_TIME  (2L * 3600L)
+
+//! Máximo de horas de un desplazamiento o de la hora de un cambio, según POSIX
+#define TIMEZONE_MAX_HOURS     167
+
+//! Reglas que se usan si la zona tiene horario de verano pero no indica cuando empieza y termina, las de EE.UU.
+#define TIMEZONE_DEFAULT_RULES ",M3.2.0,M11.1.0"
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Función que lee un número decimal
+ *
+ * @param text texto a leer
+ * @param value variable en la que se devuelve el número
+ * @param max máximo valor aceptado
+ * @return texto que sigue al número, NULL si no hay un número o es mayor al máximo
+ */
+static const char * ParseNumber(const char * text, uint32_t * value, uint32_t max);
+
+/**
+ * @brief Función que saltea el nombre de un horario, tres letras o más o un texto entre < y >
+ *
+ * @param text texto a leer
+ * @return texto que sigue al nombre, NULL si no es un nombre válido
+ */
+static const char * ParseName(const char * text);
+
+/**
+ * @brief Función que lee una hora con signo opcional en el formato hh[:mm[:ss]]
+ *
+ * @param text texto a leer
+ * @param seconds variable en la que se devuelve la hora en segundos
+ * @return texto que sigue a la hora, NULL si no es una hora válida
+ */
+static const char * ParseTime(const char * text, int32_t * seconds);
+
+/**
+ * @brief Función que lee una regla de inicio o de fin del horario de verano
+ *
+ * @param text texto a leer
+ * @param rule variable en la que se devuelve la regla
+ * @return texto que sigue a la regla, NULL si no es una regla válida
+ */
+static const char * ParseRule(const char * text, timezone_rule_t * rule);
+
+/**
+ * @brief Función que calcula el día en que se aplica una regla en un año
+ *
+ * @param rule regla
+ * @param year año
+ * @return días desde el 1 de enero de 1970
+ */
+static int32_t RuleDay(const timezone_rule_t * rule, int16_t year);
+
+/**
+ * @brief Función que agrega un cambio a la tabla manteniéndola ordenada por instante
+ *
+ * @param zone zona
+ * @param at instante del cambio en segundos UTC
+ * @param offset desplazamiento desde ese instante
+ */
+static void AddTransition(timezone_t * zone, int64_t at, int32_t offset);
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static const char * ParseNumber(const char * text, uint32_t * value, uint32_t max) {
+    const char * result = NULL;
+
+    *value = 0;
+    while (*text >= '0' && *text <= '9' && *value <= max) {
+        *value = *value * 10 + (uint32_t)(*text - '0');
+        text++;
+        result = text;
+    }
+
+    return (*value <= max) ? result : NULL;
+}
+
+static const char * ParseName(const char * text) {
+    const char * start = text;
+    const char * result = NULL;
+
+    if (*text == '<') {
+        // Los nombres entre < y > pueden tener números y signos, como <-03>
+        for (text++; *text != '\0' && *text != '>'; text++) {
+        }
+        result = (*text == '>' && text - start > 1) ? text + 1 : NULL;
+    } else {
+        while ((*text >= 'A' && *text <= 'Z') || (*text >= 'a' && *text <= 'z')) {
+            text++;
+        }
+        result = (text - start >= 3) ? text : NULL;
+    }
+
+    return result;
+}
+
+static const char * ParseTime(const char * text, int32_t * seconds) {
+    uint32_t hours = 0;
+    uint32_t minutes = 0;
+    uint32_t rest = 0;
+    int32_t sign = 1;
+
+    if (*text == '+' || *text == '-') {
+        sign = (*text == '-') ? -1 : 1;
+        text++;
+    }
+    text = ParseNumber(text, &hours, TIMEZONE_MAX_HOURS);
+    if (text != NULL && *text == ':') {
+        text = ParseNumber(text + 1, &minutes, 59);
+        if (text != NULL && *text == ':') {
+            text = ParseNumber(text + 1, &rest, 59);
+        }
+    }
+    *seconds = sign * (int32_t)(hours * 3600U + minutes * 60U + rest);
+
+    return text;
+}
+
+static const char * ParseRule(const char * text, timezone_rule_t * rule) {
+    uint32_t value;
+
+    rule->time = TIMEZONE_DEFAULT_TIME;
+    if (*text == 'M') {
+        rule->kind = TIMEZONE_RULE_MONTH_WEEK_DAY;
+        text = ParseNumber(text + 1, &value, 12);
+        rule->month = (uint8_t)value;
+        if (text != NULL && *text == '.') {
+            text = ParseNumber(text + 1, &value, 5);
+            rule->week = (uint8_t)value;
+        } else {
+            text = NULL;
+        }
+        if (text != NULL && *text == '.') {
+            text = ParseNumber(text + 1, &value, 6);
+            rule->weekday = (uint8_t)value;
+        } else {
+            text = NULL;
+        }
+        if (text != NULL && (rule->month == 0 || rule->week == 0)) {
+            text = NULL;
+        }
+    } else if (*text == 'J') {
+        rule->kind = TIMEZONE_RULE_JULIAN;
+        text = ParseNumber(text + 1, &value, 365);
+        rule->day = (uint16_t)value;
+        text = (rule->day == 0) ? NULL : text;
+    } else {
+        rule->kind = TIMEZONE_RULE_DAY_OF_YEAR;
+        text = ParseNumber(text, &value, 365);
+        rule->day = (uint16_t)value;
+    }
+
+    if (text != NULL && *text == '/') {
+        text = ParseTime(text + 1, &rule->time);
+    }
+
+    return text;
+}
+
+static int32_t RuleDay(const timezone_rule_t * rule, int16_t year) {
+    calendar_date_t date = {.year = year, .month = 1, .day = 1};
+    int32_t first;
+    int32_t result;
+
+    if (rule->kind == TIMEZONE_RULE_MONTH_WEEK_DAY) {
+        date.month = rule->month;
+        first = CalendarDaysFromCivil(&date);
+        result = first + (rule->weekday + 7 - CalendarWeekday(first)) % 7 + (rule->week - 1) * 7;
+        // La semana 5 es la última, que puede ser la cuarta
+        if (result - first >= CalendarDaysInMonth(year, rule->month)) {
+            result -= 7;
+        }
+    } else if (rule->kind == TIMEZONE_RULE_JULIAN) {
+        result = CalendarDaysFromCivil(&date) + rule->day - 1;
+        // Jn no cuenta el 29 de febrero, que es el día 60 en los años bisiestos
+        if (rule->day >= 60 && CalendarDaysInMonth(year, 2) == 29) {
+            result++;
+        }
+    } else {
+        result = CalendarDaysFromCivil(&date) + rule->day;
+    }
+
+    return result;
+}
+
+static void AddTransition(timezone_t * zone, int64_t at, int32_t offset) {
+    uint8_t index;
+
+    for (index = zone->count; index > 0 && zone->transitions[index - 1].at > at; index--) {
+        zone->transitions[index] = zone->transitions[index - 1];
+    }
+    zone->transitions[index].at = at;
+    zone->transitions[index].offset = offset;
+    zone->count++;
+}
+
+/* === Public function definitions ================================================================================= */
+
+int TimezoneParse(timezone_t * zone, const char * text) {
+    int32_t value = 0;
+
+    zone->has_daylight = false;
+    zone->count = 0;
+    zone->year = 0;
+    zone->valid_until = TIMEZONE_NEVER;
+
+    text = (text != NULL) ? ParseName(text) : NULL;
+    text = (text != NULL) ? ParseTime(text, &value) : NULL;
+    zone->standard = -value;
+    zone->daylight = zone->standard;
+
+    if (text != NULL && *text != '\0') {
+        zone->has_daylight = true;
+        zone->daylight = zone->standard + 3600;
+        text = ParseName(text);
+        if (text != NULL && *text != ',' && *text != '\0') {
+            text = ParseTime(text, &value);
+            zone->daylight = -value;
+        }
+        if (text != NULL && *text == '\0') {
+            text = TIMEZONE_DEFAULT_RULES;
+        }
+        text = (text != NULL && *text == ',') ? ParseRule(text + 1, &zone->start) : NULL;
+        text = (text != NULL && *text == ',') ? ParseRule(text + 1, &zone->end) : NULL;
+    }
+
+    return (text != NULL && *text == '\0') ? 0 : -1;
+}
+
+void TimezoneCompile(timezone_t * zone, int16_t year) {
+    calendar_date_t date = {.year = year + TIMEZONE_YEARS, .month = 1, .day = 1};
+    int16_t current;
+
+    zone->year = year;
+    zone->count = 0;
+    zone->valid_until = TIMEZONE_NEVER;
+
+    if (zone->has_daylight) {
+        // El inicio se indica en el horario normal y el fin en el de verano
+        for (current = year; current < year + TIMEZONE_YEARS; current++) {
+            AddTransition(zone,
+                          (int64_t)RuleDay(&zone->start, current) * CALENDAR_SECONDS_PER_DAY + zone->start.time -
+                              zone->standard,
+                          zone->daylight);
+            AddTransition(zone,
+                          (int64_t)RuleDay(&zone->end, current) * CALENDAR_SECONDS_PER_DAY + zone->end.time -
+                              zone->daylight,
+                          zone->standard);
+        }
+        zone->valid_until = (int64_t)CalendarDaysFromCivil(&date) * CALENDAR_SECONDS_PER_DAY;
+    }
+}
+
+int32_t TimezoneLookup(const timezone_t * zone, int64_t utc, int64_t * next) {
+    // Las reglas se repiten cada año, antes del primer cambio rige el desplazamiento del último
+    int32_t result = (zone->count > 0) ? zone->transitions[zone->count - 1].offset : zone->standard;
+    uint8_t index;
+
+    for (index = 0; index < zone->count && utc >= zone->transitions[index].at; index++) {
+        result = zone->transitions[index].offset;
+    }
+    *next = (index < zone->count) ? zone->transitions[index].at : zone->valid_until;
+
+    return result;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,154 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file world_clock.c
+ ** @brief Código fuente de las vistas de la hora de otras zonas sobre un mismo reloj - Electrónica 4 2025
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "world_clock.h"
+#include "hal.h"
+#include <stddef.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! Instante que indica que la vista todavía no calculó su hora
+#define WORLD_CLOCK_STALE INT64_MIN
+
+/* === Private data type declarations ============================================================================== */
+
+struct world_clock_s {
+    clock_p clock;        //!< reloj principal, NULL si la vista está libre
+    int32_t utc_offset;   //!< segundos que se suman a la hora UTC del reloj
+    int64_t local;        //!< segundos locales desde 1970 de la hora guardada, @ref WORLD_CLOCK_STALE si no hay
+    int32_t days;         //!< días desde 1970 de la fecha guardada
+    clock_time_u time;    //!< hora guardada en formato BCD
+    calendar_date_t date; //!< fecha guardada
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Función que calcula la hora y la fecha de la vista si el reloj principal avanzó desde la última consulta
+ *
+ * @param view referencia a la vista
+ */
+static void Materialize(world_clock_p view);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Vistas del pool, propias de cada placa simulada
+static HAL_BOARD_LOCAL struct world_clock_s views[WORLD_CLOCK_VIEWS];
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void Materialize(world_clock_p self) {
+    int64_t local = ClockGetEpochSeconds(self->clock) + self->utc_offset;
+    int64_t days;
+    uint32_t seconds;
+
+    if (local != self->local) {
+        days = local / (int64_t)CALENDAR_SECONDS_PER_DAY;
+        // Redondea hacia abajo también antes de 1970
+        if (days * (int64_t)CALENDAR_SECONDS_PER_DAY > local) {
+            days--;
+        }
+        seconds = (uint32_t)(local - days * (int64_t)CALENDAR_SECONDS_PER_DAY);
+
+        self->time.time.hours[1] = (uint8_t)(seconds / 36000);
+        self->time.time.hours[0] = (uint8_t)(seconds / 3600 % 10);
+        self->time.time.minutes[1] = (uint8_t)(seconds / 600 % 6);
+        self->time.time.minutes[0] = (uint8_t)(seconds / 60 % 10);
+        self->time.time.seconds[1] = (uint8_t)(seconds % 60 / 10);
+        self->time.time.seconds[0] = (uint8_t)(seconds % 10);
+
+        if (self->local == WORLD_CLOCK_STALE || (int32_t)days != self->days) {
+            self->days = (int32_t)days;
+            CalendarCivilFromDays(self->days, &self->date);
+        }
+        self->local = local;
+    }
+}
+
+/* === Public function definitions ================================================================================= */
+
+void WorldClockInit(void) {
+    memset(views, 0, sizeof(views));
+}
+
+world_clock_p WorldClockCreate(clock_p clock, int32_t utc_offset) {
+    world_clock_p self = NULL;
+    uint8_t index;
+
+    if (clock != NULL && utc_offset >= -(int32_t)WORLD_CLOCK_MAX_OFFSET &&
+        utc_offset <= (int32_t)WORLD_CLOCK_MAX_OFFSET) {
+        for (index = 0; index < WORLD_CLOCK_VIEWS && self == NULL; index++) {
+            if (views[index].clock == NULL) {
+                self = &views[index];
+                memset(self, 0, sizeof(struct world_clock_s));
+                self->clock = clock;
+                self->utc_offset = utc_offset;
+                self->local = WORLD_CLOCK_STALE;
+            }
+        }
+    }
+
+    return self;
+}
+
+void WorldClockDestroy(world_clock_p self) {
+    self->clock = NULL;
+}
+
+int WorldClockSetOffset(world_clock_p self, int32_t utc_offset) {
+    int result = 0;
+
+    if (utc_offset >= -(int32_t)WORLD_CLOCK_MAX_OFFSET && utc_offset <= (int32_t)WORLD_CLOCK_MAX_OFFSET) {
+        self->utc_offset = utc_offset;
+        self->local = WORLD_CLOCK_STALE;
+        result = 1;
+    }
+
+    return result;
+}
+
+int32_t WorldClockGetOffset(world_clock_p self) {
+    return self->utc_offset;
+}
+
+int WorldClockGetTime(world_clock_p self, clock_time_u * current_time) {
+    Materialize(self);
+    memcpy(current_time, &self->time, sizeof(clock_time_u));
+
+    return ClockIsTimeValid(self->clock);
+}
+
+int WorldClockGetDate(world_clock_p self, calendar_date_t * current_date) {
+    Materialize(self);
+    memcpy(current_date, &self->date, sizeof(calendar_date_t));
+
+    return ClockIsTimeValid(self->clock);
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,154 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file test_calendar.c
+ ** @brief Código para testeo de la conversión entre días y fechas del calendario gregoriano - Electrónica 4 2025
+ **/
+
+/**
+ * Pruebas a realizar
+- El 1 de enero de 1970 es el día 0 y fue jueves.
+- Fechas conocidas antes y después de 1970 se convierten en los dos sentidos.
+- Todos los días desde el año 1 hasta el 9999 siguen al anterior, vuelven al mismo número y avanzan el día de la semana.
+- Los meses tienen la cantidad de días correcta, con los bisiestos de los años múltiplos de 4, 100 y 400.
+- Se rechazan las fechas con meses o días que no existen.
+ *
+ */
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "unity.h"
+
+#include "calendar.h"
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+//! Fecha conocida y su cantidad de días desde 1970
+typedef struct known_date_s {
+    calendar_date_t date; //!< fecha con el día de la semana
+    int32_t days;         //!< días desde el 1 de enero de 1970
+} known_date_t;
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+/**
+ * @brief Función que avanza una fecha un día contando los días de cada mes, como referencia de la conversión
+ *
+ * @param date fecha a avanzar
+ */
+static void NextDay(calendar_date_t * date) {
+    date->weekday = (uint8_t)((date->weekday + 1) % 7);
+    date->day++;
+    if (date->day > CalendarDaysInMonth(date->year, date->month)) {
+        date->day = 1;
+        date->month++;
+        if (date->month > 12) {
+            date->month = 1;
+            date->year++;
+        }
+    }
+}
+
+/* === Public function definitions ================================================================================= */
+
+// 1-El 1 de enero de 1970 es el día 0 y fue jueves
+void test_unix_epoch_is_day_zero(void) {
+    calendar_date_t date = {.year = 1970, .month = 1, .day = 1};
+
+    TEST_ASSERT_EQUAL_INT32(0, CalendarDaysFromCivil(&date));
+    CalendarCivilFromDays(0, &date);
+    TEST_ASSERT_EQUAL_INT16(1970, date.year);
+    TEST_ASSERT_EQUAL_UINT8(1, date.month);
+    TEST_ASSERT_EQUAL_UINT8(1, date.day);
+    TEST_ASSERT_EQUAL_UINT8(CALENDAR_THURSDAY, date.weekday);
+}
+
+// 2-Fechas conocidas antes y después de 1970 se convierten en los dos sentidos
+void test_known_dates(void) {
+    static const known_date_t KNOWN[] = {
+        {{1, 1, 1, CALENDAR_MONDAY}, -719162},
+        {{1600, 1, 1, CALENDAR_SATURDAY}, -135140},
+        {{1969, 12, 31, CALENDAR_WEDNESDAY}, -1},
+        {{2000, 2, 29, CALENDAR_TUESDAY}, 11016},
+        {{2026, 10, 19, CALENDAR_MONDAY}, 20745},
+        {{2400, 12, 31, CALENDAR_SUNDAY}, 157419},
+    };
+    calendar_date_t date;
+
+    for (unsigned index = 0; index < sizeof(KNOWN) / sizeof(KNOWN[0]); index++) {
+        TEST_ASSERT_EQUAL_INT32(KNOWN[index].days, CalendarDaysFromCivil(&KNOWN[index].date));
+        CalendarCivilFromDays(KNOWN[index].days, &date);
+        TEST_ASSERT_EQUAL_INT16(KNOWN[index].date.year, date.year);
+        TEST_ASSERT_EQUAL_UINT8(KNOWN[index].date.month, date.month);
+        TEST_ASSERT_EQUAL_UINT8(KNOWN[index].date.day, date.day);
+        TEST_ASSERT_EQUAL_UINT8(KNOWN[index].date.weekday, date.weekday);
+    }
+}
+
+// 3-Todos los días desde el año 1 hasta el 9999 siguen al anterior, vuelven al mismo número y avanzan el día de la
+// semana
+void test_every_day_of_ten_millennia(void) {
+    calendar_date_t expected = {.year = 1, .month = 1, .day = 1, .weekday = CALENDAR_MONDAY};
+    calendar_date_t date;
+    int32_t days = CalendarDaysFromCivil(&expected);
+
+    while (expected.year < 10000) {
+        CalendarCivilFromDays(days, &date);
+        if (date.year != expected.year || date.month != expected.month || date.day != expected.day ||
+            date.weekday != expected.weekday || CalendarDaysFromCivil(&date) != days) {
+            TEST_FAIL_MESSAGE("La conversión no coincide con la fecha de referencia");
+        }
+        NextDay(&expected);
+        days++;
+    }
+    TEST_ASSERT_EQUAL_INT32(2932897, days);
+}
+
+// 4-Los meses tienen la cantidad de días correcta, con los bisiestos de los años múltiplos de 4, 100 y 400
+void test_days_in_month(void) {
+    static const uint8_t DAYS[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+
+    for (uint8_t month = 1; month <= 12; month++) {
+        TEST_ASSERT_EQUAL_UINT8(DAYS[month - 1], CalendarDaysInMonth(2025, month));
+    }
+    TEST_ASSERT_EQUAL_UINT8(29, CalendarDaysInMonth(2024, 2));
+    TEST_ASSERT_EQUAL_UINT8(28, CalendarDaysInMonth(2100, 2));
+    TEST_ASSERT_EQUAL_UINT8(29, CalendarDaysInMonth(2000, 2));
+}
+
+// 5-Se rechazan las fechas con meses o días que no existen
+void test_invalid_dates(void) {
+    TEST_ASSERT_TRUE(CalendarValidDate(&(calendar_date_t){.year = 2000, .month = 2, .day = 29}));
+    TEST_ASSERT_FALSE(CalendarValidDate(&(calendar_date_t){.year = 2100, .month = 2, .day = 29}));
+    TEST_ASSERT_FALSE(CalendarValidDate(&(calendar_date_t){.year = 2025, .month = 4, .day = 31}));
+    TEST_ASSERT_FALSE(CalendarValidDate(&(calendar_date_t){.year = 2025, .month = 13, .day = 1}));
+    TEST_ASSERT_FALSE(CalendarValidDate(&(calendar_date_t){.year = 2025, .month = 0, .day = 1}));
+    TEST_ASSERT_FALSE(CalendarValidDate(&(calendar_date_t){.year = 2025, .month = 1, .day = 0}));
+}
+
+/* === End of documentation ======================================================================================== */
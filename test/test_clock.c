@@ -47,12 +47,38 @@ y un día completo.
 - Probar que al Crear el Reloj la ClockGetTime devuelve bien la unión de hora  (Por el array y el Struct); -- Redundante
 - OBSERVACION nunca actualizo el struct de tiempo ni su bcd current_time
 
-- Ver que la alarma se apaga cuando pasan X minutos
-- Ver que la alarma se apaga cuando  la posponen X minutos despues de ser pospuesta
+- Ver que la alarma se apaga sola cuando suena X segundos y vuelve a sonar al día siguiente.
+- Ver que la alarma no se pospone más veces que el máximo y sigue sonando.
+- Ver que cada posposición dura X segundos más que la anterior.
+
+- Las funciones programadas se llaman al empezar cada segundo, cada minuto y cada hora.
+- La función programada a una hora se llama una vez por día y se reparte de nuevo al ajustar la hora.
+- No se pueden programar más funciones que el máximo y una función se puede quitar a sí misma.
+
+- La alarma que empieza a sonar se registra una sola vez aunque se compare durante todo el segundo
+
+- Al crear el reloj la fecha es el 1 de enero de 1970.
+- Al pasar la medianoche avanza la fecha y el día de la semana, también en los años bisiestos y al cambiar de año.
+- Ajustar la fecha con valores invalidos y ver que los rechaza.
+- Los segundos desde 1970 combinan la fecha y la hora y avanzan con el reloj.
+
+- Al empezar el horario de verano la hora local se adelanta y al terminar se atrasa, sin saltos en los segundos UTC.
+- Al indicar la zona horaria se conservan los segundos UTC y la hora local que se ajusta se convierte a UTC.
+
+- La alarma de lunes a viernes no suena el fin de semana y la próxima alarma es el lunes.
+- La alarma que suena una sola vez se desactiva después de sonar.
+- Al saltear la próxima alarma no suena ese día y vuelve a sonar el siguiente.
+- Al volver a activar la alarma en el mismo segundo en que sonó no vuelve a sonar hasta el día siguiente.
+
+- Al corregir la hora de a poco los segundos avanzan de a uno y la corrección se completa.
+- Al atrasar la hora de a poco la alarma suena una sola vez y ajustar la hora descarta la corrección pendiente.
+- Los milisegundos desde 1970 ponen en hora el reloj y las correcciones grandes o sin hora válida se rechazan.
+
+- El reloj toma la hora que conservó el RTC, empieza el segundo con el RTC y lo pone en hora al ajustarla.
+- Al reanudar el reloj suspendido suma los segundos del RTC y la alarma que correspondía suena una vez.
+- Sin RTC el reloj no se suspende y al suspenderlo se guarda en el RTC la hora que faltaba guardar.
 
 - Probar reloj con una frecuencia distinta
-- Creo que hay un problema en snooze_counter == self->seconds_snoozed (linea 196) cuando no se pospone la alarma creo
-que puede darse esta condicion
  *
  */
 
@@ -61,6 +87,9 @@ que puede darse esta condicion
 #include "unity.h"
 
 #include "clock.h"
+#include "calendar.h"
+#include "event_trace.h"
+#include "timezone.h"
 #include <stdbool.h>
 
 /* === Macros definitions ========================================================================================== */
@@ -85,6 +114,15 @@ static void TurnOnAlarm(void);
 //! Funcion para simular el apagado de la alarma
 static void TurnOffAlarm(void);
 
+//! Funcion para simular la lectura del RTC
+static bool RtcRead(uint32_t * seconds);
+
+//! Funcion para simular la puesta en hora del RTC
+static void RtcWrite(uint32_t seconds);
+
+//! Funcion para simular la alarma del RTC
+static void RtcSetAlarm(uint32_t seconds);
+
 /* === Private variable definitions ================================================================================ */
 
 /* === Public variable definitions ================================================================================= */
@@ -95,6 +133,14 @@ static const struct clock_alarm_driver_s alarm_driver = {
     .TurnOnAlarm = TurnOnAlarm,
     .TurnOffAlarm = TurnOffAlarm,
 };
+static bool rtc_valid = false;
+static uint32_t rtc_seconds = 0;
+static uint32_t rtc_alarm = CLOCK_RTC_NO_ALARM;
+static const struct clock_rtc_driver_s rtc_driver = {
+    .Read = RtcRead,
+    .Write = RtcWrite,
+    .SetAlarm = RtcSetAlarm,
+};
 
 /* === Private function definitions ================================================================================ */
 
@@ -102,6 +148,9 @@ void setUp(void) {
     clock = ClockCreate(CLOCK_TICKS_PER_SECONDS, &alarm_driver, CLOCK_SECONDS_OF_SNOOZE);
     ClockSetTime(clock, &(clock_time_u){0});
     alarm_is_ringing = false;
+    rtc_valid = false;
+    rtc_seconds = 0;
+    rtc_alarm = CLOCK_RTC_NO_ALARM;
 }
 
 static void SimulateSeconds(clock_p clock, int seconds) {
@@ -118,6 +167,37 @@ static void TurnOffAlarm(void) {
     alarm_is_ringing = false;
 }
 
+static bool RtcRead(uint32_t * seconds) {
+    *seconds = rtc_seconds;
+    return rtc_valid;
+}
+
+static void RtcWrite(uint32_t seconds) {
+    rtc_seconds = seconds;
+    rtc_valid = true;
+}
+
+static void RtcSetAlarm(uint32_t seconds) {
+    rtc_alarm = seconds;
+}
+
+//! Avanza el RTC y el reloj de a un segundo
+static void SimulateRtcSeconds(clock_p clock, int seconds) {
+    for (int i = 0; i < seconds; i++) {
+        rtc_seconds++;
+        SimulateSeconds(clock, 1);
+    }
+}
+
+static void CountHook(clock_p clock, void * context) {
+    (void)clock;
+    (*(uint32_t *)context)++;
+}
+
+static void RemoveItselfHook(clock_p clock, void * context) {
+    ClockRemoveHook(clock, *(int *)context);
+}
+
 /* === Public function definitions ===+============================================================================= */
 
 // 1-Al inicializar el reloj está en 00:00 y con hora invalida.
@@ -514,4 +594,568 @@ void test_we_can_know_that_the_alarm_is_snoozed() {
     ClockSnoozeAlarm(clock);
     TEST_ASSERT_EQUAL_INT(1, ClockIsAlarmSnoozed(clock));
 }
+
+// 33-La alarma que empieza a sonar se registra una sola vez aunque se compare durante todo el segundo
+void test_ringing_alarm_is_traced_once() {
+    static const clock_time_u valid_alarm = {
+        .time = {.hours = {0, 0}, .minutes = {0, 3}, .seconds = {0, 0}},
+    };
+    uint32_t cursor;
+    uint32_t sequence;
+    event_trace_record_t record;
+
+    ClockSetAlarm(clock, &valid_alarm); // alarma a las 00:30:00
+    cursor = EventTraceCount();
+
+    SimulateSeconds(clock, 1801);
+    ClockTurnOffAlarm(clock);
+
+    TEST_ASSERT_EQUAL_INT(0, EventTraceRead(&cursor, &sequence, &record));
+    TEST_ASSERT_EQUAL_UINT8(EVENT_TRACE_ALARM_FIRED, record.event);
+    TEST_ASSERT_EQUAL_INT(0, EventTraceRead(&cursor, &sequence, &record));
+    TEST_ASSERT_EQUAL_UINT8(EVENT_TRACE_ALARM_OFF, record.event);
+    TEST_ASSERT_EQUAL_INT(-1, EventTraceRead(&cursor, &sequence, &record));
+}
+
+// 34-Al crear el reloj la fecha es el 1 de enero de 1970
+void test_init_with_unix_epoch_date(void) {
+    calendar_date_t date;
+
+    TEST_ASSERT_EQUAL_INT(1, ClockGetDate(clock, &date));
+    TEST_ASSERT_EQUAL_INT16(1970, date.year);
+    TEST_ASSERT_EQUAL_UINT8(1, date.month);
+    TEST_ASSERT_EQUAL_UINT8(1, date.day);
+    TEST_ASSERT_EQUAL_UINT8(CALENDAR_THURSDAY, date.weekday);
+    TEST_ASSERT_EQUAL_INT64(0, ClockGetEpochSeconds(clock));
+}
+
+// 35-Al pasar la medianoche avanza la fecha y el día de la semana, también en los años bisiestos y al cambiar de año
+void test_date_advances_at_midnight(void) {
+    static const clock_time_u last_second = {
+        .time = {.hours = {3, 2}, .minutes = {9, 5}, .seconds = {9, 5}},
+    };
+    calendar_date_t date;
+
+    ClockSetTime(clock, &last_second);
+    TEST_ASSERT_EQUAL_INT(1, ClockSetDate(clock, &(calendar_date_t){.year = 2024, .month = 2, .day = 28}));
+    SimulateSeconds(clock, 1);
+    ClockGetDate(clock, &date);
+    TEST_ASSERT_EQUAL_UINT8(2, date.month);
+    TEST_ASSERT_EQUAL_UINT8(29, date.day);
+    TEST_ASSERT_EQUAL_UINT8(CALENDAR_THURSDAY, date.weekday);
+
+    ClockSetTime(clock, &last_second);
+    ClockSetDate(clock, &(calendar_date_t){.year = 2025, .month = 12, .day = 31});
+    SimulateSeconds(clock, 1);
+    ClockGetDate(clock, &date);
+    TEST_ASSERT_EQUAL_INT16(2026, date.year);
+    TEST_ASSERT_EQUAL_UINT8(1, date.month);
+    TEST_ASSERT_EQUAL_UINT8(1, date.day);
+    TEST_ASSERT_EQUAL_UINT8(CALENDAR_THURSDAY, date.weekday);
+}
+
+// 36-Ajustar la fecha con valores invalidos y ver que los rechaza
+void test_set_invalid_date(void) {
+    calendar_date_t date;
+
+    ClockSetDate(clock, &(calendar_date_t){.year = 2025, .month = 3, .day = 1});
+    TEST_ASSERT_EQUAL_INT(0, ClockSetDate(clock, &(calendar_date_t){.year = 2025, .month = 2, .day = 29}));
+    TEST_ASSERT_EQUAL_INT(0, ClockSetDate(clock, &(calendar_date_t){.year = 1969, .month = 12, .day = 31}));
+    ClockGetDate(clock, &date);
+    TEST_ASSERT_EQUAL_INT16(2025, date.year);
+    TEST_ASSERT_EQUAL_UINT8(3, date.month);
+    TEST_ASSERT_EQUAL_UINT8(1, date.day);
+}
+
+// 37-Los segundos desde 1970 combinan la fecha y la hora y avanzan con el reloj
+void test_epoch_seconds_follow_date_and_time(void) {
+    static const clock_time_u noon = {
+        .time = {.hours = {2, 1}, .minutes = {0, 0}, .seconds = {0, 0}},
+    };
+
+    ClockSetDate(clock, &(calendar_date_t){.year = 2026, .month = 10, .day = 19});
+    ClockSetTime(clock, &noon);
+    TEST_ASSERT_EQUAL_INT64(20745LL * 86400LL + 43200LL, ClockGetEpochSeconds(clock));
+
+    SimulateSeconds(clock, 12 * 3600 + 1);
+    TEST_ASSERT_EQUAL_INT64(20746LL * 86400LL + 1LL, ClockGetEpochSeconds(clock));
+}
+
+// 38-Al empezar el horario de verano la hora local se adelanta y al terminar se atrasa, sin saltos en los segundos UTC
+void test_daylight_saving_transitions(void) {
+    static const clock_time_u before_spring = {
+        .time = {.hours = {1, 0}, .minutes = {9, 5}, .seconds = {9, 5}},
+    };
+    static const clock_time_u before_fall = {
+        .time = {.hours = {1, 0}, .minutes = {9, 5}, .seconds = {9, 5}},
+    };
+    timezone_t zone;
+    clock_time_u current_time;
+    int64_t epoch;
+
+    TimezoneParse(&zone, "CET-1CEST,M3.5.0,M10.5.0/3");
+    TimezoneCompile(&zone, 2026);
+    ClockSetTimezone(clock, &zone);
+
+    ClockSetDate(clock, &(calendar_date_t){.year = 2026, .month = 3, .day = 29});
+    ClockSetTime(clock, &before_spring);
+    epoch = ClockGetEpochSeconds(clock);
+    SimulateSeconds(clock, 1);
+    ClockGetTime(clock, &current_time);
+    TEST_ASSERT_TIME(0, 3, 0, 0, 0, 0, current_time);
+    TEST_ASSERT_EQUAL_INT32(7200, ClockGetUtcOffset(clock));
+    TEST_ASSERT_EQUAL_INT64(epoch + 1, ClockGetEpochSeconds(clock));
+
+    ClockSetDate(clock, &(calendar_date_t){.year = 2026, .month = 10, .day = 25});
+    ClockSetTime(clock, &before_fall);
+    SimulateSeconds(clock, 1);
+    TEST_ASSERT_EQUAL_INT32(7200, ClockGetUtcOffset(clock));
+    SimulateSeconds(clock, 3600);
+    ClockGetTime(clock, &current_time);
+    TEST_ASSERT_TIME(0, 2, 0, 0, 0, 0, current_time);
+    TEST_ASSERT_EQUAL_INT32(3600, ClockGetUtcOffset(clock));
+}
+
+// 39-Al indicar la zona horaria se conservan los segundos UTC y la hora local que se ajusta se convierte a UTC
+void test_timezone_keeps_utc_and_converts_local_time(void) {
+    static const clock_time_u noon = {
+        .time = {.hours = {2, 1}, .minutes = {0, 0}, .seconds = {0, 0}},
+    };
+    timezone_t zone;
+    clock_time_u current_time;
+
+    ClockSetDate(clock, &(calendar_date_t){.year = 2026, .month = 10, .day = 19});
+    ClockSetTime(clock, &noon);
+
+    TimezoneParse(&zone, "ART3");
+    TimezoneCompile(&zone, 2026);
+    ClockSetTimezone(clock, &zone);
+    ClockGetTime(clock, &current_time);
+    TEST_ASSERT_TIME(0, 9, 0, 0, 0, 0, current_time);
+    TEST_ASSERT_EQUAL_INT64(20745LL * 86400LL + 43200LL, ClockGetEpochSeconds(clock));
+
+    ClockSetTime(clock, &noon);
+    TEST_ASSERT_EQUAL_INT64(20745LL * 86400LL + 54000LL, ClockGetEpochSeconds(clock));
+}
+
+// 40-La alarma de lunes a viernes no suena el fin de semana y la próxima alarma es el lunes
+void test_weekday_alarm_skips_the_weekend(void) {
+    static const clock_time_u eight = {
+        .time = {.hours = {8, 0}, .minutes = {0, 0}, .seconds = {0, 0}},
+    };
+    static const clock_time_u seven = {
+        .time = {.hours = {7, 0}, .minutes = {0, 0}, .seconds = {0, 0}},
+    };
+    calendar_date_t next;
+
+    // El 16 de octubre de 2026 es viernes
+    ClockSetDate(clock, &(calendar_date_t){.year = 2026, .month = 10, .day = 16});
+    ClockSetTime(clock, &eight);
+    ClockSetAlarm(clock, &seven);
+    ClockSetAlarmDays(clock, CLOCK_ALARM_WEEKDAYS);
+
+    TEST_ASSERT_EQUAL_UINT8(CLOCK_ALARM_WEEKDAYS, ClockGetAlarmDays(clock));
+    TEST_ASSERT_EQUAL_INT(1, ClockGetNextAlarm(clock, &next));
+    TEST_ASSERT_EQUAL_INT(19, next.day);
+    TEST_ASSERT_EQUAL_INT(CALENDAR_MONDAY, next.weekday);
+
+    SimulateSeconds(clock, 2 * 86400 + 23 * 3600 - 1);
+    TEST_ASSERT_FALSE(alarm_is_ringing);
+    SimulateSeconds(clock, 1);
+    TEST_ASSERT_TRUE(alarm_is_ringing);
+
+    ClockSetAlarmDays(clock, 0);
+    TEST_ASSERT_EQUAL_INT(0, ClockGetNextAlarm(clock, &next));
+}
+
+// 41-La alarma que suena una sola vez se desactiva después de sonar
+void test_one_shot_alarm_deactivates_after_ringing(void) {
+    static const clock_time_u valid_alarm = {
+        .time = {.hours = {0, 0}, .minutes = {0, 0}, .seconds = {0, 1}},
+    };
+
+    ClockSetAlarm(clock, &valid_alarm);
+    ClockSetAlarmOneShot(clock, true);
+
+    SimulateSeconds(clock, 10);
+    TEST_ASSERT_TRUE(alarm_is_ringing);
+    TEST_ASSERT_EQUAL_INT(0, ClockIsAlarmActivated(clock));
+
+    ClockTurnOffAlarm(clock);
+    SimulateSeconds(clock, 86400);
+    TEST_ASSERT_FALSE(alarm_is_ringing);
+}
+
+// 42-Al saltear la próxima alarma no suena ese día y vuelve a sonar el siguiente
+void test_skip_next_alarm(void) {
+    static const clock_time_u valid_alarm = {
+        .time = {.hours = {0, 0}, .minutes = {0, 0}, .seconds = {0, 1}},
+    };
+    calendar_date_t next;
+
+    ClockSetAlarm(clock, &valid_alarm);
+    ClockSkipNextAlarm(clock, true);
+    TEST_ASSERT_EQUAL_INT(1, ClockGetNextAlarm(clock, &next));
+    TEST_ASSERT_EQUAL_INT(2, next.day);
+
+    SimulateSeconds(clock, 10);
+    TEST_ASSERT_FALSE(alarm_is_ringing);
+    TEST_ASSERT_EQUAL_INT(1, ClockIsAlarmActivated(clock));
+
+    SimulateSeconds(clock, 86400);
+    TEST_ASSERT_TRUE(alarm_is_ringing);
+    ClockTurnOffAlarm(clock);
+
+    ClockSkipNextAlarm(clock, true);
+    ClockSkipNextAlarm(clock, false);
+    SimulateSeconds(clock, 86400);
+    TEST_ASSERT_TRUE(alarm_is_ringing);
+}
+
+// 43-Al volver a activar la alarma en el mismo segundo en que sonó no vuelve a sonar hasta el día siguiente
+void test_alarm_reenabled_after_ringing_waits_next_day(void) {
+    static const clock_time_u alarm = {
+        .time = {.hours = {0, 0}, .minutes = {0, 0}, .seconds = {0, 1}},
+    };
+    calendar_date_t next;
+
+    ClockSetAlarm(clock, &alarm);
+    SimulateSeconds(clock, 10);
+    TEST_ASSERT_TRUE(alarm_is_ringing);
+    ClockTurnOffAlarm(clock);
+
+    ClockSetAlarmState(clock, false);
+    ClockSetAlarmState(clock, true);
+    ClockSetAlarmDays(clock, CLOCK_ALARM_EVERY_DAY);
+    ClockSkipNextAlarm(clock, false);
+    ClockSetTimezone(clock, NULL);
+    ClockNewTick(clock);
+    TEST_ASSERT_FALSE(alarm_is_ringing);
+    TEST_ASSERT_EQUAL_INT(1, ClockGetNextAlarm(clock, &next));
+    TEST_ASSERT_EQUAL_INT(2, next.day);
+
+    SimulateSeconds(clock, 86400);
+    TEST_ASSERT_TRUE(alarm_is_ringing);
+}
+
+// 44-Ver que la alarma se apaga sola cuando suena X segundos y vuelve a sonar al día siguiente
+void test_alarm_turns_off_after_ring_timeout(void) {
+    static const clock_time_u valid_alarm = {
+        .time = {.hours = {0, 0}, .minutes = {0, 0}, .seconds = {0, 1}},
+    };
+    static const clock_alarm_policy_t policy = {.ring_timeout = 60};
+
+    TEST_ASSERT_EQUAL_INT(1, ClockSetAlarmPolicy(clock, &policy));
+    ClockSetAlarm(clock, &valid_alarm);
+
+    SimulateSeconds(clock, 10 + 59);
+    TEST_ASSERT_TRUE(alarm_is_ringing);
+    SimulateSeconds(clock, 1);
+    TEST_ASSERT_FALSE(alarm_is_ringing);
+    TEST_ASSERT_EQUAL_INT(0, ClockIsAlarmRinging(clock));
+
+    SimulateSeconds(clock, 86400 - 60);
+    TEST_ASSERT_TRUE(alarm_is_ringing);
+    TEST_ASSERT_EQUAL_INT(0, ClockSetAlarmPolicy(clock, &(clock_alarm_policy_t){.ring_timeout = 86401}));
+}
+
+// 45-Ver que la alarma no se pospone más veces que el máximo y sigue sonando
+void test_alarm_snooze_limit(void) {
+    static const clock_time_u valid_alarm = {
+        .time = {.hours = {0, 0}, .minutes = {0, 0}, .seconds = {0, 1}},
+    };
+    static const clock_alarm_policy_t policy = {.max_snoozes = 2};
+
+    ClockSetAlarmPolicy(clock, &policy);
+    ClockSetAlarm(clock, &valid_alarm);
+    SimulateSeconds(clock, 10);
+
+    TEST_ASSERT_EQUAL_INT(1, ClockSnoozeAlarm(clock));
+    SimulateSeconds(clock, CLOCK_SECONDS_OF_SNOOZE);
+    TEST_ASSERT_EQUAL_INT(1, ClockSnoozeAlarm(clock));
+    SimulateSeconds(clock, CLOCK_SECONDS_OF_SNOOZE);
+    TEST_ASSERT_TRUE(alarm_is_ringing);
+    TEST_ASSERT_EQUAL_INT(0, ClockSnoozeAlarm(clock));
+    TEST_ASSERT_TRUE(alarm_is_ringing);
+    TEST_ASSERT_EQUAL_INT(0, ClockIsAlarmSnoozed(clock));
+
+    // Al apagarla se reinicia la cuenta de posposiciones
+    ClockTurnOffAlarm(clock);
+    SimulateSeconds(clock, 86400);
+    TEST_ASSERT_EQUAL_INT(1, ClockSnoozeAlarm(clock));
+}
+
+// 46-Ver que cada posposición dura X segundos más que la anterior
+void test_escalating_snooze(void) {
+    static const clock_time_u valid_alarm = {
+        .time = {.hours = {0, 0}, .minutes = {0, 0}, .seconds = {0, 1}},
+    };
+    static const clock_alarm_policy_t policy = {.snooze_step = -120};
+
+    ClockSetAlarmPolicy(clock, &policy);
+    ClockSetAlarm(clock, &valid_alarm);
+    SimulateSeconds(clock, 10);
+
+    ClockSnoozeAlarm(clock);
+    SimulateSeconds(clock, CLOCK_SECONDS_OF_SNOOZE - 1);
+    TEST_ASSERT_FALSE(alarm_is_ringing);
+    SimulateSeconds(clock, 1);
+    TEST_ASSERT_TRUE(alarm_is_ringing);
+
+    ClockSnoozeAlarm(clock);
+    SimulateSeconds(clock, CLOCK_SECONDS_OF_SNOOZE - 120);
+    TEST_ASSERT_TRUE(alarm_is_ringing);
+
+    // La posposición no baja de un segundo
+    ClockSnoozeAlarm(clock);
+    ClockSnoozeAlarm(clock);
+    ClockSnoozeAlarm(clock);
+    TEST_ASSERT_FALSE(alarm_is_ringing);
+    SimulateSeconds(clock, 1);
+    TEST_ASSERT_TRUE(alarm_is_ringing);
+}
+
+// 47-Las funciones programadas se llaman al empezar cada segundo, cada minuto y cada hora
+void test_hooks_on_second_minute_and_hour(void) {
+    uint32_t seconds = 0, minutes = 0, hours = 0;
+
+    TEST_ASSERT_EQUAL_INT(0, ClockAddHook(clock, CLOCK_HOOK_SECOND, NULL, CountHook, &seconds));
+    TEST_ASSERT_EQUAL_INT(1, ClockAddHook(clock, CLOCK_HOOK_MINUTE, NULL, CountHook, &minutes));
+    TEST_ASSERT_EQUAL_INT(2, ClockAddHook(clock, CLOCK_HOOK_HOUR, NULL, CountHook, &hours));
+
+    SimulateSeconds(clock, 59);
+    TEST_ASSERT_EQUAL_UINT32(59, seconds);
+    TEST_ASSERT_EQUAL_UINT32(0, minutes);
+
+    SimulateSeconds(clock, 2 * 3600 - 59);
+    TEST_ASSERT_EQUAL_UINT32(2 * 3600, seconds);
+    TEST_ASSERT_EQUAL_UINT32(120, minutes);
+    TEST_ASSERT_EQUAL_UINT32(2, hours);
+
+    SimulateSeconds(clock, 22 * 3600);
+    TEST_ASSERT_EQUAL_UINT32(24 * 60, minutes);
+    TEST_ASSERT_EQUAL_UINT32(24, hours);
+}
+
+// 48-La función programada a una hora se llama una vez por día y se reparte de nuevo al ajustar la hora
+void test_hook_at_time_of_day(void) {
+    static const clock_time_u hook_time = {
+        .time = {.hours = {7, 0}, .minutes = {0, 3}, .seconds = {5, 1}},
+    };
+    static const clock_time_u before = {
+        .time = {.hours = {7, 0}, .minutes = {9, 2}, .seconds = {0, 0}},
+    };
+    static const clock_time_u after = {
+        .time = {.hours = {8, 0}, .minutes = {0, 0}, .seconds = {0, 0}},
+    };
+    uint32_t calls = 0;
+
+    ClockAddHook(clock, CLOCK_HOOK_TIME, &hook_time, CountHook, &calls);
+    SimulateSeconds(clock, 7 * 3600 + 30 * 60 + 14);
+    TEST_ASSERT_EQUAL_UINT32(0, calls);
+    SimulateSeconds(clock, 1);
+    TEST_ASSERT_EQUAL_UINT32(1, calls);
+    SimulateSeconds(clock, 86400);
+    TEST_ASSERT_EQUAL_UINT32(2, calls);
+
+    ClockSetTime(clock, &before);
+    SimulateSeconds(clock, 60 + 15);
+    TEST_ASSERT_EQUAL_UINT32(3, calls);
+
+    ClockSetTime(clock, &after);
+    SimulateSeconds(clock, 86400 - 1);
+    TEST_ASSERT_EQUAL_UINT32(4, calls);
+
+    TEST_ASSERT_EQUAL_INT(-1, ClockAddHook(clock, CLOCK_HOOK_TIME, &(clock_time_u){.time = {.hours = {5, 2}}},
+                                           CountHook, &calls));
+}
+
+// 49-No se pueden programar más funciones que el máximo y una función se puede quitar a sí misma
+void test_hooks_capacity_and_removal(void) {
+    uint32_t calls = 0;
+    int hook;
+    int index;
+
+    for (index = 0; index < CLOCK_HOOKS; index++) {
+        TEST_ASSERT_EQUAL_INT(index, ClockAddHook(clock, CLOCK_HOOK_MINUTE, NULL, CountHook, &calls));
+    }
+    TEST_ASSERT_EQUAL_INT(-1, ClockAddHook(clock, CLOCK_HOOK_SECOND, NULL, CountHook, &calls));
+
+    ClockRemoveHook(clock, 3);
+    ClockRemoveHook(clock, 5);
+    SimulateSeconds(clock, 60);
+    TEST_ASSERT_EQUAL_UINT32(CLOCK_HOOKS - 2, calls);
+
+    hook = ClockAddHook(clock, CLOCK_HOOK_SECOND, NULL, RemoveItselfHook, &hook);
+    TEST_ASSERT_EQUAL_INT(3, hook);
+    SimulateSeconds(clock, 60);
+    TEST_ASSERT_EQUAL_UINT32(2 * (CLOCK_HOOKS - 2), calls);
+    TEST_ASSERT_EQUAL_INT(3, ClockAddHook(clock, CLOCK_HOOK_SECOND, NULL, CountHook, &calls));
+}
+
+// 50-Al corregir la hora de a poco los segundos avanzan de a uno y la corrección se completa
+void test_adjust_time_forward(void) {
+    uint32_t seconds = 0;
+
+    ClockAddHook(clock, CLOCK_HOOK_SECOND, NULL, CountHook, &seconds);
+    TEST_ASSERT_EQUAL_INT(1, ClockAdjustTime(clock, 2000));
+    TEST_ASSERT_EQUAL_INT32(2000, ClockGetAdjustment(clock));
+
+    // Se agrega un tick cada CLOCK_SLEW_INTERVAL, los dos segundos se completan en 10 * CLOCK_SLEW_INTERVAL ticks
+    SimulateSeconds(clock, 10 * CLOCK_SLEW_INTERVAL / CLOCK_TICKS_PER_SECONDS);
+    TEST_ASSERT_EQUAL_INT32(0, ClockGetAdjustment(clock));
+    TEST_ASSERT_EQUAL_UINT32(10 * CLOCK_SLEW_INTERVAL / CLOCK_TICKS_PER_SECONDS + 2, ClockGetTimeInSeconds(clock));
+    TEST_ASSERT_EQUAL_UINT32(ClockGetTimeInSeconds(clock), seconds);
+}
+
+// 51-Al atrasar la hora de a poco la alarma suena una sola vez y ajustar la hora descarta la corrección pendiente
+void test_adjust_time_backward_rings_alarm_once(void) {
+    static const clock_time_u alarm = {
+        .time = {.hours = {0, 0}, .minutes = {1, 0}, .seconds = {0, 4}},
+    };
+    uint32_t seconds = 0;
+
+    ClockAddHook(clock, CLOCK_HOOK_SECOND, NULL, CountHook, &seconds);
+    ClockSetAlarm(clock, &alarm);
+    TEST_ASSERT_EQUAL_INT(1, ClockAdjustTime(clock, -3000));
+
+    SimulateSeconds(clock, 99);
+    TEST_ASSERT_FALSE(alarm_is_ringing);
+    SimulateSeconds(clock, 3);
+    TEST_ASSERT_TRUE(alarm_is_ringing);
+    ClockTurnOffAlarm(clock);
+
+    SimulateSeconds(clock, 15 * CLOCK_SLEW_INTERVAL / CLOCK_TICKS_PER_SECONDS - 102);
+    TEST_ASSERT_FALSE(alarm_is_ringing);
+    TEST_ASSERT_EQUAL_INT32(0, ClockGetAdjustment(clock));
+    TEST_ASSERT_EQUAL_UINT32(15 * CLOCK_SLEW_INTERVAL / CLOCK_TICKS_PER_SECONDS - 3, ClockGetTimeInSeconds(clock));
+    TEST_ASSERT_EQUAL_UINT32(ClockGetTimeInSeconds(clock), seconds);
+
+    ClockAdjustTime(clock, 1000);
+    ClockSetTime(clock, &(clock_time_u){0});
+    TEST_ASSERT_EQUAL_INT32(0, ClockGetAdjustment(clock));
+}
+
+// 52-Los milisegundos desde 1970 ponen en hora el reloj y las correcciones grandes o sin hora válida se rechazan
+void test_epoch_milliseconds_and_adjust_limits(void) {
+    clock_time_u current_time;
+
+    TEST_ASSERT_EQUAL_INT(0, ClockAdjustTime(clock, CLOCK_ADJUST_LIMIT + 1));
+    TEST_ASSERT_EQUAL_INT(0, ClockAdjustTime(clock, -CLOCK_ADJUST_LIMIT - 1));
+
+    clock = ClockCreate(CLOCK_TICKS_PER_SECONDS, &alarm_driver, CLOCK_SECONDS_OF_SNOOZE);
+    TEST_ASSERT_EQUAL_INT(0, ClockAdjustTime(clock, 1000));
+    TEST_ASSERT_EQUAL_INT(0, ClockSetEpochMilliseconds(clock, -1));
+
+    TEST_ASSERT_EQUAL_INT(1, ClockSetEpochMilliseconds(clock, 20745LL * 86400000LL + 43200000LL + 600LL));
+    TEST_ASSERT_EQUAL_INT64(20745LL * 86400000LL + 43200000LL + 600LL, ClockGetEpochMilliseconds(clock));
+    TEST_ASSERT_TRUE(ClockGetTime(clock, &current_time));
+    TEST_ASSERT_TIME(1, 2, 0, 0, 0, 0, current_time);
+
+    SimulateSeconds(clock, 1);
+    TEST_ASSERT_EQUAL_INT64(20745LL * 86400000LL + 43201000LL + 600LL, ClockGetEpochMilliseconds(clock));
+}
+
+// 53-El reloj toma la hora que conservó el RTC, empieza el segundo con el RTC y lo pone en hora al ajustarla
+void test_time_retained_by_rtc(void) {
+    static const clock_time_u morning = {
+        .time = {.hours = {8, 0}, .minutes = {0, 0}, .seconds = {0, 0}},
+    };
+    clock_time_u current_time;
+
+    rtc_valid = true;
+    rtc_seconds = 20745UL * 86400UL + 43200UL;
+    clock = ClockCreate(CLOCK_TICKS_PER_SECONDS, &alarm_driver, CLOCK_SECONDS_OF_SNOOZE);
+    TEST_ASSERT_EQUAL_INT(1, ClockSetRtc(clock, &rtc_driver));
+    TEST_ASSERT_TRUE(ClockGetTime(clock, &current_time));
+    TEST_ASSERT_TIME(1, 2, 0, 0, 0, 0, current_time);
+
+    // El segundo no termina hasta que cambia el del RTC
+    SimulateSeconds(clock, 3);
+    ClockGetTime(clock, &current_time);
+    TEST_ASSERT_TIME(1, 2, 0, 0, 0, 0, current_time);
+    rtc_seconds++;
+    ClockNewTick(clock);
+    ClockGetTime(clock, &current_time);
+    TEST_ASSERT_TIME(1, 2, 0, 0, 0, 1, current_time);
+
+    ClockSetTime(clock, &morning);
+    SimulateSeconds(clock, 1);
+    TEST_ASSERT_EQUAL_UINT32(20745UL * 86400UL + 28801UL, rtc_seconds);
+    TEST_ASSERT_EQUAL_INT64(rtc_seconds, ClockGetEpochSeconds(clock));
+
+    rtc_valid = false;
+    TEST_ASSERT_EQUAL_INT(0, ClockSetRtc(clock, &rtc_driver));
+    SimulateSeconds(clock, 1);
+    TEST_ASSERT_TRUE(rtc_valid);
+    TEST_ASSERT_EQUAL_INT64(rtc_seconds, ClockGetEpochSeconds(clock));
+}
+
+// 54-Al reanudar el reloj suspendido suma los segundos del RTC y la alarma que correspondía suena una vez
+void test_suspend_and_resume_with_rtc(void) {
+    static const clock_time_u alarm = {
+        .time = {.hours = {0, 0}, .minutes = {0, 1}, .seconds = {0, 0}},
+    };
+    clock_time_u current_time;
+    uint32_t seconds = 0;
+
+    ClockAddHook(clock, CLOCK_HOOK_SECOND, NULL, CountHook, &seconds);
+    ClockSetRtc(clock, &rtc_driver);
+    SimulateSeconds(clock, 1);
+    ClockSetAlarm(clock, &alarm);
+
+    TEST_ASSERT_EQUAL_INT(1, ClockSuspend(clock));
+    TEST_ASSERT_EQUAL_UINT32(600, rtc_alarm);
+    SimulateSeconds(clock, 100);
+    ClockGetTime(clock, &current_time);
+    TEST_ASSERT_TIME(0, 0, 0, 0, 0, 1, current_time);
+
+    // El procesador despertó tarde, la alarma suena igual y solo una vez
+    rtc_seconds = 700;
+    ClockResume(clock);
+    TEST_ASSERT_EQUAL_UINT32(CLOCK_RTC_NO_ALARM, rtc_alarm);
+    TEST_ASSERT_TRUE(ClockGetTime(clock, &current_time));
+    TEST_ASSERT_TIME(0, 0, 1, 1, 4, 0, current_time);
+    TEST_ASSERT_TRUE(alarm_is_ringing);
+    TEST_ASSERT_EQUAL_UINT32(1, seconds);
+
+    ClockTurnOffAlarm(clock);
+    SimulateRtcSeconds(clock, 10);
+    TEST_ASSERT_FALSE(alarm_is_ringing);
+    TEST_ASSERT_EQUAL_UINT32(11, seconds);
+    TEST_ASSERT_EQUAL_INT64(710, ClockGetEpochSeconds(clock));
+
+    // La posposición también despierta al reloj
+    SimulateRtcSeconds(clock, 86400 + 600 - 710);
+    TEST_ASSERT_TRUE(alarm_is_ringing);
+    ClockSnoozeAlarm(clock);
+    TEST_ASSERT_EQUAL_INT(1, ClockSuspend(clock));
+    TEST_ASSERT_EQUAL_UINT32(86400 + 600 + CLOCK_SECONDS_OF_SNOOZE, rtc_alarm);
+    ClockResume(clock);
+    TEST_ASSERT_FALSE(alarm_is_ringing);
+    rtc_seconds = 86400 + 600 + CLOCK_SECONDS_OF_SNOOZE;
+    TEST_ASSERT_EQUAL_INT(1, ClockSuspend(clock));
+    ClockResume(clock);
+    TEST_ASSERT_TRUE(alarm_is_ringing);
+}
+
+// 55-Sin RTC el reloj no se suspende y al suspenderlo se guarda en el RTC la hora que faltaba guardar
+void test_suspend_saves_time_to_rtc(void) {
+    static const clock_time_u evening = {
+        .time = {.hours = {0, 2}, .minutes = {0, 0}, .seconds = {0, 0}},
+    };
+
+    TEST_ASSERT_EQUAL_INT(0, ClockSuspend(clock));
+    clock = ClockCreate(CLOCK_TICKS_PER_SECONDS, &alarm_driver, CLOCK_SECONDS_OF_SNOOZE);
+    ClockSetRtc(clock, &rtc_driver);
+    TEST_ASSERT_EQUAL_INT(0, ClockSuspend(clock));
+
+    ClockSetTime(clock, &evening);
+    TEST_ASSERT_FALSE(rtc_valid);
+    TEST_ASSERT_EQUAL_INT(1, ClockSuspend(clock));
+    TEST_ASSERT_TRUE(rtc_valid);
+    TEST_ASSERT_EQUAL_UINT32(72000, rtc_seconds);
+    TEST_ASSERT_EQUAL_UINT32(CLOCK_RTC_NO_ALARM, rtc_alarm);
+}
+
 /* === End of documentation ======================================================================================== */
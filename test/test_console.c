@@ -0,0 +1,297 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file test_console.c
+ ** @brief Código para testeo de la consola de órdenes por el puerto serie - Electrónica 4 2025
+ **/
+
+/**
+ * Pruebas a realizar
+- Una orden con números separados por `:` llega a su función con los valores convertidos.
+- Las palabras se distinguen de los números y se comparan con ConsoleArgIs.
+- Una línea que da la vuelta al buffer de recepción se interpreta igual.
+- Las líneas vacías se ignoran y las órdenes desconocidas responden un error.
+- Una orden con demasiados argumentos o un número demasiado grande responde un error y no se atiende.
+- Una orden que llega en varias partes se atiende recién cuando termina la línea.
+- Las respuestas se envían de a un tramo mientras el puerto está ocupado y siguen al terminar el envío.
+- Lo que no entra en el buffer de envío se descarta y se cuenta.
+ *
+ */
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "unity.h"
+
+#include "console.h"
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+static void FakeStart(uint8_t * buffer, size_t size);
+
+static size_t FakeReceived(void);
+
+static bool FakeSend(const void * data, size_t size);
+
+static bool FakeBusy(void);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Puerto serie simulado
+static const struct console_driver_s fake_driver = {
+    .Start = FakeStart,
+    .Received = FakeReceived,
+    .Send = FakeSend,
+    .Busy = FakeBusy,
+};
+
+//! Buffer de recepción que entregó la consola
+static uint8_t * rx_buffer;
+
+//! Tamaño del buffer de recepción
+static size_t rx_size;
+
+//! Posición en la que el DMA simulado escribe el próximo byte
+static size_t rx_head;
+
+//! Bytes enviados por el puerto simulado
+static char sent[2 * CONSOLE_TX_SIZE];
+
+//! Cantidad de bytes enviados
+static size_t sent_size;
+
+//! Cantidad de envíos
+static uint32_t transfers;
+
+//! Indica si el puerto simulado queda ocupado después de cada envío
+static bool busy;
+
+//! Veces que se atendió la orden de prueba
+static uint32_t calls;
+
+//! Argumentos de la última llamada a la orden de prueba
+static console_args_t last_args;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void FakeStart(uint8_t * buffer, size_t size) {
+    rx_buffer = buffer;
+    rx_size = size;
+    rx_head = 0;
+}
+
+static size_t FakeReceived(void) {
+    return rx_head;
+}
+
+static bool FakeSend(const void * data, size_t size) {
+    memcpy(&sent[sent_size], data, size);
+    sent_size += size;
+    transfers++;
+    return true;
+}
+
+static bool FakeBusy(void) {
+    return busy;
+}
+
+static void Receive(const char * text) {
+    while (*text != 0) {
+        rx_buffer[rx_head] = (uint8_t)*text++;
+        rx_head = (rx_head + 1) % rx_size;
+    }
+}
+
+static void Record(const console_args_t * args) {
+    calls++;
+    memcpy(&last_args, args, sizeof(console_args_t));
+}
+
+static void Hello(const console_args_t * args) {
+    (void)args;
+    ConsolePrint("hola %d\r\n", 42);
+}
+
+//! Órdenes de las pruebas
+static const console_command_t commands[] = {
+    {.name = "time", .handler = Record},
+    {.name = "hello", .handler = Hello},
+};
+
+void setUp(void) {
+    sent_size = 0;
+    transfers = 0;
+    busy = false;
+    calls = 0;
+    memset(&last_args, 0, sizeof(last_args));
+    ConsoleInit(&fake_driver, commands, sizeof(commands) / sizeof(commands[0]));
+}
+
+/* === Public function definitions ================================================================================= */
+
+// 1-Una orden con números separados por `:` llega a su función con los valores convertidos
+void test_numeric_arguments(void) {
+    Receive("time 12:30:05\r\n");
+    ConsolePoll();
+
+    TEST_ASSERT_EQUAL_UINT32(1, calls);
+    TEST_ASSERT_EQUAL_UINT8(3, last_args.count);
+    TEST_ASSERT_TRUE(last_args.values[0].numeric);
+    TEST_ASSERT_EQUAL_UINT32(12, last_args.values[0].number);
+    TEST_ASSERT_EQUAL_UINT32(30, last_args.values[1].number);
+    TEST_ASSERT_EQUAL_UINT32(5, last_args.values[2].number);
+    TEST_ASSERT_EQUAL_size_t(0, sent_size);
+}
+
+// 2-Las palabras se distinguen de los números y se comparan con ConsoleArgIs
+void test_word_arguments(void) {
+    Receive("time on 7x\n");
+    ConsolePoll();
+
+    TEST_ASSERT_EQUAL_UINT32(1, calls);
+    TEST_ASSERT_EQUAL_UINT8(2, last_args.count);
+    TEST_ASSERT_FALSE(last_args.values[0].numeric);
+    TEST_ASSERT_FALSE(last_args.values[1].numeric);
+    TEST_ASSERT_TRUE(ConsoleArgIs(&last_args, 0, "on"));
+    TEST_ASSERT_FALSE(ConsoleArgIs(&last_args, 0, "off"));
+    TEST_ASSERT_FALSE(ConsoleArgIs(&last_args, 0, "o"));
+    TEST_ASSERT_FALSE(ConsoleArgIs(&last_args, 2, "on"));
+}
+
+// 3-Una línea que da la vuelta al buffer de recepción se interpreta igual
+void test_line_across_ring_wrap(void) {
+    char filler[CONSOLE_RX_SIZE];
+
+    memset(filler, '\n', sizeof(filler));
+    filler[CONSOLE_RX_SIZE - 6] = 0;
+    Receive(filler);
+    ConsolePoll();
+
+    Receive("time 23:59\r\n");
+    ConsolePoll();
+
+    TEST_ASSERT_TRUE(rx_head < CONSOLE_RX_SIZE - 6);
+    TEST_ASSERT_EQUAL_UINT32(1, calls);
+    TEST_ASSERT_EQUAL_UINT8(2, last_args.count);
+    TEST_ASSERT_EQUAL_UINT32(23, last_args.values[0].number);
+    TEST_ASSERT_EQUAL_UINT32(59, last_args.values[1].number);
+}
+
+// 4-Las líneas vacías se ignoran y las órdenes desconocidas responden un error
+void test_unknown_command(void) {
+    console_stats_t stats;
+
+    Receive("\r\n  \r\ntim 1\r\ntimes\r\n");
+    ConsolePoll();
+
+    ConsoleGetStats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(0, calls);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.lines);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.errors);
+    sent[sent_size] = 0;
+    TEST_ASSERT_EQUAL_STRING("error: orden desconocida\r\nerror: orden desconocida\r\n", sent);
+}
+
+// 5-Una orden con demasiados argumentos o un número demasiado grande responde un error y no se atiende
+void test_invalid_arguments(void) {
+    console_stats_t stats;
+
+    Receive("time 1 2 3 4 5\r\ntime 4294967296\r\ntime 4294967295\r\n");
+    ConsolePoll();
+
+    ConsoleGetStats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, calls);
+    TEST_ASSERT_EQUAL_UINT32(4294967295UL, last_args.values[0].number);
+    TEST_ASSERT_EQUAL_UINT32(3, stats.lines);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.errors);
+}
+
+// 6-Una orden que llega en varias partes se atiende recién cuando termina la línea
+void test_partial_line(void) {
+    Receive("ti");
+    ConsolePoll();
+    Receive("me 1");
+    ConsolePoll();
+    TEST_ASSERT_EQUAL_UINT32(0, calls);
+
+    Receive("5\r");
+    ConsolePoll();
+    TEST_ASSERT_EQUAL_UINT32(1, calls);
+    TEST_ASSERT_EQUAL_UINT8(1, last_args.count);
+    TEST_ASSERT_EQUAL_UINT32(15, last_args.values[0].number);
+}
+
+// 7-Las respuestas se envían de a un tramo mientras el puerto está ocupado y siguen al terminar el envío
+void test_output_while_busy(void) {
+    busy = true;
+    Receive("hello\r\n");
+    ConsolePoll();
+    TEST_ASSERT_EQUAL_UINT32(1, transfers);
+    TEST_ASSERT_EQUAL_size_t(9, sent_size);
+
+    Receive("hello\r\nhello\r\n");
+    ConsolePoll();
+    TEST_ASSERT_EQUAL_UINT32(1, transfers);
+    TEST_ASSERT_EQUAL_size_t(CONSOLE_TX_SIZE - 27, ConsoleFree());
+
+    busy = false;
+    ConsolePoll();
+    TEST_ASSERT_EQUAL_UINT32(2, transfers);
+    TEST_ASSERT_EQUAL_size_t(27, sent_size);
+    TEST_ASSERT_EQUAL_size_t(CONSOLE_TX_SIZE, ConsoleFree());
+    sent[sent_size] = 0;
+    TEST_ASSERT_EQUAL_STRING("hola 42\r\nhola 42\r\nhola 42\r\n", sent);
+}
+
+// 8-Lo que no entra en el buffer de envío se descarta y se cuenta
+void test_output_overflow(void) {
+    char block[CONSOLE_TX_SIZE];
+    console_stats_t stats;
+
+    memset(block, 'x', sizeof(block));
+    busy = true;
+    ConsoleWrite(block, CONSOLE_TX_SIZE - 4);
+    ConsolePoll();
+    ConsoleWrite("abcdef", 6);
+
+    ConsoleGetStats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.dropped);
+    TEST_ASSERT_EQUAL_size_t(0, ConsoleFree());
+
+    busy = false;
+    ConsolePoll();
+    TEST_ASSERT_EQUAL_UINT32(2, transfers);
+    TEST_ASSERT_EQUAL_size_t(CONSOLE_TX_SIZE, sent_size);
+    TEST_ASSERT_EQUAL_MEMORY("abcd", &sent[CONSOLE_TX_SIZE - 4], 4);
+
+    // El buffer se vació justo al final, lo siguiente se escribe y se envía desde el principio
+    ConsoleWrite("xyz", 3);
+    ConsolePoll();
+    TEST_ASSERT_EQUAL_UINT32(3, transfers);
+    TEST_ASSERT_EQUAL_MEMORY("xyz", &sent[CONSOLE_TX_SIZE], 3);
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,81 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file test_crc.c
+ ** @brief Código para testeo del cálculo del CRC de 16 bits - Electrónica 4 2025
+ **/
+
+/**
+ * Pruebas a realizar
+- El CRC de ningún byte es el valor inicial.
+- El CRC de "123456789" es el valor de referencia 0x29B1.
+- Calcular el CRC en partes da el mismo resultado que calcularlo de una vez.
+- Un bit cambiado cambia el CRC.
+ *
+ */
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "unity.h"
+
+#include "crc.h"
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+static const char CHECK[] = "123456789";
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+/* === Public function definitions ================================================================================= */
+
+// 1-El CRC de ningún byte es el valor inicial
+void test_empty_data(void) {
+    TEST_ASSERT_EQUAL_HEX16(CRC16_INITIAL, Crc16(CRC16_INITIAL, CHECK, 0));
+}
+
+// 2-El CRC de "123456789" es el valor de referencia 0x29B1
+void test_check_value(void) {
+    TEST_ASSERT_EQUAL_HEX16(0x29B1, Crc16(CRC16_INITIAL, CHECK, 9));
+}
+
+// 3-Calcular el CRC en partes da el mismo resultado que calcularlo de una vez
+void test_crc_in_parts(void) {
+    uint16_t crc = Crc16(CRC16_INITIAL, CHECK, 4);
+
+    TEST_ASSERT_EQUAL_HEX16(0x29B1, Crc16(crc, &CHECK[4], 5));
+}
+
+// 4-Un bit cambiado cambia el CRC
+void test_single_bit_error(void) {
+    char data[] = "123456789";
+
+    data[8] ^= 0x01;
+    TEST_ASSERT_NOT_EQUAL(0x29B1, Crc16(CRC16_INITIAL, data, 9));
+}
+
+/* === End of documentation ======================================================================================== */
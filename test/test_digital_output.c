@@ -0,0 +1,204 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_digital_output.c
+ ** @brief Código para testeo del modulo de salidas digitales - Electrónica 4 2025
+ **/
+
+/**
+ * Pruebas a realizar
+- No se puede crear una salida con un puerto o un pin fuera de rango.
+- El estado de las salidas se lee de la copia en memoria sin acceder al puerto.
+- Cambiar el estado de una salida usa la copia en memoria y no lee el puerto.
+- Un lote no acepta salidas de un puerto distinto al de la primera salida agregada.
+- Un lote se escribe con una única escritura enmascarada que no modifica los otros pines del puerto.
+- Un lote vacío no escribe el puerto.
+ *
+ */
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "unity.h"
+
+#include "digital_output.h"
+#include "hal.h"
+#include <stddef.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! Puertos del GPIO simulado
+#define TEST_PORTS 8
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+//! Valor de cada puerto del GPIO simulado
+static uint32_t ports[TEST_PORTS];
+
+//! Cantidad de escrituras de un único pin
+static uint32_t bit_writes;
+
+//! Cantidad de escrituras enmascaradas y máscara de la última
+static uint32_t masked_writes;
+static uint32_t masked_mask;
+
+//! Cantidad de lecturas del puerto
+static uint32_t reads;
+
+//! Salidas de prueba, las dos primeras comparten el puerto 0
+static digital_output_p first;
+static digital_output_p second;
+static digital_output_p other;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+/* === Public function definitions ================================================================================= */
+
+void HalGpioSetDirection(uint8_t gpio, uint8_t bit, bool output) {
+    (void)gpio;
+    (void)bit;
+    (void)output;
+}
+
+bool HalGpioReadBit(uint8_t gpio, uint8_t bit) {
+    reads++;
+    return (ports[gpio] & (1UL << bit)) != 0;
+}
+
+void HalGpioWriteBit(uint8_t gpio, uint8_t bit, bool state) {
+    bit_writes++;
+    if (state) {
+        ports[gpio] |= (1UL << bit);
+    } else {
+        ports[gpio] &= ~(1UL << bit);
+    }
+}
+
+void HalGpioToggleBit(uint8_t gpio, uint8_t bit) {
+    reads++;
+    ports[gpio] ^= (1UL << bit);
+}
+
+void HalGpioWriteMasked(uint8_t gpio, uint32_t mask, uint32_t value) {
+    masked_writes++;
+    masked_mask = mask;
+    ports[gpio] = (ports[gpio] & ~mask) | (value & mask);
+}
+
+void setUp(void) {
+    static bool created = false;
+
+    // El pool estático tiene pocas salidas, se crean una sola vez y se reutilizan
+    if (!created) {
+        first = DigitalOutputCreate(0, 11);
+        second = DigitalOutputCreate(0, 10);
+        other = DigitalOutputCreate(1, 8);
+        created = true;
+    }
+    DigitalOutputDeactivate(first);
+    DigitalOutputDeactivate(second);
+    DigitalOutputDeactivate(other);
+    bit_writes = 0;
+    masked_writes = 0;
+    masked_mask = 0;
+    reads = 0;
+}
+
+// 1-No se puede crear una salida con un puerto o un pin fuera de rango
+void test_create_out_of_range(void) {
+    TEST_ASSERT_NOT_NULL(first);
+    TEST_ASSERT_NULL(DigitalOutputCreate(TEST_PORTS, 0));
+    TEST_ASSERT_NULL(DigitalOutputCreate(0, 32));
+}
+
+// 2-El estado de las salidas se lee de la copia en memoria sin acceder al puerto
+void test_state_is_read_from_shadow(void) {
+    DigitalOutputActivate(first);
+    TEST_ASSERT_TRUE(DigitalOutputGetIsActive(first));
+    TEST_ASSERT_FALSE(DigitalOutputGetIsActive(second));
+
+    DigitalOutputDeactivate(first);
+    TEST_ASSERT_FALSE(DigitalOutputGetIsActive(first));
+    TEST_ASSERT_EQUAL_UINT32(0, reads);
+}
+
+// 3-Cambiar el estado de una salida usa la copia en memoria y no lee el puerto
+void test_toggle_uses_shadow(void) {
+    DigitalOutputToggle(first);
+    TEST_ASSERT_TRUE(DigitalOutputGetIsActive(first));
+    TEST_ASSERT_EQUAL_HEX32(1UL << 11, ports[0]);
+
+    DigitalOutputToggle(first);
+    TEST_ASSERT_FALSE(DigitalOutputGetIsActive(first));
+    TEST_ASSERT_EQUAL_HEX32(0, ports[0]);
+    TEST_ASSERT_EQUAL_UINT32(0, reads);
+}
+
+// 4-Un lote no acepta salidas de un puerto distinto al de la primera salida agregada
+void test_batch_rejects_mixed_ports(void) {
+    digital_output_batch_t batch;
+
+    DigitalOutputBatchBegin(&batch);
+    TEST_ASSERT_EQUAL_INT(0, DigitalOutputBatchSet(&batch, first, true));
+    TEST_ASSERT_EQUAL_INT(-1, DigitalOutputBatchSet(&batch, other, true));
+    TEST_ASSERT_EQUAL_INT(0, DigitalOutputBatchCommit(&batch));
+
+    TEST_ASSERT_EQUAL_HEX32(1UL << 11, masked_mask);
+    TEST_ASSERT_FALSE(DigitalOutputGetIsActive(other));
+    TEST_ASSERT_EQUAL_HEX32(0, ports[1]);
+}
+
+// 5-Un lote se escribe con una única escritura enmascarada que no modifica los otros pines del puerto
+void test_batch_commit_single_masked_write(void) {
+    digital_output_batch_t batch;
+
+    ports[0] |= (1UL << 3);
+    DigitalOutputActivate(second);
+    bit_writes = 0;
+
+    DigitalOutputBatchBegin(&batch);
+    DigitalOutputBatchSet(&batch, first, true);
+    DigitalOutputBatchSet(&batch, second, false);
+    TEST_ASSERT_EQUAL_UINT32(0, masked_writes);
+    TEST_ASSERT_EQUAL_INT(0, DigitalOutputBatchCommit(&batch));
+
+    TEST_ASSERT_EQUAL_UINT32(1, masked_writes);
+    TEST_ASSERT_EQUAL_UINT32(0, bit_writes);
+    TEST_ASSERT_EQUAL_HEX32((1UL << 11) | (1UL << 10), masked_mask);
+    TEST_ASSERT_EQUAL_HEX32((1UL << 11) | (1UL << 3), ports[0]);
+    TEST_ASSERT_TRUE(DigitalOutputGetIsActive(first));
+    TEST_ASSERT_FALSE(DigitalOutputGetIsActive(second));
+    ports[0] &= ~(1UL << 3);
+}
+
+// 6-Un lote vacío no escribe el puerto
+void test_empty_batch_is_not_written(void) {
+    digital_output_batch_t batch;
+
+    DigitalOutputBatchBegin(&batch);
+    TEST_ASSERT_EQUAL_INT(-1, DigitalOutputBatchCommit(&batch));
+    TEST_ASSERT_EQUAL_UINT32(0, masked_writes);
+}
+
+/* === End of documentation ======================================================================================== */
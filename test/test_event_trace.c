@@ -0,0 +1,199 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file test_event_trace.c
+ ** @brief Código para testeo del registro circular de eventos - Electrónica 4 2025
+ **/
+
+/**
+ * Pruebas a realizar
+- Un registro recién iniciado no tiene registros para leer.
+- Los registros se leen en el orden en que se escribieron con sus datos y su tiempo.
+- El cursor avanza y solo se leen los registros escritos después.
+- Al llenarse el buffer se pierden los registros más viejos y el número del registro leído lo indica.
+- Una escritura que interrumpe a otra no se pierde y el registro a medio escribir no se lee.
+- El registro se escribe como una línea JSON.
+ *
+ */
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "unity.h"
+
+#include "event_trace.h"
+#include <stdbool.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+//! Tiempo simulado de los registros
+static uint32_t Now(void);
+
+//! Tiempo simulado que además escribe o lee un registro como si fuera una interrupción en medio de la escritura
+static uint32_t NowWithInterrupt(void);
+
+/* === Private variable definitions ================================================================================ */
+
+static uint32_t now;
+
+//! Indica si ya se simuló la interrupción, para no repetirla en la escritura que hace ella misma
+static bool interrupted;
+
+//! Resultado de la lectura hecha durante la escritura
+static int interrupt_read;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static uint32_t Now(void) {
+    return now;
+}
+
+static uint32_t NowWithInterrupt(void) {
+    uint32_t cursor = 0;
+    uint32_t sequence;
+    event_trace_record_t record;
+
+    if (!interrupted) {
+        interrupted = true;
+        EventTraceWrite(EVENT_TRACE_ALARM_FIRED, 0, 0);
+        interrupt_read = EventTraceRead(&cursor, &sequence, &record);
+    }
+    return now;
+}
+
+void setUp(void) {
+    now = 1000;
+    interrupted = false;
+    EventTraceInit(Now);
+}
+
+/* === Public function definitions ================================================================================= */
+
+// 1-Un registro recién iniciado no tiene registros para leer
+void test_empty_trace(void) {
+    uint32_t cursor = 0;
+    uint32_t sequence;
+    event_trace_record_t record;
+
+    TEST_ASSERT_EQUAL_UINT32(0, EventTraceCount());
+    TEST_ASSERT_EQUAL_INT(-1, EventTraceRead(&cursor, &sequence, &record));
+}
+
+// 2-Los registros se leen en el orden en que se escribieron con sus datos y su tiempo
+void test_records_are_read_in_order(void) {
+    uint32_t cursor = 0;
+    uint32_t sequence;
+    event_trace_record_t record;
+
+    EventTraceWrite(EVENT_TRACE_TIME_SET, 7, 1815);
+    now = 1015;
+    EventTraceWrite(EVENT_TRACE_INPUT_EDGE, 1, 0x0204);
+
+    TEST_ASSERT_EQUAL_INT(0, EventTraceRead(&cursor, &sequence, &record));
+    TEST_ASSERT_EQUAL_UINT32(0, sequence);
+    TEST_ASSERT_EQUAL_UINT32(1000, record.time);
+    TEST_ASSERT_EQUAL_UINT8(EVENT_TRACE_TIME_SET, record.event);
+    TEST_ASSERT_EQUAL_UINT8(7, record.detail);
+    TEST_ASSERT_EQUAL_UINT16(1815, record.value);
+
+    TEST_ASSERT_EQUAL_INT(0, EventTraceRead(&cursor, &sequence, &record));
+    TEST_ASSERT_EQUAL_UINT32(1, sequence);
+    TEST_ASSERT_EQUAL_UINT32(1015, record.time);
+    TEST_ASSERT_EQUAL_UINT8(EVENT_TRACE_INPUT_EDGE, record.event);
+
+    TEST_ASSERT_EQUAL_INT(-1, EventTraceRead(&cursor, &sequence, &record));
+}
+
+// 3-El cursor avanza y solo se leen los registros escritos después
+void test_cursor_reads_new_records(void) {
+    uint32_t cursor;
+    uint32_t sequence;
+    event_trace_record_t record;
+
+    EventTraceWrite(EVENT_TRACE_ALARM_FIRED, 0, 0);
+    cursor = EventTraceCount();
+    EventTraceWrite(EVENT_TRACE_ALARM_OFF, 0, 0);
+
+    TEST_ASSERT_EQUAL_INT(0, EventTraceRead(&cursor, &sequence, &record));
+    TEST_ASSERT_EQUAL_UINT8(EVENT_TRACE_ALARM_OFF, record.event);
+    TEST_ASSERT_EQUAL_UINT32(2, cursor);
+    TEST_ASSERT_EQUAL_INT(-1, EventTraceRead(&cursor, &sequence, &record));
+}
+
+// 4-Al llenarse el buffer se pierden los registros más viejos y el número del registro leído lo indica
+void test_overflow_drops_oldest_records(void) {
+    uint32_t cursor = 0;
+    uint32_t sequence;
+    event_trace_record_t record;
+    uint32_t index;
+
+    for (index = 0; index < EVENT_TRACE_SIZE + 3; index++) {
+        EventTraceWrite(EVENT_TRACE_STATE_CHANGED, 0, (uint16_t)index);
+    }
+
+    TEST_ASSERT_EQUAL_INT(0, EventTraceRead(&cursor, &sequence, &record));
+    TEST_ASSERT_EQUAL_UINT32(3, sequence);
+    TEST_ASSERT_EQUAL_UINT16(3, record.value);
+
+    for (index = 1; index < EVENT_TRACE_SIZE; index++) {
+        TEST_ASSERT_EQUAL_INT(0, EventTraceRead(&cursor, &sequence, &record));
+    }
+    TEST_ASSERT_EQUAL_UINT16(EVENT_TRACE_SIZE + 2, record.value);
+    TEST_ASSERT_EQUAL_INT(-1, EventTraceRead(&cursor, &sequence, &record));
+}
+
+// 5-Una escritura que interrumpe a otra no se pierde y el registro a medio escribir no se lee
+void test_interrupted_write(void) {
+    uint32_t cursor = 0;
+    uint32_t sequence;
+    event_trace_record_t record;
+
+    EventTraceInit(NowWithInterrupt);
+    EventTraceWrite(EVENT_TRACE_INPUT_EDGE, 0, 0);
+
+    // Durante la interrupción el registro 0 estaba a medio escribir y el 1 completo
+    TEST_ASSERT_EQUAL_INT(0, interrupt_read);
+    TEST_ASSERT_EQUAL_UINT32(2, EventTraceCount());
+
+    TEST_ASSERT_EQUAL_INT(0, EventTraceRead(&cursor, &sequence, &record));
+    TEST_ASSERT_EQUAL_UINT32(0, sequence);
+    TEST_ASSERT_EQUAL_UINT8(EVENT_TRACE_INPUT_EDGE, record.event);
+    TEST_ASSERT_EQUAL_INT(0, EventTraceRead(&cursor, &sequence, &record));
+    TEST_ASSERT_EQUAL_UINT32(1, sequence);
+    TEST_ASSERT_EQUAL_UINT8(EVENT_TRACE_ALARM_FIRED, record.event);
+}
+
+// 6-El registro se escribe como una línea JSON
+void test_format(void) {
+    char text[128];
+    event_trace_record_t record = {.time = 1500, .event = EVENT_TRACE_STATE_CHANGED, .detail = 4, .value = 0x0300};
+    const char * expected = "{\"sequence\":9,\"time\":1500,\"event\":\"state_changed\",\"detail\":4,\"value\":768}\n";
+
+    TEST_ASSERT_EQUAL_INT((int)strlen(expected), EventTraceFormat(9, &record, text, sizeof(text)));
+    TEST_ASSERT_EQUAL_STRING(expected, text);
+}
+
+/* === End of documentation ======================================================================================== */
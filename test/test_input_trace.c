@@ -0,0 +1,196 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file test_input_trace.c
+ ** @brief Código para testeo del registro binario de cambios de las entradas digitales - Electrónica 4 2025
+ **/
+
+/**
+ * Pruebas a realizar
+- No se puede crear un registro con un buffer menor al encabezado.
+- Un registro vacío terminado se puede leer y conserva la duración y la frecuencia.
+- Los cambios se leen con los mismos ticks, entradas y niveles con los que se grabaron.
+- Los cambios cercanos ocupan un byte.
+- Un cambio que no entra en el buffer no se graba y el registro sigue siendo válido.
+- No se pueden grabar más entradas distintas que los canales disponibles.
+- No se puede abrir un registro sin terminar, dañado o de otra versión.
+- No se pueden grabar cambios con ticks menores al anterior ni después de terminar.
+ *
+ */
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "unity.h"
+
+#include "input_trace.h"
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+static uint8_t buffer[256];
+static input_trace_p trace;
+static input_trace_p reader;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+void setUp(void) {
+    memset(buffer, 0xAA, sizeof(buffer));
+    trace = InputTraceCreate(buffer, sizeof(buffer), 1000);
+    reader = NULL;
+}
+
+void tearDown(void) {
+    InputTraceDestroy(trace);
+    InputTraceDestroy(reader);
+}
+
+/* === Public function definitions ================================================================================= */
+
+// 1-No se puede crear un registro con un buffer menor al encabezado
+void test_create_with_small_buffer(void) {
+    TEST_ASSERT_NULL(InputTraceCreate(buffer, INPUT_TRACE_HEADER_SIZE - 1, 1000));
+    TEST_ASSERT_NULL(InputTraceCreate(NULL, sizeof(buffer), 1000));
+}
+
+// 2-Un registro vacío terminado se puede leer y conserva la duración y la frecuencia
+void test_empty_trace(void) {
+    input_trace_event_t event;
+    size_t size = InputTraceFinish(trace, 5000);
+
+    TEST_ASSERT_EQUAL(INPUT_TRACE_HEADER_SIZE + 3, size);
+    reader = InputTraceOpen(buffer, size);
+    TEST_ASSERT_NOT_NULL(reader);
+    TEST_ASSERT_EQUAL_UINT16(1000, InputTraceTicksPerSecond(reader));
+    TEST_ASSERT_EQUAL_UINT64(5000, InputTraceDuration(reader));
+    TEST_ASSERT_FALSE(InputTraceNext(reader, &event));
+}
+
+// 3-Los cambios se leen con los mismos ticks, entradas y niveles con los que se grabaron
+void test_events_round_trip(void) {
+    input_trace_event_t event;
+    size_t size;
+
+    TEST_ASSERT_TRUE(InputTraceRecord(trace, 0, 5, 8, false));
+    TEST_ASSERT_TRUE(InputTraceRecord(trace, 0, 5, 9, true));
+    TEST_ASSERT_TRUE(InputTraceRecord(trace, 1500, 5, 8, true));
+    TEST_ASSERT_TRUE(InputTraceRecord(trace, 4000000000ULL, 5, 9, false));
+    size = InputTraceFinish(trace, 4000000015ULL);
+    reader = InputTraceOpen(buffer, size);
+    TEST_ASSERT_NOT_NULL(reader);
+
+    TEST_ASSERT_TRUE(InputTraceNext(reader, &event));
+    TEST_ASSERT_EQUAL_UINT64(0, event.ticks);
+    TEST_ASSERT_EQUAL_UINT8(5, event.gpio);
+    TEST_ASSERT_EQUAL_UINT8(8, event.bit);
+    TEST_ASSERT_FALSE(event.level);
+    TEST_ASSERT_TRUE(InputTraceNext(reader, &event));
+    TEST_ASSERT_EQUAL_UINT64(0, event.ticks);
+    TEST_ASSERT_EQUAL_UINT8(9, event.bit);
+    TEST_ASSERT_TRUE(event.level);
+    TEST_ASSERT_TRUE(InputTraceNext(reader, &event));
+    TEST_ASSERT_EQUAL_UINT64(1500, event.ticks);
+    TEST_ASSERT_EQUAL_UINT8(8, event.bit);
+    TEST_ASSERT_TRUE(event.level);
+    TEST_ASSERT_TRUE(InputTraceNext(reader, &event));
+    TEST_ASSERT_EQUAL_UINT64(4000000000ULL, event.ticks);
+    TEST_ASSERT_EQUAL_UINT8(9, event.bit);
+    TEST_ASSERT_FALSE(event.level);
+    TEST_ASSERT_FALSE(InputTraceNext(reader, &event));
+    TEST_ASSERT_EQUAL_UINT64(4000000015ULL, InputTraceDuration(reader));
+}
+
+// 4-Los cambios cercanos ocupan un byte
+void test_close_events_use_one_byte(void) {
+    InputTraceRecord(trace, 3, 1, 2, true);
+    InputTraceRecord(trace, 10, 1, 2, false);
+
+    TEST_ASSERT_EQUAL(INPUT_TRACE_HEADER_SIZE + 3, InputTraceFinish(trace, 10));
+}
+
+// 5-Un cambio que no entra en el buffer no se graba y el registro sigue siendo válido
+void test_full_buffer(void) {
+    input_trace_event_t event;
+    size_t size;
+
+    InputTraceDestroy(trace);
+    trace = InputTraceCreate(buffer, INPUT_TRACE_HEADER_SIZE + 2, 1000);
+    TEST_ASSERT_TRUE(InputTraceRecord(trace, 1, 1, 2, true));
+    TEST_ASSERT_FALSE(InputTraceRecord(trace, 1000, 1, 3, true));
+    size = InputTraceFinish(trace, 2);
+    TEST_ASSERT_EQUAL(INPUT_TRACE_HEADER_SIZE + 2, size);
+
+    reader = InputTraceOpen(buffer, size);
+    TEST_ASSERT_NOT_NULL(reader);
+    TEST_ASSERT_TRUE(InputTraceNext(reader, &event));
+    TEST_ASSERT_FALSE(InputTraceNext(reader, &event));
+}
+
+// 6-No se pueden grabar más entradas distintas que los canales disponibles
+void test_too_many_channels(void) {
+    uint8_t bit;
+
+    for (bit = 0; bit < INPUT_TRACE_MAX_CHANNELS; bit++) {
+        TEST_ASSERT_TRUE(InputTraceRecord(trace, bit, 0, bit, true));
+    }
+    TEST_ASSERT_FALSE(InputTraceRecord(trace, 10, 0, INPUT_TRACE_MAX_CHANNELS, true));
+    TEST_ASSERT_TRUE(InputTraceRecord(trace, 10, 0, 0, false));
+}
+
+// 7-No se puede abrir un registro sin terminar, dañado o de otra versión
+void test_open_invalid_traces(void) {
+    size_t size;
+
+    InputTraceRecord(trace, 1, 1, 2, true);
+    TEST_ASSERT_NULL(InputTraceOpen(buffer, INPUT_TRACE_HEADER_SIZE + 1));
+
+    size = InputTraceFinish(trace, 2);
+    TEST_ASSERT_NULL(InputTraceOpen(buffer, size - 1));
+    buffer[4] = INPUT_TRACE_VERSION + 1;
+    TEST_ASSERT_NULL(InputTraceOpen(buffer, size));
+    buffer[4] = INPUT_TRACE_VERSION;
+    buffer[0] = 'X';
+    TEST_ASSERT_NULL(InputTraceOpen(buffer, size));
+    buffer[0] = 'R';
+
+    // Un cambio de un canal que no está en el encabezado
+    buffer[INPUT_TRACE_HEADER_SIZE] = (1 << 4) | (3 << 1);
+    TEST_ASSERT_NULL(InputTraceOpen(buffer, size));
+}
+
+// 8-No se pueden grabar cambios con ticks menores al anterior ni después de terminar
+void test_record_rejects_invalid_events(void) {
+    TEST_ASSERT_TRUE(InputTraceRecord(trace, 100, 1, 2, true));
+    TEST_ASSERT_FALSE(InputTraceRecord(trace, 99, 1, 2, false));
+    TEST_ASSERT_EQUAL(0, InputTraceFinish(trace, 50));
+
+    TEST_ASSERT_NOT_EQUAL(0, InputTraceFinish(trace, 100));
+    TEST_ASSERT_FALSE(InputTraceRecord(trace, 200, 1, 2, false));
+    TEST_ASSERT_EQUAL(0, InputTraceFinish(trace, 300));
+}
+
+/* === End of documentation ======================================================================================== */
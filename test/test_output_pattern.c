@@ -0,0 +1,274 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_output_pattern.c
+ ** @brief Código para testeo del generador de patrones sobre salidas digitales - Electrónica 4 2025
+ **/
+
+/**
+ * Pruebas a realizar
+- No se puede empezar una secuencia sin pasos.
+- En un periodo de PWM la salida está activa la cantidad de ticks indicada por el ciclo de trabajo.
+- La salida solo se escribe cuando cambia su estado.
+- La secuencia BEEP_BEEP avanza por todos sus pasos y vuelve a empezar.
+- La secuencia ESCALATING avanza por todos sus pasos y vuelve a empezar.
+- La secuencia PULSE avanza por todos sus pasos y vuelve a empezar.
+- Al detener el generador la salida queda inactiva en el próximo tick y no se vuelve a escribir.
+- Una secuencia que no se repite se detiene al terminar y deja la salida inactiva.
+- Empezar una secuencia nueva reemplaza a la anterior desde su primer paso.
+- Al avanzar sobre un lote el cambio de la salida se escribe recién al confirmar el lote.
+ *
+ */
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "unity.h"
+
+#include "output_pattern.h"
+#include <stddef.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! Cantidad de elementos de un array
+#define LENGTH(array) (sizeof(array) / sizeof(array[0]))
+
+/* === Private data type declarations ============================================================================== */
+
+//! Salida digital simulada, reemplaza a la del módulo digital_output
+struct digital_output_s {
+    bool active;     //!< último estado escrito en la salida
+    uint32_t writes; //!< cantidad de escrituras de la salida
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Avanza el generador la cantidad de ticks indicada
+ *
+ * @param ticks cantidad de llamadas a @ref OutputPatternTick()
+ * @return cantidad de ticks en los que la salida quedó activa
+ */
+static uint32_t Run(uint32_t ticks);
+
+/**
+ * @brief Reproduce una secuencia completa y verifica cada paso y la vuelta al primero
+ *
+ * @param sequence secuencia que se verifica, debe repetirse
+ */
+static void CheckSequence(const output_sequence_t * sequence);
+
+/* === Private variable definitions ================================================================================ */
+
+static struct digital_output_s output;
+static output_pattern_p pattern;
+
+//! Secuencia de un único paso con un ciclo de trabajo de 3 ticks por periodo
+static const output_pattern_step_t PARTIAL_STEPS[] = {{3, 1000}};
+static const output_sequence_t PARTIAL = {.steps = PARTIAL_STEPS, .count = LENGTH(PARTIAL_STEPS), .loop = true};
+
+//! Secuencia que enciende la salida 5 ticks y termina
+static const output_pattern_step_t ONCE_STEPS[] = {{OUTPUT_PATTERN_PWM_PERIOD, 5}};
+static const output_sequence_t ONCE = {.steps = ONCE_STEPS, .count = LENGTH(ONCE_STEPS), .loop = false};
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static uint32_t Run(uint32_t ticks) {
+    uint32_t active = 0;
+
+    while (ticks > 0) {
+        OutputPatternTick(pattern);
+        if (output.active) {
+            active++;
+        }
+        ticks--;
+    }
+
+    return active;
+}
+
+static void CheckSequence(const output_sequence_t * sequence) {
+    const output_pattern_step_t * step;
+    uint8_t index;
+
+    TEST_ASSERT_EQUAL_INT(0, OutputPatternStart(pattern, sequence));
+    for (index = 0; index < sequence->count; index++) {
+        step = &sequence->steps[index];
+        TEST_ASSERT_EQUAL_UINT32((uint32_t)step->duty * step->ticks / OUTPUT_PATTERN_PWM_PERIOD, Run(step->ticks));
+        TEST_ASSERT_TRUE(OutputPatternIsRunning(pattern));
+    }
+
+    step = &sequence->steps[0];
+    TEST_ASSERT_EQUAL_UINT32((uint32_t)step->duty * step->ticks / OUTPUT_PATTERN_PWM_PERIOD, Run(step->ticks));
+}
+
+/* === Public function definitions ================================================================================= */
+
+void DigitalOutputActivate(digital_output_p self) {
+    self->active = true;
+    self->writes++;
+}
+
+void DigitalOutputDeactivate(digital_output_p self) {
+    self->active = false;
+    self->writes++;
+}
+
+void DigitalOutputBatchBegin(digital_output_batch_t * batch) {
+    batch->port = 0;
+    batch->mask = 0;
+    batch->value = 0;
+}
+
+int DigitalOutputBatchSet(digital_output_batch_t * batch, digital_output_p output, bool active) {
+    (void)output;
+    batch->mask = 1;
+    batch->value = active ? 1 : 0;
+    return 0;
+}
+
+// La única salida de las pruebas es la que se escribe al confirmar el lote
+int DigitalOutputBatchCommit(digital_output_batch_t * batch) {
+    int result = -1;
+
+    if (batch->mask != 0) {
+        output.active = (batch->value != 0);
+        output.writes++;
+        result = 0;
+    }
+
+    return result;
+}
+
+void setUp(void) {
+    static output_pattern_p created = NULL;
+
+    // El pool estático solo tiene un generador, se crea una sola vez y se reutiliza
+    if (created == NULL) {
+        created = OutputPatternCreate(&output, false);
+    }
+    pattern = created;
+    OutputPatternStop(pattern);
+    OutputPatternTick(pattern);
+    output.writes = 0;
+}
+
+// 1-No se puede empezar una secuencia sin pasos
+void test_start_without_steps(void) {
+    static const output_sequence_t empty = {.steps = NULL, .count = 0, .loop = true};
+
+    TEST_ASSERT_EQUAL_INT(-1, OutputPatternStart(pattern, NULL));
+    TEST_ASSERT_EQUAL_INT(-1, OutputPatternStart(pattern, &empty));
+    TEST_ASSERT_FALSE(OutputPatternIsRunning(pattern));
+}
+
+// 2-En un periodo de PWM la salida está activa la cantidad de ticks indicada por el ciclo de trabajo
+void test_pwm_duty_cycle_over_one_period(void) {
+    int phase;
+
+    OutputPatternStart(pattern, &PARTIAL);
+    for (phase = 0; phase < OUTPUT_PATTERN_PWM_PERIOD; phase++) {
+        OutputPatternTick(pattern);
+        TEST_ASSERT_EQUAL(phase < 3, output.active);
+    }
+}
+
+// 3-La salida solo se escribe cuando cambia su estado
+void test_output_written_only_on_change(void) {
+    OutputPatternStart(pattern, &PARTIAL);
+    Run(OUTPUT_PATTERN_PWM_PERIOD);
+    TEST_ASSERT_EQUAL_UINT32(2, output.writes);
+
+    OutputPatternStart(pattern, &OUTPUT_SEQUENCE_BEEP_BEEP);
+    Run(100);
+    TEST_ASSERT_EQUAL_UINT32(3, output.writes);
+}
+
+// 4-La secuencia BEEP_BEEP avanza por todos sus pasos y vuelve a empezar
+void test_beep_beep_advances_and_loops(void) {
+    CheckSequence(&OUTPUT_SEQUENCE_BEEP_BEEP);
+}
+
+// 5-La secuencia ESCALATING avanza por todos sus pasos y vuelve a empezar
+void test_escalating_advances_and_loops(void) {
+    CheckSequence(&OUTPUT_SEQUENCE_ESCALATING);
+}
+
+// 6-La secuencia PULSE avanza por todos sus pasos y vuelve a empezar
+void test_pulse_advances_and_loops(void) {
+    CheckSequence(&OUTPUT_SEQUENCE_PULSE);
+}
+
+// 7-Al detener el generador la salida queda inactiva en el próximo tick y no se vuelve a escribir
+void test_stop_leaves_output_inactive(void) {
+    OutputPatternStart(pattern, &OUTPUT_SEQUENCE_BEEP_BEEP);
+    Run(50);
+    TEST_ASSERT_TRUE(output.active);
+
+    OutputPatternStop(pattern);
+    TEST_ASSERT_FALSE(OutputPatternIsRunning(pattern));
+    TEST_ASSERT_TRUE(output.active);
+
+    output.writes = 0;
+    TEST_ASSERT_EQUAL_UINT32(0, Run(1000));
+    TEST_ASSERT_EQUAL_UINT32(1, output.writes);
+}
+
+// 8-Una secuencia que no se repite se detiene al terminar y deja la salida inactiva
+void test_sequence_without_loop_stops_at_end(void) {
+    OutputPatternStart(pattern, &ONCE);
+    TEST_ASSERT_EQUAL_UINT32(4, Run(4));
+    TEST_ASSERT_TRUE(OutputPatternIsRunning(pattern));
+
+    Run(1);
+    TEST_ASSERT_FALSE(OutputPatternIsRunning(pattern));
+    TEST_ASSERT_FALSE(output.active);
+}
+
+// 9-Empezar una secuencia nueva reemplaza a la anterior desde su primer paso
+void test_start_replaces_running_sequence(void) {
+    OutputPatternStart(pattern, &OUTPUT_SEQUENCE_BEEP_BEEP);
+    Run(150);
+    TEST_ASSERT_FALSE(output.active);
+
+    OutputPatternStart(pattern, &OUTPUT_SEQUENCE_BEEP_BEEP);
+    TEST_ASSERT_EQUAL_UINT32(100, Run(100));
+}
+
+// 10-Al avanzar sobre un lote el cambio de la salida se escribe recién al confirmar el lote
+void test_tick_batch_writes_on_commit(void) {
+    digital_output_batch_t batch;
+
+    OutputPatternStart(pattern, &OUTPUT_SEQUENCE_BEEP_BEEP);
+    DigitalOutputBatchBegin(&batch);
+    OutputPatternTickBatch(pattern, &batch);
+    TEST_ASSERT_FALSE(output.active);
+    TEST_ASSERT_EQUAL_UINT32(0, output.writes);
+
+    TEST_ASSERT_EQUAL_INT(0, DigitalOutputBatchCommit(&batch));
+    TEST_ASSERT_TRUE(output.active);
+
+    DigitalOutputBatchBegin(&batch);
+    OutputPatternTickBatch(pattern, &batch);
+    TEST_ASSERT_EQUAL_INT(-1, DigitalOutputBatchCommit(&batch));
+    TEST_ASSERT_EQUAL_UINT32(1, output.writes);
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,194 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file test_profiler.c
+ ** @brief Código para testeo de las mediciones de las rutinas de interrupción - Electrónica 4 2025
+ **/
+
+/**
+ * Pruebas a realizar
+- Una región recién iniciada no tiene ejecuciones.
+- Al salir de una región se acumulan la duración, el mínimo, el máximo y el promedio.
+- Cada duración se cuenta en el cubo de su cantidad de bits significativos, los valores grandes en el último.
+- La latencia indicada al entrar se acumula igual que la duración.
+- Las regiones iniciadas se leen en tiempo de ejecución y no se repiten al reiniciarlas.
+- No se pueden iniciar más regiones que las permitidas.
+- El resultado se escribe como una línea JSON y se recorta si no entra en el buffer.
+ *
+ */
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "unity.h"
+
+#include "profiler.h"
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Función que simula una ejecución de una región con la duración y la latencia indicadas
+ *
+ */
+static void Run(profiler_region_t * region, uint32_t duration, uint32_t latency);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Valor del contador de alta resolución simulado
+static uint32_t timestamp;
+
+static profiler_region_t region = {.name = "Tick"};
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+// Capa de abstracción del hardware simulada
+
+uint32_t HalTimestamp(void) {
+    return timestamp;
+}
+
+uint32_t HalCycleCounterFrequency(void) {
+    return 1000;
+}
+
+void HalInterruptsDisable(void) {
+}
+
+void HalInterruptsEnable(void) {
+}
+
+static void Run(profiler_region_t * self, uint32_t duration, uint32_t latency) {
+    uint32_t start = timestamp;
+
+    ProfilerEnter(self, latency);
+    timestamp += duration;
+    ProfilerExit(self, start);
+}
+
+void setUp(void) {
+    timestamp = 0xFFFFFFF0;
+    ProfilerStart(&region);
+}
+
+/* === Public function definitions ================================================================================= */
+
+// 1-Una región recién iniciada no tiene ejecuciones
+void test_started_region_is_empty(void) {
+    TEST_ASSERT_EQUAL_UINT32(0, region.count);
+    TEST_ASSERT_EQUAL_UINT32(0, region.duration.max);
+    TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, region.duration.min);
+}
+
+// 2-Al salir de una región se acumulan la duración, el mínimo, el máximo y el promedio
+void test_exit_accumulates_duration(void) {
+    Run(&region, 100, 0);
+    Run(&region, 40, 0);
+    Run(&region, 70, 0);
+
+    TEST_ASSERT_EQUAL_UINT32(3, region.count);
+    TEST_ASSERT_EQUAL_UINT32(70, region.duration.last);
+    TEST_ASSERT_EQUAL_UINT32(40, region.duration.min);
+    TEST_ASSERT_EQUAL_UINT32(100, region.duration.max);
+    TEST_ASSERT_EQUAL_UINT64(210, region.duration.total);
+}
+
+// 3-Cada duración se cuenta en el cubo de su cantidad de bits significativos, los valores grandes en el último
+void test_histogram_buckets(void) {
+    Run(&region, 0, 0);
+    Run(&region, 1, 0);
+    Run(&region, 2, 0);
+    Run(&region, 3, 0);
+    Run(&region, 1000, 0);
+    Run(&region, 0x80000000, 0);
+
+    TEST_ASSERT_EQUAL_UINT32(1, region.duration.histogram[0]);
+    TEST_ASSERT_EQUAL_UINT32(1, region.duration.histogram[1]);
+    TEST_ASSERT_EQUAL_UINT32(2, region.duration.histogram[2]);
+    TEST_ASSERT_EQUAL_UINT32(1, region.duration.histogram[10]);
+    TEST_ASSERT_EQUAL_UINT32(1, region.duration.histogram[PROFILER_BUCKETS - 1]);
+}
+
+// 4-La latencia indicada al entrar se acumula igual que la duración
+void test_latency_is_accumulated(void) {
+    Run(&region, 10, 5);
+    Run(&region, 10, 9);
+
+    TEST_ASSERT_EQUAL_UINT32(5, region.latency.min);
+    TEST_ASSERT_EQUAL_UINT32(9, region.latency.max);
+    TEST_ASSERT_EQUAL_UINT32(1, region.latency.histogram[3]);
+    TEST_ASSERT_EQUAL_UINT32(1, region.latency.histogram[4]);
+}
+
+// 5-Las regiones iniciadas se leen en tiempo de ejecución y no se repiten al reiniciarlas
+void test_snapshot_started_regions(void) {
+    profiler_region_t copy;
+    size_t count = ProfilerCount();
+
+    Run(&region, 10, 0);
+    ProfilerStart(&region);
+    Run(&region, 25, 0);
+
+    TEST_ASSERT_EQUAL(count, ProfilerCount());
+    TEST_ASSERT_EQUAL_INT(0, ProfilerSnapshot(0, &copy));
+    TEST_ASSERT_EQUAL_STRING("Tick", copy.name);
+    TEST_ASSERT_EQUAL_UINT32(1, copy.count);
+    TEST_ASSERT_EQUAL_UINT32(25, copy.duration.last);
+    TEST_ASSERT_EQUAL_INT(-1, ProfilerSnapshot(count, &copy));
+}
+
+// 6-No se pueden iniciar más regiones que las permitidas
+void test_too_many_regions(void) {
+    static profiler_region_t others[PROFILER_MAX_REGIONS];
+    int result = 0;
+    int index;
+
+    for (index = 0; index < PROFILER_MAX_REGIONS && result == 0; index++) {
+        result = ProfilerStart(&others[index]);
+    }
+    TEST_ASSERT_EQUAL_INT(-1, result);
+    TEST_ASSERT_EQUAL(PROFILER_MAX_REGIONS, ProfilerCount());
+}
+
+// 7-El resultado se escribe como una línea JSON y se recorta si no entra en el buffer
+void test_format(void) {
+    char text[512];
+    char small[16];
+    int length;
+
+    Run(&region, 3, 1);
+    length = ProfilerFormat(&region, text, sizeof(text));
+
+    TEST_ASSERT_EQUAL_INT((int)strlen(text), length);
+    TEST_ASSERT_EQUAL_STRING_LEN("{\"name\":\"Tick\",\"frequency\":1000,\"count\":1,\"duration\":{\"last\":3,\"min\":3,",
+                                 text, 71);
+    TEST_ASSERT_EQUAL_INT('\n', text[length - 1]);
+
+    TEST_ASSERT_EQUAL_INT(length, ProfilerFormat(&region, small, sizeof(small)));
+    TEST_ASSERT_EQUAL_STRING_LEN(text, small, sizeof(small) - 1);
+    TEST_ASSERT_EQUAL_INT(0, small[sizeof(small) - 1]);
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,300 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_scheduler.c
+ ** @brief Código para testeo del planificador de tareas periódicas - Electrónica 4 2025
+ **/
+
+/**
+ * Pruebas a realizar
+- No se puede crear el planificador con un driver invalido.
+- Una tarea no se ejecuta antes de su periodo y se ejecuta al cumplirlo.
+- Si no hay tareas pendientes el planificador duerme y cuenta el despertar.
+- Una iteración demorada no pierde el periodo (plazo mayor o igual).
+- Una tarea atrasada varios periodos se ejecuta una vez y se vuelve a sincronizar.
+- No se pueden agregar tareas invalidas ni más de las permitidas.
+- Se puede quitar una tarea.
+- El planificador funciona cuando el contador de ticks desborda.
+- Las estadísticas miden el tiempo dormido y el tiempo total.
+- Los periodos salteados por atraso se cuentan, se guarda el peor atraso y se avisa al driver.
+- Los tiempos de las estadísticas no se pierden cuando el contador da la vuelta.
+- El planificador lee el tiempo una sola vez por iteración y duerme con ese valor.
+ *
+ */
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "unity.h"
+
+#include "scheduler.h"
+#include <stddef.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+//! Base de tiempo simulada
+static uint32_t Now(void);
+
+//! Simula dormir hasta el próximo tick, que llega @ref sleep_step ticks después
+static void Sleep(uint32_t now);
+
+//! Tarea que cuenta sus ejecuciones
+static void Task(void);
+
+//! Memoriza el último aviso de periodos salteados
+static void Missed(scheduler_task_p task, uint32_t lateness);
+
+/* === Private variable definitions ================================================================================ */
+
+static const struct scheduler_driver_s driver = {
+    .Now = Now,
+    .Sleep = Sleep,
+    .Cycles = NULL,
+    .Missed = Missed,
+};
+
+static uint32_t ticks;
+static int now_reads;
+static uint32_t sleep_step;
+static int runs;
+static scheduler_p scheduler;
+static scheduler_task_p missed_task;
+static uint32_t missed_lateness;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static uint32_t Now(void) {
+    now_reads++;
+    return ticks;
+}
+
+static void Sleep(uint32_t now) {
+    if (now == ticks) {
+        ticks += sleep_step;
+    }
+}
+
+static void Task(void) {
+    runs++;
+}
+
+static void Missed(scheduler_task_p task, uint32_t lateness) {
+    missed_task = task;
+    missed_lateness = lateness;
+}
+
+void setUp(void) {
+    static scheduler_p created = NULL;
+
+    ticks = 0;
+    now_reads = 0;
+    sleep_step = 1;
+    runs = 0;
+    missed_task = NULL;
+    missed_lateness = 0;
+    // El pool estático solo tiene un planificador, se crea una sola vez y se reutiliza
+    if (created == NULL) {
+        created = SchedulerCreate(&driver);
+    }
+    scheduler = created;
+    SchedulerRemoveTask(scheduler, Task);
+}
+
+/* === Public function definitions ================================================================================= */
+
+// 1-No se puede crear el planificador con un driver invalido
+void test_create_with_invalid_driver(void) {
+    static const struct scheduler_driver_s invalid_driver = {
+        .Now = Now,
+        .Sleep = NULL,
+    };
+
+    TEST_ASSERT_NULL(SchedulerCreate(NULL));
+    TEST_ASSERT_NULL(SchedulerCreate(&invalid_driver));
+}
+
+// 2-Una tarea no se ejecuta antes de su periodo y se ejecuta al cumplirlo
+void test_task_runs_when_its_period_expires(void) {
+    TEST_ASSERT_EQUAL_INT(0, SchedulerAddTask(scheduler, Task, 15));
+
+    for (int i = 0; i < 15; i++) {
+        SchedulerRun(scheduler);
+    }
+    TEST_ASSERT_EQUAL_INT(0, runs);
+
+    SchedulerRun(scheduler);
+    TEST_ASSERT_EQUAL_INT(1, runs);
+}
+
+// 3-Si no hay tareas pendientes el planificador duerme y cuenta el despertar
+void test_sleeps_when_nothing_is_pending(void) {
+    scheduler_stats_t stats;
+
+    SchedulerResetStats(scheduler);
+    SchedulerRun(scheduler);
+    SchedulerRun(scheduler);
+
+    SchedulerGetStats(scheduler, &stats);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.wakeups);
+    TEST_ASSERT_EQUAL_UINT32(2, ticks);
+}
+
+// 4-Una iteración demorada no pierde el periodo
+void test_late_iteration_does_not_miss_the_period(void) {
+    SchedulerAddTask(scheduler, Task, 15);
+
+    ticks = 17;
+    TEST_ASSERT_TRUE(SchedulerRunPending(scheduler));
+    TEST_ASSERT_EQUAL_INT(1, runs);
+
+    // El siguiente plazo respeta el periodo original
+    ticks = 30;
+    TEST_ASSERT_TRUE(SchedulerRunPending(scheduler));
+    TEST_ASSERT_EQUAL_INT(2, runs);
+}
+
+// 5-Una tarea atrasada varios periodos se ejecuta una vez y se vuelve a sincronizar
+void test_task_late_several_periods_runs_once(void) {
+    SchedulerAddTask(scheduler, Task, 10);
+
+    ticks = 55;
+    SchedulerRunPending(scheduler);
+    SchedulerRunPending(scheduler);
+    TEST_ASSERT_EQUAL_INT(1, runs);
+
+    ticks = 64;
+    TEST_ASSERT_FALSE(SchedulerRunPending(scheduler));
+    ticks = 65;
+    TEST_ASSERT_TRUE(SchedulerRunPending(scheduler));
+}
+
+// 6-No se pueden agregar tareas invalidas ni más de las permitidas
+void test_add_invalid_tasks(void) {
+    int result = 0;
+
+    TEST_ASSERT_EQUAL_INT(-1, SchedulerAddTask(scheduler, NULL, 10));
+    TEST_ASSERT_EQUAL_INT(-1, SchedulerAddTask(scheduler, Task, 0));
+
+    for (int i = 0; i < 100 && result == 0; i++) {
+        result = SchedulerAddTask(scheduler, Task, 10);
+    }
+    TEST_ASSERT_EQUAL_INT(-1, result);
+}
+
+// 7-Se puede quitar una tarea
+void test_remove_task(void) {
+    SchedulerAddTask(scheduler, Task, 5);
+
+    TEST_ASSERT_EQUAL_INT(0, SchedulerRemoveTask(scheduler, Task));
+    TEST_ASSERT_EQUAL_INT(-1, SchedulerRemoveTask(scheduler, Task));
+
+    ticks = 5;
+    TEST_ASSERT_FALSE(SchedulerRunPending(scheduler));
+}
+
+// 8-El planificador funciona cuando el contador de ticks desborda
+void test_deadline_across_tick_overflow(void) {
+    ticks = UINT32_MAX - 5;
+    SchedulerAddTask(scheduler, Task, 10);
+
+    ticks = UINT32_MAX;
+    TEST_ASSERT_FALSE(SchedulerRunPending(scheduler));
+    ticks = 4;
+    TEST_ASSERT_TRUE(SchedulerRunPending(scheduler));
+}
+
+// 9-Las estadísticas miden el tiempo dormido y el tiempo total
+void test_stats_measure_idle_and_elapsed_time(void) {
+    scheduler_stats_t stats;
+
+    SchedulerResetStats(scheduler);
+    SchedulerAddTask(scheduler, Task, 4);
+    for (int i = 0; i < 8; i++) {
+        SchedulerRun(scheduler);
+    }
+
+    SchedulerGetStats(scheduler, &stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.runs);
+    TEST_ASSERT_EQUAL_UINT32(7, stats.wakeups);
+    TEST_ASSERT_EQUAL_UINT64(7, stats.idle);
+    TEST_ASSERT_EQUAL_UINT64(7, stats.elapsed);
+}
+
+// 10-Los periodos salteados por atraso se cuentan, se guarda el peor atraso y se avisa al driver
+void test_skipped_periods_are_reported(void) {
+    scheduler_stats_t stats;
+
+    SchedulerResetStats(scheduler);
+    SchedulerAddTask(scheduler, Task, 10);
+
+    ticks = 12;
+    SchedulerRunPending(scheduler);
+    TEST_ASSERT_TRUE(missed_task == NULL);
+
+    ticks = 57;
+    SchedulerRunPending(scheduler);
+    TEST_ASSERT_TRUE(missed_task == Task);
+    TEST_ASSERT_EQUAL_UINT32(37, missed_lateness);
+
+    SchedulerGetStats(scheduler, &stats);
+    TEST_ASSERT_EQUAL_UINT32(3, stats.skipped);
+    TEST_ASSERT_EQUAL_UINT32(37, stats.worst);
+}
+
+// 11-Los tiempos de las estadísticas no se pierden cuando el contador da la vuelta
+void test_stats_survive_counter_overflow(void) {
+    scheduler_stats_t stats;
+
+    ticks = UINT32_MAX - 10;
+    sleep_step = 0x40000000;
+    SchedulerResetStats(scheduler);
+    for (int i = 0; i < 8; i++) {
+        SchedulerRun(scheduler);
+    }
+    ticks += 5;
+
+    SchedulerGetStats(scheduler, &stats);
+    TEST_ASSERT_EQUAL_UINT32(8, stats.wakeups);
+    TEST_ASSERT_EQUAL_UINT64(0x200000000ULL, stats.idle);
+    TEST_ASSERT_EQUAL_UINT64(0x200000005ULL, stats.elapsed);
+}
+
+// 12-El planificador lee el tiempo una sola vez por iteración y duerme con ese valor
+void test_run_reads_time_once(void) {
+    TEST_ASSERT_EQUAL_INT(0, SchedulerAddTask(scheduler, Task, 5));
+
+    // Una lectura para los plazos y dos para medir el tiempo dormido, el driver no tiene Cycles y se usa Now
+    now_reads = 0;
+    SchedulerRun(scheduler);
+    TEST_ASSERT_EQUAL_INT(3, now_reads);
+    TEST_ASSERT_EQUAL_UINT32(1, ticks);
+
+    ticks = 5;
+    now_reads = 0;
+    SchedulerRun(scheduler);
+    TEST_ASSERT_EQUAL_INT(1, now_reads);
+    TEST_ASSERT_EQUAL_INT(1, runs);
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,228 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file test_snapshot.c
+ ** @brief Código para testeo de la copia de la configuración en el almacenamiento no volátil - Electrónica 4 2025
+ **/
+
+/**
+ * Pruebas a realizar
+- Con el almacenamiento borrado no hay ninguna copia.
+- Una copia guardada se recupera al reiniciar.
+- Una copia igual a la anterior no se escribe.
+- Después de dar varias vueltas al almacenamiento se recupera la copia más nueva.
+- Si la copia más nueva está dañada se recupera la anterior.
+- Las copias de otra versión del formato se ignoran y las nuevas siguen su secuencia.
+- Al reiniciar solo se lee una cantidad de registros proporcional al logaritmo de la capacidad.
+ *
+ */
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "unity.h"
+
+#include "snapshot.h"
+#include "crc.h"
+#include "hal.h"
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! Registros de 16 bytes que entran en el almacenamiento de prueba
+#define TEST_SLOTS 8
+
+/* === Private data type declarations ============================================================================== */
+
+//! Misma disposición que los registros que escribe el módulo
+typedef struct test_record_s {
+    uint32_t sequence;
+    uint8_t version;
+    uint8_t flags;
+    uint16_t crc;
+    uint8_t time[4];
+    uint8_t alarm[4];
+} test_record_t;
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+//! Almacenamiento de prueba
+static uint8_t storage[TEST_SLOTS * sizeof(test_record_t)];
+
+//! Cantidad de lecturas del almacenamiento
+static uint32_t reads;
+
+//! Cantidad de escrituras del almacenamiento
+static uint32_t writes;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+/**
+ * @brief Función que arma una configuración de prueba con la hora hh:mm
+ *
+ * @param hours horas
+ * @param minutes minutos
+ * @return configuración con la hora válida y la alarma a las 07:30 activada
+ */
+static snapshot_t TestSnapshot(uint8_t hours, uint8_t minutes) {
+    snapshot_t snapshot = {
+        .flags = SNAPSHOT_TIME_VALID | SNAPSHOT_ALARM_SET | SNAPSHOT_ALARM_ACTIVE,
+        .time = {minutes % 10, minutes / 10, hours % 10, hours / 10},
+        .alarm = {0, 3, 7, 0},
+    };
+
+    return snapshot;
+}
+
+/* === Public function definitions ================================================================================= */
+
+uint32_t HalStorageSize(void) {
+    return sizeof(storage);
+}
+
+void HalStorageRead(uint32_t address, void * data, size_t size) {
+    reads++;
+    memcpy(data, &storage[address], size);
+}
+
+bool HalStorageWrite(uint32_t address, const void * data, size_t size) {
+    writes++;
+    memcpy(&storage[address], data, size);
+    return true;
+}
+
+void setUp(void) {
+    memset(storage, 0xFF, sizeof(storage));
+    reads = 0;
+    writes = 0;
+}
+
+// 1-Con el almacenamiento borrado no hay ninguna copia
+void test_erased_storage_has_no_snapshot(void) {
+    snapshot_t snapshot;
+
+    TEST_ASSERT_EQUAL_INT(-1, SnapshotRestore(&snapshot));
+}
+
+// 2-Una copia guardada se recupera al reiniciar
+void test_saved_snapshot_is_restored(void) {
+    snapshot_t saved = TestSnapshot(12, 34);
+    snapshot_t restored;
+
+    SnapshotRestore(&restored);
+    TEST_ASSERT_EQUAL_INT(0, SnapshotSave(&saved));
+
+    TEST_ASSERT_EQUAL_INT(0, SnapshotRestore(&restored));
+    TEST_ASSERT_EQUAL_HEX8(saved.flags, restored.flags);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(saved.time, restored.time, sizeof(saved.time));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(saved.alarm, restored.alarm, sizeof(saved.alarm));
+}
+
+// 3-Una copia igual a la anterior no se escribe
+void test_unchanged_snapshot_is_not_written(void) {
+    snapshot_t saved = TestSnapshot(12, 34);
+    snapshot_t restored;
+
+    SnapshotRestore(&restored);
+    SnapshotSave(&saved);
+    TEST_ASSERT_EQUAL_INT(1, SnapshotSave(&saved));
+    TEST_ASSERT_EQUAL_UINT32(1, writes);
+
+    // También se compara con la copia recuperada al reiniciar
+    SnapshotRestore(&restored);
+    TEST_ASSERT_EQUAL_INT(1, SnapshotSave(&saved));
+    TEST_ASSERT_EQUAL_UINT32(1, writes);
+}
+
+// 4-Después de dar varias vueltas al almacenamiento se recupera la copia más nueva
+void test_newest_snapshot_wins_after_wrapping(void) {
+    snapshot_t saved;
+    snapshot_t restored;
+
+    for (uint8_t minutes = 0; minutes < 3 * TEST_SLOTS + 3; minutes++) {
+        SnapshotRestore(&restored);
+        saved = TestSnapshot(8, minutes);
+        TEST_ASSERT_EQUAL_INT(0, SnapshotSave(&saved));
+
+        TEST_ASSERT_EQUAL_INT(0, SnapshotRestore(&restored));
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(saved.time, restored.time, sizeof(saved.time));
+    }
+}
+
+// 5-Si la copia más nueva está dañada se recupera la anterior
+void test_damaged_snapshot_falls_back_to_previous(void) {
+    snapshot_t first = TestSnapshot(9, 15);
+    snapshot_t second = TestSnapshot(9, 16);
+    snapshot_t restored;
+
+    SnapshotRestore(&restored);
+    SnapshotSave(&first);
+    SnapshotSave(&second);
+    // Un corte durante la escritura deja un byte de la hora sin programar
+    storage[sizeof(test_record_t) + 8] = 0xFF;
+
+    TEST_ASSERT_EQUAL_INT(0, SnapshotRestore(&restored));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(first.time, restored.time, sizeof(first.time));
+
+    // La próxima copia reemplaza a la dañada y es la que se recupera después
+    TEST_ASSERT_EQUAL_INT(0, SnapshotSave(&second));
+    TEST_ASSERT_EQUAL_INT(0, SnapshotRestore(&restored));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(second.time, restored.time, sizeof(second.time));
+}
+
+// 6-Las copias de otra versión del formato se ignoran y las nuevas siguen su secuencia
+void test_other_version_is_ignored(void) {
+    test_record_t record = {.sequence = 41, .version = SNAPSHOT_VERSION + 1, .flags = SNAPSHOT_TIME_VALID};
+    snapshot_t saved = TestSnapshot(6, 0);
+    snapshot_t restored;
+    uint32_t sequence;
+
+    record.crc = Crc16(CRC16_INITIAL, &record, sizeof(record));
+    memcpy(storage, &record, sizeof(record));
+
+    TEST_ASSERT_EQUAL_INT(-1, SnapshotRestore(&restored));
+    SnapshotSave(&saved);
+
+    memcpy(&sequence, &storage[sizeof(test_record_t)], sizeof(sequence));
+    TEST_ASSERT_EQUAL_UINT32(42, sequence);
+    TEST_ASSERT_EQUAL_INT(0, SnapshotRestore(&restored));
+}
+
+// 7-Al reiniciar solo se lee una cantidad de registros proporcional al logaritmo de la capacidad
+void test_restore_reads_logarithmic_number_of_records(void) {
+    snapshot_t saved;
+    snapshot_t restored;
+
+    SnapshotRestore(&restored);
+    for (uint8_t minutes = 0; minutes < TEST_SLOTS + 5; minutes++) {
+        saved = TestSnapshot(10, minutes);
+        SnapshotSave(&saved);
+    }
+
+    reads = 0;
+    TEST_ASSERT_EQUAL_INT(0, SnapshotRestore(&restored));
+    // La primera secuencia, tres pasos de la búsqueda binaria, la secuencia y el registro más nuevo
+    TEST_ASSERT_LESS_OR_EQUAL(6, reads);
+}
+
+/* === End of documentation ======================================================================================== */
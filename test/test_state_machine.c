@@ -0,0 +1,205 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_state_machine.c
+ ** @brief Código para testeo del despachador de máquinas de estado - Electrónica 4 2025
+ **/
+
+/**
+ * Pruebas a realizar
+- Al iniciar la máquina entra al estado inicial.
+- No se puede iniciar con un estado inexistente.
+- Un evento atendido ejecuta la acción y cambia de estado.
+- Un evento no atendido en el estado actual se ignora.
+- Una transición sin cambio de estado no vuelve a entrar al estado.
+- Una transición al mismo estado vuelve a entrar.
+- La acción puede elegir un estado distinto al de la tabla.
+- Cada evento atendido se registra con el estado anterior y el siguiente.
+ *
+ */
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "unity.h"
+
+#include "state_machine.h"
+#include "event_trace.h"
+#include <stddef.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+typedef enum {
+    STATE_IDLE,
+    STATE_RUNNING,
+    STATES_COUNT,
+} test_states_e;
+
+typedef enum {
+    EVENT_START,
+    EVENT_STOP,
+    EVENT_TICK,
+    EVENT_RESET,
+    EVENTS_COUNT,
+} test_events_e;
+
+/* === Private function declarations =============================================================================== */
+
+//! Acción que cuenta las veces que se ejecuta
+static uint8_t CountAction(uint8_t next);
+
+//! Acción que siempre vuelve al estado inactivo
+static uint8_t ResetAction(uint8_t next);
+
+//! Función de entrada que memoriza el último estado al que se entró
+static void Enter(uint8_t state);
+
+/* === Private variable definitions ================================================================================ */
+
+static const state_transition_t TRANSITIONS[STATES_COUNT][EVENTS_COUNT] = {
+    [STATE_IDLE] =
+        {
+            [EVENT_START] = STATE_TRANSITION(CountAction, STATE_RUNNING),
+        },
+    [STATE_RUNNING] =
+        {
+            [EVENT_STOP] = STATE_TRANSITION(NULL, STATE_IDLE),
+            [EVENT_TICK] = STATE_TRANSITION(CountAction, STATE_MACHINE_NO_CHANGE),
+            [EVENT_START] = STATE_TRANSITION(NULL, STATE_RUNNING),
+            [EVENT_RESET] = STATE_TRANSITION(ResetAction, STATE_RUNNING),
+        },
+};
+
+static const state_machine_table_t TABLE = {
+    .transitions = &TRANSITIONS[0][0],
+    .states = STATES_COUNT,
+    .events = EVENTS_COUNT,
+    .Enter = Enter,
+};
+
+static state_machine_t machine;
+static int actions;
+static int entries;
+static uint8_t last_entered;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static uint8_t CountAction(uint8_t next) {
+    actions++;
+    return next;
+}
+
+static uint8_t ResetAction(uint8_t next) {
+    (void)next;
+    return STATE_IDLE;
+}
+
+static void Enter(uint8_t state) {
+    entries++;
+    last_entered = state;
+}
+
+void setUp(void) {
+    actions = 0;
+    StateMachineInit(&machine, &TABLE, STATE_IDLE);
+    entries = 0;
+}
+
+/* === Public function definitions ================================================================================= */
+
+// 1-Al iniciar la máquina entra al estado inicial
+void test_init_enters_initial_state(void) {
+    entries = 0;
+    TEST_ASSERT_EQUAL_INT(0, StateMachineInit(&machine, &TABLE, STATE_RUNNING));
+    TEST_ASSERT_EQUAL_UINT8(STATE_RUNNING, StateMachineGetState(&machine));
+    TEST_ASSERT_EQUAL_INT(1, entries);
+    TEST_ASSERT_EQUAL_UINT8(STATE_RUNNING, last_entered);
+}
+
+// 2-No se puede iniciar con un estado inexistente
+void test_init_with_invalid_state(void) {
+    TEST_ASSERT_EQUAL_INT(-1, StateMachineInit(&machine, &TABLE, STATES_COUNT));
+    TEST_ASSERT_EQUAL_INT(-1, StateMachineInit(&machine, NULL, STATE_IDLE));
+}
+
+// 3-Un evento atendido ejecuta la acción y cambia de estado
+void test_handled_event_runs_action_and_changes_state(void) {
+    TEST_ASSERT_TRUE(StateMachineDispatch(&machine, EVENT_START));
+    TEST_ASSERT_EQUAL_INT(1, actions);
+    TEST_ASSERT_EQUAL_UINT8(STATE_RUNNING, StateMachineGetState(&machine));
+    TEST_ASSERT_EQUAL_INT(1, entries);
+}
+
+// 4-Un evento no atendido en el estado actual se ignora
+void test_unhandled_event_is_ignored(void) {
+    TEST_ASSERT_FALSE(StateMachineDispatch(&machine, EVENT_STOP));
+    TEST_ASSERT_FALSE(StateMachineDispatch(&machine, EVENTS_COUNT));
+    TEST_ASSERT_EQUAL_UINT8(STATE_IDLE, StateMachineGetState(&machine));
+    TEST_ASSERT_EQUAL_INT(0, entries);
+}
+
+// 5-Una transición sin cambio de estado no vuelve a entrar al estado
+void test_no_change_transition_does_not_enter(void) {
+    StateMachineDispatch(&machine, EVENT_START);
+    entries = 0;
+
+    TEST_ASSERT_TRUE(StateMachineDispatch(&machine, EVENT_TICK));
+    TEST_ASSERT_EQUAL_INT(2, actions);
+    TEST_ASSERT_EQUAL_INT(0, entries);
+    TEST_ASSERT_EQUAL_UINT8(STATE_RUNNING, StateMachineGetState(&machine));
+}
+
+// 6-Una transición al mismo estado vuelve a entrar
+void test_self_transition_enters_again(void) {
+    StateMachineDispatch(&machine, EVENT_START);
+    entries = 0;
+
+    TEST_ASSERT_TRUE(StateMachineDispatch(&machine, EVENT_START));
+    TEST_ASSERT_EQUAL_INT(1, entries);
+    TEST_ASSERT_EQUAL_UINT8(STATE_RUNNING, last_entered);
+}
+
+// 7-La acción puede elegir un estado distinto al de la tabla
+void test_action_overrides_next_state(void) {
+    StateMachineDispatch(&machine, EVENT_START);
+
+    TEST_ASSERT_TRUE(StateMachineDispatch(&machine, EVENT_RESET));
+    TEST_ASSERT_EQUAL_UINT8(STATE_IDLE, StateMachineGetState(&machine));
+}
+
+// 8-Cada evento atendido se registra con el estado anterior y el siguiente
+void test_handled_events_are_traced(void) {
+    uint32_t cursor = EventTraceCount();
+    uint32_t sequence;
+    event_trace_record_t record;
+
+    StateMachineDispatch(&machine, EVENT_STOP);
+    StateMachineDispatch(&machine, EVENT_START);
+
+    TEST_ASSERT_EQUAL_INT(0, EventTraceRead(&cursor, &sequence, &record));
+    TEST_ASSERT_EQUAL_UINT8(EVENT_TRACE_STATE_CHANGED, record.event);
+    TEST_ASSERT_EQUAL_UINT8(EVENT_START, record.detail);
+    TEST_ASSERT_EQUAL_UINT16(STATE_IDLE << 8 | STATE_RUNNING, record.value);
+    TEST_ASSERT_EQUAL_INT(-1, EventTraceRead(&cursor, &sequence, &record));
+}
+
+/* === End of documentation ======================================================================================== */
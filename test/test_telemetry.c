@@ -0,0 +1,166 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file test_telemetry.c
+ ** @brief Código para testeo de las tramas binarias de telemetría - Electrónica 4 2025
+ **/
+
+/**
+ * Pruebas a realizar
+- Una trama empieza y termina con un byte en cero y no tiene otros ceros.
+- Una trama se decodifica con el mismo tipo, secuencia y contenido, también si el contenido tiene ceros.
+- Un contenido sin ceros más largo que un bloque COBS se decodifica igual.
+- Un contenido más grande que el máximo no se codifica.
+- Una trama con un byte cambiado o recortada no se decodifica.
+- El texto de la consola entre dos tramas no se decodifica.
+- Una estructura de estado se recupera igual a la enviada.
+ *
+ */
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "unity.h"
+
+#include "telemetry.h"
+#include "crc.h"
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+//! Trama codificada
+static uint8_t encoded[TELEMETRY_MAX_FRAME];
+
+//! Trama decodificada
+static telemetry_frame_t decoded;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+/**
+ * @brief Decodifica una trama codificada, sin los bytes en cero de los extremos
+ *
+ */
+static int Decode(size_t length) {
+    return TelemetryDecode(&encoded[1], length - 2, &decoded);
+}
+
+/* === Public function definitions ================================================================================= */
+
+// 1-Una trama empieza y termina con un byte en cero y no tiene otros ceros
+void test_frame_delimiters(void) {
+    static const uint8_t payload[] = {0, 1, 0, 0, 2, 0};
+    size_t length = TelemetryEncode(TELEMETRY_STATUS, 7, payload, sizeof(payload), encoded);
+
+    TEST_ASSERT_TRUE(length > 2);
+    TEST_ASSERT_TRUE(length <= TELEMETRY_FRAME_SIZE(sizeof(payload)));
+    TEST_ASSERT_EQUAL_UINT8(0, encoded[0]);
+    TEST_ASSERT_EQUAL_UINT8(0, encoded[length - 1]);
+    TEST_ASSERT_NULL(memchr(&encoded[1], 0, length - 2));
+}
+
+// 2-Una trama se decodifica con el mismo tipo, secuencia y contenido, también si el contenido tiene ceros
+void test_round_trip(void) {
+    static const uint8_t payload[] = {0, 1, 0, 0, 2, 0};
+    size_t length = TelemetryEncode(TELEMETRY_REGION, 200, payload, sizeof(payload), encoded);
+
+    TEST_ASSERT_EQUAL_INT(0, Decode(length));
+    TEST_ASSERT_EQUAL_UINT8(TELEMETRY_REGION, decoded.type);
+    TEST_ASSERT_EQUAL_UINT8(200, decoded.sequence);
+    TEST_ASSERT_EQUAL_UINT16(sizeof(payload), decoded.size);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(payload, decoded.payload.bytes, sizeof(payload));
+
+    length = TelemetryEncode(TELEMETRY_EVENTS, 0, NULL, 0, encoded);
+    TEST_ASSERT_EQUAL_INT(0, Decode(length));
+    TEST_ASSERT_EQUAL_UINT16(0, decoded.size);
+}
+
+// 3-Un contenido sin ceros más largo que un bloque COBS se decodifica igual
+void test_long_block(void) {
+    uint8_t payload[TELEMETRY_MAX_PAYLOAD];
+    size_t length;
+
+    memset(payload, 0xA5, sizeof(payload));
+    payload[100] = 0;
+    length = TelemetryEncode(TELEMETRY_STATUS, 1, payload, sizeof(payload), encoded);
+    TEST_ASSERT_TRUE(length <= TELEMETRY_MAX_FRAME);
+    TEST_ASSERT_EQUAL_INT(0, Decode(length));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(payload, decoded.payload.bytes, sizeof(payload));
+
+    memset(payload, 0xA5, sizeof(payload));
+    length = TelemetryEncode(0xA5, 0xA5, payload, sizeof(payload), encoded);
+    TEST_ASSERT_TRUE(length <= TELEMETRY_MAX_FRAME);
+    TEST_ASSERT_NULL(memchr(&encoded[1], 0, length - 2));
+    TEST_ASSERT_EQUAL_INT(0, Decode(length));
+    TEST_ASSERT_EQUAL_UINT16(sizeof(payload), decoded.size);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(payload, decoded.payload.bytes, sizeof(payload));
+}
+
+// 4-Un contenido más grande que el máximo no se codifica
+void test_payload_too_large(void) {
+    static uint8_t payload[TELEMETRY_MAX_PAYLOAD + 1];
+
+    TEST_ASSERT_EQUAL_size_t(0, TelemetryEncode(TELEMETRY_STATUS, 0, payload, sizeof(payload), encoded));
+}
+
+// 5-Una trama con un byte cambiado o recortada no se decodifica
+void test_corrupted_frame(void) {
+    static const uint8_t payload[] = {10, 20, 30, 40};
+    size_t length = TelemetryEncode(TELEMETRY_STATUS, 3, payload, sizeof(payload), encoded);
+
+    encoded[4] ^= 0x01;
+    TEST_ASSERT_EQUAL_INT(-1, Decode(length));
+    encoded[4] ^= 0x01;
+    TEST_ASSERT_EQUAL_INT(-1, Decode(length - 1));
+    TEST_ASSERT_EQUAL_INT(0, Decode(length));
+}
+
+// 6-El texto de la consola entre dos tramas no se decodifica
+void test_text_is_ignored(void) {
+    static const char text[] = "ok\r\n12:30:00\r\n";
+
+    TEST_ASSERT_EQUAL_INT(-1, TelemetryDecode((const uint8_t *)text, strlen(text), &decoded));
+    TEST_ASSERT_EQUAL_INT(-1, TelemetryDecode((const uint8_t *)"\x03", 1, &decoded));
+}
+
+// 7-Una estructura de estado se recupera igual a la enviada
+void test_status_structure(void) {
+    telemetry_status_t status = {.uptime = 86400, .tick_drift = -25, .tick_period = 204000, .alarm_rings = 3};
+    telemetry_status_t received;
+    size_t length;
+
+    status.buttons[4] = 12;
+    length = TelemetryEncode(TELEMETRY_STATUS, 9, &status, sizeof(status), encoded);
+    TEST_ASSERT_EQUAL_INT(0, Decode(length));
+    TEST_ASSERT_EQUAL_UINT16(sizeof(status), decoded.size);
+    memcpy(&received, decoded.payload.bytes, sizeof(received));
+    TEST_ASSERT_EQUAL_INT32(-25, received.tick_drift);
+    TEST_ASSERT_EQUAL_UINT32(86400, received.uptime);
+    TEST_ASSERT_EQUAL_UINT32(12, received.buttons[4]);
+    TEST_ASSERT_EQUAL_MEMORY(&status, &received, sizeof(status));
+}
+
+/* === End of documentation ======================================================================================== */
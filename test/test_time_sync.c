@@ -0,0 +1,129 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file test_time_sync.c
+ ** @brief Código para testeo de la sincronización de la hora con un servidor - Electrónica 4 2025
+ **/
+
+/**
+ * Pruebas a realizar
+- Con demoras iguales de ida y vuelta se obtiene el desplazamiento exacto y la demora sin la del servidor.
+- Con demoras distintas el error del desplazamiento es como máximo la mitad de la demora.
+- Una respuesta con otro número o repetida se descarta.
+- Una respuesta con una demora mayor al máximo o negativa se descarta.
+ *
+ */
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "unity.h"
+
+#include "time_sync.h"
+
+/* === Macros definitions ========================================================================================== */
+
+//! Hora del reloj de la placa al enviar el pedido, el 19 de octubre de 2026 a las 12:00:00 UTC
+#define T1 (20745LL * 86400000LL + 43200000LL)
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+//! Estado de la sincronización
+static time_sync_t sync;
+
+//! Resultado del último intercambio
+static time_sync_sample_t sample;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+void setUp(void) {
+    TimeSyncInit(&sync);
+}
+
+/* === Public function definitions ================================================================================= */
+
+// 1-Con demoras iguales de ida y vuelta se obtiene el desplazamiento exacto y la demora sin la del servidor
+void test_symmetric_exchange(void) {
+    uint8_t sequence = TimeSyncRequest(&sync, T1);
+
+    // El servidor está 5 s adelantado, cada viaje tarda 40 ms y el servidor demora 20 ms en responder
+    TEST_ASSERT_EQUAL_INT(0, TimeSyncResponse(&sync, sequence, T1 + 5040, 20, T1 + 100, &sample));
+    TEST_ASSERT_EQUAL_INT64(5000, sample.offset);
+    TEST_ASSERT_EQUAL_INT64(80, sample.delay);
+    TEST_ASSERT_EQUAL_UINT32(1, sync.accepted);
+    TEST_ASSERT_EQUAL_INT64(5000, sync.last.offset);
+
+    sequence = TimeSyncRequest(&sync, T1 + 1000);
+    TEST_ASSERT_EQUAL_INT(0, TimeSyncResponse(&sync, sequence, T1 + 1000 - 3000 + 10, 0, T1 + 1020, &sample));
+    TEST_ASSERT_EQUAL_INT64(-3000, sample.offset);
+}
+
+// 2-Con demoras distintas el error del desplazamiento es como máximo la mitad de la demora
+void test_asymmetric_exchange(void) {
+    uint8_t sequence = TimeSyncRequest(&sync, T1);
+
+    // La ida tarda 90 ms y la vuelta 10 ms, con los relojes iguales
+    TEST_ASSERT_EQUAL_INT(0, TimeSyncResponse(&sync, sequence, T1 + 90, 0, T1 + 100, &sample));
+    TEST_ASSERT_EQUAL_INT64(100, sample.delay);
+    TEST_ASSERT_EQUAL_INT64(40, sample.offset);
+    TEST_ASSERT_TRUE(sample.offset <= sample.delay / 2);
+}
+
+// 3-Una respuesta con otro número o repetida se descarta
+void test_unexpected_response(void) {
+    uint8_t sequence;
+
+    TEST_ASSERT_EQUAL_INT(-1, TimeSyncResponse(&sync, 0, T1, 0, T1, &sample));
+
+    sequence = TimeSyncRequest(&sync, T1);
+    TEST_ASSERT_EQUAL_INT(-1, TimeSyncResponse(&sync, sequence + 1, T1, 0, T1 + 10, &sample));
+    TEST_ASSERT_EQUAL_INT(0, TimeSyncResponse(&sync, sequence, T1 + 5, 0, T1 + 10, &sample));
+    TEST_ASSERT_EQUAL_INT(-1, TimeSyncResponse(&sync, sequence, T1 + 5, 0, T1 + 10, &sample));
+
+    // Un pedido nuevo reemplaza al anterior sin respuesta
+    TimeSyncRequest(&sync, T1 + 100);
+    sequence = TimeSyncRequest(&sync, T1 + 200);
+    TEST_ASSERT_EQUAL_INT(-1, TimeSyncResponse(&sync, sequence - 1, T1 + 105, 0, T1 + 210, &sample));
+    TEST_ASSERT_EQUAL_UINT32(3, sync.requests);
+    TEST_ASSERT_EQUAL_UINT32(1, sync.accepted);
+    TEST_ASSERT_EQUAL_UINT32(4, sync.rejected);
+}
+
+// 4-Una respuesta con una demora mayor al máximo o negativa se descarta
+void test_delay_limits(void) {
+    uint8_t sequence = TimeSyncRequest(&sync, T1);
+
+    TEST_ASSERT_EQUAL_INT(-2, TimeSyncResponse(&sync, sequence, T1, 0, T1 + TIME_SYNC_MAX_DELAY + 1, &sample));
+    TEST_ASSERT_EQUAL_INT64(TIME_SYNC_MAX_DELAY + 1, sample.delay);
+
+    sequence = TimeSyncRequest(&sync, T1);
+    TEST_ASSERT_EQUAL_INT(-2, TimeSyncResponse(&sync, sequence, T1, 50, T1 + 20, &sample));
+
+    sequence = TimeSyncRequest(&sync, T1);
+    TEST_ASSERT_EQUAL_INT(0, TimeSyncResponse(&sync, sequence, T1, 0, T1 + TIME_SYNC_MAX_DELAY, &sample));
+    TEST_ASSERT_EQUAL_UINT32(2, sync.rejected);
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,223 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file test_timers.c
+ ** @brief Código para testeo de los cronómetros y temporizadores - Electrónica 4 2025
+ **/
+
+/**
+ * Pruebas a realizar
+- Un cronómetro nuevo está detenido y en cero.
+- Un cronómetro andando mide el tiempo de la base, detenido lo conserva y al arrancarlo de nuevo suma.
+- Las vueltas devuelven el tiempo desde la vuelta anterior y el parcial sigue contando.
+- Un temporizador llama a su función al terminar, una sola vez.
+- Un temporizador detenido no termina y al seguir usa el tiempo que le faltaba.
+- Muchos temporizadores terminan en orden y uno puede volver a arrancar desde su función.
+- No se pueden tomar más cronómetros ni temporizadores que los del pool y al devolverlos se pueden volver a tomar.
+ *
+ */
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "unity.h"
+
+#include "timers.h"
+#include <stddef.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+//! Veces que terminó cada temporizador de las pruebas
+static uint32_t expirations[TIMERS_COUNTDOWNS];
+
+//! Base de tiempo cuando terminó cada temporizador de las pruebas
+static uint32_t expired_at[TIMERS_COUNTDOWNS];
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void Expired(countdown_p countdown, void * context) {
+    uint32_t index = *(const uint32_t *)context;
+
+    (void)countdown;
+    expirations[index]++;
+    expired_at[index] = TimersNow();
+}
+
+static void Repeat(countdown_p countdown, void * context) {
+    Expired(countdown, context);
+    CountdownStart(countdown, 100);
+}
+
+static void SimulateMilliseconds(uint32_t milliseconds) {
+    for (uint32_t i = 0; i < milliseconds; i++) {
+        TimersTick(1);
+    }
+}
+
+void setUp(void) {
+    TimersInit();
+    for (uint32_t i = 0; i < TIMERS_COUNTDOWNS; i++) {
+        expirations[i] = 0;
+        expired_at[i] = 0;
+    }
+}
+
+/* === Public function definitions ================================================================================= */
+
+// 1-Un cronómetro nuevo está detenido y en cero
+void test_new_stopwatch(void) {
+    stopwatch_p stopwatch = StopwatchCreate();
+
+    TEST_ASSERT_NOT_NULL(stopwatch);
+    TEST_ASSERT_FALSE(StopwatchIsRunning(stopwatch));
+    SimulateMilliseconds(10);
+    TEST_ASSERT_EQUAL_UINT32(0, StopwatchElapsed(stopwatch));
+}
+
+// 2-Un cronómetro andando mide el tiempo de la base, detenido lo conserva y al arrancarlo de nuevo suma
+void test_stopwatch_start_stop(void) {
+    stopwatch_p stopwatch = StopwatchCreate();
+
+    StopwatchStart(stopwatch);
+    SimulateMilliseconds(250);
+    TEST_ASSERT_EQUAL_UINT32(250, StopwatchElapsed(stopwatch));
+
+    StopwatchStop(stopwatch);
+    SimulateMilliseconds(100);
+    TEST_ASSERT_EQUAL_UINT32(250, StopwatchElapsed(stopwatch));
+
+    StopwatchStart(stopwatch);
+    TimersTick(40);
+    TEST_ASSERT_TRUE(StopwatchIsRunning(stopwatch));
+    TEST_ASSERT_EQUAL_UINT32(290, StopwatchElapsed(stopwatch));
+
+    StopwatchReset(stopwatch);
+    TimersTick(5);
+    TEST_ASSERT_EQUAL_UINT32(5, StopwatchElapsed(stopwatch));
+}
+
+// 3-Las vueltas devuelven el tiempo desde la vuelta anterior y el parcial sigue contando
+void test_stopwatch_laps(void) {
+    stopwatch_p stopwatch = StopwatchCreate();
+
+    StopwatchStart(stopwatch);
+    SimulateMilliseconds(1200);
+    TEST_ASSERT_EQUAL_UINT32(1200, StopwatchLap(stopwatch));
+    SimulateMilliseconds(800);
+    TEST_ASSERT_EQUAL_UINT32(800, StopwatchLap(stopwatch));
+    TEST_ASSERT_EQUAL_UINT32(2000, StopwatchElapsed(stopwatch));
+    TEST_ASSERT_EQUAL_UINT32(0, StopwatchLap(stopwatch));
+}
+
+// 4-Un temporizador llama a su función al terminar, una sola vez
+void test_countdown_expires_once(void) {
+    static const uint32_t id = 0;
+    countdown_p countdown = CountdownCreate(Expired, (void *)&id);
+
+    TEST_ASSERT_EQUAL_INT(-1, CountdownStart(countdown, 0));
+    TEST_ASSERT_EQUAL_INT(0, CountdownStart(countdown, 500));
+    SimulateMilliseconds(499);
+    TEST_ASSERT_EQUAL_UINT32(0, expirations[0]);
+    TEST_ASSERT_EQUAL_UINT32(1, CountdownRemaining(countdown));
+
+    SimulateMilliseconds(1);
+    TEST_ASSERT_EQUAL_UINT32(1, expirations[0]);
+    TEST_ASSERT_FALSE(CountdownIsRunning(countdown));
+    TEST_ASSERT_EQUAL_UINT32(0, CountdownRemaining(countdown));
+
+    SimulateMilliseconds(1000);
+    TEST_ASSERT_EQUAL_UINT32(1, expirations[0]);
+}
+
+// 5-Un temporizador detenido no termina y al seguir usa el tiempo que le faltaba
+void test_countdown_stop_and_resume(void) {
+    static const uint32_t id = 0;
+    countdown_p countdown = CountdownCreate(Expired, (void *)&id);
+
+    CountdownStart(countdown, 300);
+    SimulateMilliseconds(100);
+    CountdownStop(countdown);
+    SimulateMilliseconds(1000);
+    TEST_ASSERT_EQUAL_UINT32(0, expirations[0]);
+    TEST_ASSERT_EQUAL_UINT32(200, CountdownRemaining(countdown));
+
+    CountdownResume(countdown);
+    SimulateMilliseconds(200);
+    TEST_ASSERT_EQUAL_UINT32(1, expirations[0]);
+    TEST_ASSERT_EQUAL_UINT32(1300, expired_at[0]);
+}
+
+// 6-Muchos temporizadores terminan en orden y uno puede volver a arrancar desde su función
+void test_many_countdowns(void) {
+    static const uint32_t ids[TIMERS_COUNTDOWNS] = {0, 1, 2, 3};
+    countdown_p countdowns[TIMERS_COUNTDOWNS];
+
+    for (uint32_t i = 0; i < TIMERS_COUNTDOWNS; i++) {
+        countdowns[i] = CountdownCreate((i == 0) ? Repeat : Expired, (void *)&ids[i]);
+        CountdownStart(countdowns[i], 1000 - 200 * i);
+    }
+
+    // Varios terminan en el mismo tick y se atienden en una sola pasada
+    TimersTick(650);
+    TEST_ASSERT_EQUAL_UINT32(0, expirations[0]);
+    TEST_ASSERT_EQUAL_UINT32(0, expirations[1]);
+    TEST_ASSERT_EQUAL_UINT32(1, expirations[2]);
+    TEST_ASSERT_EQUAL_UINT32(1, expirations[3]);
+
+    SimulateMilliseconds(500);
+    TEST_ASSERT_EQUAL_UINT32(1, expirations[1]);
+    TEST_ASSERT_EQUAL_UINT32(800, expired_at[1]);
+    TEST_ASSERT_EQUAL_UINT32(2, expirations[0]);
+    TEST_ASSERT_EQUAL_UINT32(1100, expired_at[0]);
+    TEST_ASSERT_TRUE(CountdownIsRunning(countdowns[0]));
+}
+
+// 7-No se pueden tomar más cronómetros ni temporizadores que los del pool y al devolverlos se pueden volver a tomar
+void test_pool_exhaustion(void) {
+    stopwatch_p stopwatches[TIMERS_STOPWATCHES];
+    countdown_p countdowns[TIMERS_COUNTDOWNS];
+
+    for (uint32_t i = 0; i < TIMERS_STOPWATCHES; i++) {
+        stopwatches[i] = StopwatchCreate();
+        TEST_ASSERT_NOT_NULL(stopwatches[i]);
+    }
+    TEST_ASSERT_NULL(StopwatchCreate());
+    StopwatchDestroy(stopwatches[1]);
+    TEST_ASSERT_TRUE(StopwatchCreate() == stopwatches[1]);
+
+    for (uint32_t i = 0; i < TIMERS_COUNTDOWNS; i++) {
+        countdowns[i] = CountdownCreate(NULL, NULL);
+        TEST_ASSERT_NOT_NULL(countdowns[i]);
+    }
+    TEST_ASSERT_NULL(CountdownCreate(NULL, NULL));
+    CountdownStart(countdowns[2], 10);
+    CountdownDestroy(countdowns[2]);
+    SimulateMilliseconds(20);
+    TEST_ASSERT_TRUE(CountdownCreate(NULL, NULL) == countdowns[2]);
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,157 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file test_timezone.c
+ ** @brief Código para testeo de las zonas horarias con horario de verano - Electrónica 4 2025
+ **/
+
+/**
+ * Pruebas a realizar
+- Una zona sin horario de verano tiene siempre el mismo desplazamiento y ningún cambio.
+- El desplazamiento se escribe al revés que la hora local y admite minutos y nombres entre < y >.
+- Se rechazan las zonas mal escritas.
+- Las reglas de Europa central generan los cambios de los últimos domingos de marzo y octubre.
+- Si no se indican las reglas se usan las de EE.UU. y el horario de verano es una hora más.
+- En el hemisferio sur el año empieza con horario de verano y la tabla queda ordenada.
+- Las reglas Jn no cuentan el 29 de febrero y las reglas n sí.
+- Después del último cambio se indica el fin de la tabla como próximo cambio.
+ *
+ */
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "unity.h"
+
+#include "timezone.h"
+#include "calendar.h"
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+static timezone_t zone;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+/* === Public function definitions ================================================================================= */
+
+// 1-Una zona sin horario de verano tiene siempre el mismo desplazamiento y ningún cambio
+void test_zone_without_daylight_saving(void) {
+    int64_t next;
+
+    TEST_ASSERT_EQUAL_INT(0, TimezoneParse(&zone, "ART3"));
+    TimezoneCompile(&zone, 2026);
+    TEST_ASSERT_EQUAL_UINT8(0, zone.count);
+    TEST_ASSERT_EQUAL_INT32(-3 * 3600, TimezoneLookup(&zone, 1790000000LL, &next));
+    TEST_ASSERT_EQUAL_INT64(TIMEZONE_NEVER, next);
+}
+
+// 2-El desplazamiento se escribe al revés que la hora local y admite minutos y nombres entre < y >
+void test_offset_sign_minutes_and_quoted_names(void) {
+    TEST_ASSERT_EQUAL_INT(0, TimezoneParse(&zone, "<+0530>-5:30"));
+    TEST_ASSERT_EQUAL_INT32(5 * 3600 + 30 * 60, zone.standard);
+    TEST_ASSERT_EQUAL_INT(0, TimezoneParse(&zone, "<-03>+3"));
+    TEST_ASSERT_EQUAL_INT32(-3 * 3600, zone.standard);
+}
+
+// 3-Se rechazan las zonas mal escritas
+void test_invalid_zones(void) {
+    TEST_ASSERT_EQUAL_INT(-1, TimezoneParse(&zone, NULL));
+    TEST_ASSERT_EQUAL_INT(-1, TimezoneParse(&zone, ""));
+    TEST_ASSERT_EQUAL_INT(-1, TimezoneParse(&zone, "AR3"));
+    TEST_ASSERT_EQUAL_INT(-1, TimezoneParse(&zone, "ART"));
+    TEST_ASSERT_EQUAL_INT(-1, TimezoneParse(&zone, "<-03"));
+    TEST_ASSERT_EQUAL_INT(-1, TimezoneParse(&zone, "CET-1CEST,M3.5.0"));
+    TEST_ASSERT_EQUAL_INT(-1, TimezoneParse(&zone, "CET-1CEST,M13.5.0,M10.5.0"));
+    TEST_ASSERT_EQUAL_INT(-1, TimezoneParse(&zone, "CET-1CEST,M3.5.0,M10.5.0/3x"));
+}
+
+// 4-Las reglas de Europa central generan los cambios de los últimos domingos de marzo y octubre
+void test_central_european_rules(void) {
+    int64_t next;
+
+    TEST_ASSERT_EQUAL_INT(0, TimezoneParse(&zone, "CET-1CEST,M3.5.0,M10.5.0/3"));
+    TimezoneCompile(&zone, 2026);
+    TEST_ASSERT_EQUAL_UINT8(4, zone.count);
+    TEST_ASSERT_EQUAL_INT64(1774746000LL, zone.transitions[0].at);
+    TEST_ASSERT_EQUAL_INT64(1792890000LL, zone.transitions[1].at);
+    TEST_ASSERT_EQUAL_INT64(1806195600LL, zone.transitions[2].at);
+    TEST_ASSERT_EQUAL_INT64(1824944400LL, zone.transitions[3].at);
+
+    TEST_ASSERT_EQUAL_INT32(3600, TimezoneLookup(&zone, 1774745999LL, &next));
+    TEST_ASSERT_EQUAL_INT64(1774746000LL, next);
+    TEST_ASSERT_EQUAL_INT32(7200, TimezoneLookup(&zone, 1774746000LL, &next));
+    TEST_ASSERT_EQUAL_INT64(1792890000LL, next);
+    TEST_ASSERT_EQUAL_INT32(3600, TimezoneLookup(&zone, 1792890000LL, &next));
+}
+
+// 5-Si no se indican las reglas se usan las de EE.UU. y el horario de verano es una hora más
+void test_default_rules(void) {
+    TEST_ASSERT_EQUAL_INT(0, TimezoneParse(&zone, "EST5EDT"));
+    TimezoneCompile(&zone, 2026);
+    TEST_ASSERT_EQUAL_INT32(-4 * 3600, zone.daylight);
+    TEST_ASSERT_EQUAL_INT64(1772953200LL, zone.transitions[0].at);
+    TEST_ASSERT_EQUAL_INT32(-4 * 3600, zone.transitions[0].offset);
+    TEST_ASSERT_EQUAL_INT64(1793512800LL, zone.transitions[1].at);
+    TEST_ASSERT_EQUAL_INT32(-5 * 3600, zone.transitions[1].offset);
+}
+
+// 6-En el hemisferio sur el año empieza con horario de verano y la tabla queda ordenada
+void test_southern_hemisphere_rules(void) {
+    int64_t next;
+
+    TEST_ASSERT_EQUAL_INT(0, TimezoneParse(&zone, "AEST-10AEDT,M10.1.0,M4.1.0/3"));
+    TimezoneCompile(&zone, 2026);
+    TEST_ASSERT_EQUAL_INT64(1775318400LL, zone.transitions[0].at);
+    TEST_ASSERT_EQUAL_INT32(10 * 3600, zone.transitions[0].offset);
+    TEST_ASSERT_EQUAL_INT64(1791043200LL, zone.transitions[1].at);
+    TEST_ASSERT_EQUAL_INT32(11 * 3600, zone.transitions[1].offset);
+
+    // El 1 de enero de 2026 rige el horario de verano que empezó en octubre de 2025
+    TEST_ASSERT_EQUAL_INT32(11 * 3600, TimezoneLookup(&zone, 1767225600LL, &next));
+    TEST_ASSERT_EQUAL_INT64(1775318400LL, next);
+}
+
+// 7-Las reglas Jn no cuentan el 29 de febrero y las reglas n sí
+void test_julian_and_day_of_year_rules(void) {
+    TEST_ASSERT_EQUAL_INT(0, TimezoneParse(&zone, "XXX0YYY,J60/0,59/0"));
+    TimezoneCompile(&zone, 2024);
+    // J60 es el 1 de marzo y 59 es el 29 de febrero en 2024
+    TEST_ASSERT_EQUAL_INT64(1709164800LL - 3600LL, zone.transitions[0].at);
+    TEST_ASSERT_EQUAL_INT64(1709251200LL, zone.transitions[1].at);
+}
+
+// 8-Después del último cambio se indica el fin de la tabla como próximo cambio
+void test_next_after_table_is_its_end(void) {
+    int64_t next;
+
+    TimezoneParse(&zone, "CET-1CEST,M3.5.0,M10.5.0/3");
+    TimezoneCompile(&zone, 2026);
+    TEST_ASSERT_EQUAL_INT32(3600, TimezoneLookup(&zone, 1830000000LL, &next));
+    TEST_ASSERT_EQUAL_INT64(1830297600LL, next);
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,196 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Elías Ganem <eliasgfac@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file test_world_clock.c
+ ** @brief Código para testeo de las vistas de la hora de otras zonas - Electrónica 4 2025
+ **/
+
+/**
+ * Pruebas a realizar
+- Una vista muestra la hora y la fecha UTC del reloj principal más su desplazamiento.
+- Las vistas siguen al reloj principal sin que el tick las actualice.
+- La fecha de una vista cambia en su propia medianoche, no en la del reloj principal.
+- Antes de poner en hora el reloj principal la vista indica que la hora no es válida, también antes de 1970.
+- Cambiar el desplazamiento cambia la hora de la vista y no se aceptan desplazamientos de un día o más.
+- No se pueden tomar más vistas que las del pool y al devolverlas se pueden volver a tomar.
+ *
+ */
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "unity.h"
+
+#include "world_clock.h"
+#include "calendar.h"
+#include "clock.h"
+#include "event_trace.h"
+#include "timezone.h"
+#include <stddef.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! Frecuencia del reloj principal de las pruebas
+#define TICKS_PER_SECOND 5
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+static void AlarmNothing(void);
+
+/* === Private variable definitions ================================================================================ */
+
+static const struct clock_alarm_driver_s alarm_driver = {
+    .TurnOnAlarm = AlarmNothing,
+    .TurnOffAlarm = AlarmNothing,
+};
+
+//! Reloj principal de las pruebas, en hora el 10 de marzo de 2025 a las 23:30:00 UTC
+static clock_p clock;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void AlarmNothing(void) {
+}
+
+static void SimulateSeconds(uint32_t seconds) {
+    for (uint32_t i = 0; i < seconds * TICKS_PER_SECOND; i++) {
+        ClockNewTick(clock);
+    }
+}
+
+void setUp(void) {
+    static const clock_time_u time = {.time = {.hours = {3, 2}, .minutes = {0, 3}, .seconds = {0, 0}}};
+    static const calendar_date_t date = {.year = 2025, .month = 3, .day = 10};
+
+    WorldClockInit();
+    clock = ClockCreate(TICKS_PER_SECOND, &alarm_driver, 300);
+    ClockSetDate(clock, &date);
+    ClockSetTime(clock, &time);
+}
+
+/* === Public function definitions ================================================================================= */
+
+// 1-Una vista muestra la hora y la fecha UTC del reloj principal más su desplazamiento
+void test_view_shows_offset_time(void) {
+    static const uint8_t expected[] = {0, 0, 0, 3, 8, 0};
+    world_clock_p view = WorldClockCreate(clock, 9 * 3600);
+    clock_time_u time;
+    calendar_date_t date;
+
+    TEST_ASSERT_NOT_NULL(view);
+    TEST_ASSERT_EQUAL_INT(1, WorldClockGetTime(view, &time));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, time.bcd, sizeof(expected));
+    TEST_ASSERT_EQUAL_INT(1, WorldClockGetDate(view, &date));
+    TEST_ASSERT_EQUAL_INT16(2025, date.year);
+    TEST_ASSERT_EQUAL_UINT8(3, date.month);
+    TEST_ASSERT_EQUAL_UINT8(11, date.day);
+    TEST_ASSERT_EQUAL_UINT8(CALENDAR_TUESDAY, date.weekday);
+}
+
+// 2-Las vistas siguen al reloj principal sin que el tick las actualice
+void test_views_follow_master(void) {
+    static const uint8_t tokyo[] = {5, 4, 1, 3, 8, 0};
+    static const uint8_t buenos_aires[] = {5, 4, 1, 3, 0, 2};
+    world_clock_p east = WorldClockCreate(clock, 9 * 3600);
+    world_clock_p west = WorldClockCreate(clock, -3 * 3600);
+    clock_time_u time;
+
+    WorldClockGetTime(east, &time);
+    SimulateSeconds(105);
+    WorldClockGetTime(east, &time);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(tokyo, time.bcd, sizeof(tokyo));
+    WorldClockGetTime(west, &time);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(buenos_aires, time.bcd, sizeof(buenos_aires));
+}
+
+// 3-La fecha de una vista cambia en su propia medianoche, no en la del reloj principal
+void test_view_date_changes_at_its_midnight(void) {
+    static const uint8_t midnight[] = {0, 0, 0, 0, 0, 0};
+    world_clock_p view = WorldClockCreate(clock, 1200);
+    clock_time_u time;
+    calendar_date_t date;
+
+    SimulateSeconds(599);
+    WorldClockGetDate(view, &date);
+    TEST_ASSERT_EQUAL_UINT8(10, date.day);
+
+    SimulateSeconds(1);
+    WorldClockGetTime(view, &time);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(midnight, time.bcd, sizeof(midnight));
+    WorldClockGetDate(view, &date);
+    TEST_ASSERT_EQUAL_UINT8(11, date.day);
+    ClockGetDate(clock, &date);
+    TEST_ASSERT_EQUAL_UINT8(10, date.day);
+}
+
+// 4-Antes de poner en hora el reloj principal la vista indica que la hora no es válida, también antes de 1970
+void test_view_of_invalid_clock(void) {
+    static const uint8_t expected[] = {0, 0, 0, 3, 3, 2};
+    world_clock_p view;
+    clock_time_u time;
+    calendar_date_t date;
+
+    clock = ClockCreate(TICKS_PER_SECOND, &alarm_driver, 300);
+    view = WorldClockCreate(clock, -1800);
+    TEST_ASSERT_EQUAL_INT(0, WorldClockGetTime(view, &time));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, time.bcd, sizeof(expected));
+    TEST_ASSERT_EQUAL_INT(0, WorldClockGetDate(view, &date));
+    TEST_ASSERT_EQUAL_INT16(1969, date.year);
+    TEST_ASSERT_EQUAL_UINT8(12, date.month);
+    TEST_ASSERT_EQUAL_UINT8(31, date.day);
+}
+
+// 5-Cambiar el desplazamiento cambia la hora de la vista y no se aceptan desplazamientos de un día o más
+void test_view_offset(void) {
+    static const uint8_t expected[] = {0, 0, 5, 4, 4, 0};
+    world_clock_p view = WorldClockCreate(clock, 0);
+    clock_time_u time;
+
+    TEST_ASSERT_NULL(WorldClockCreate(clock, (int32_t)CALENDAR_SECONDS_PER_DAY));
+    TEST_ASSERT_NULL(WorldClockCreate(clock, -(int32_t)CALENDAR_SECONDS_PER_DAY));
+    TEST_ASSERT_NULL(WorldClockCreate(NULL, 0));
+
+    WorldClockGetTime(view, &time);
+    TEST_ASSERT_EQUAL_INT(1, WorldClockSetOffset(view, 5 * 3600 + 15 * 60));
+    TEST_ASSERT_EQUAL_INT32(5 * 3600 + 15 * 60, WorldClockGetOffset(view));
+    WorldClockGetTime(view, &time);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, time.bcd, sizeof(expected));
+
+    TEST_ASSERT_EQUAL_INT(0, WorldClockSetOffset(view, 25 * 3600));
+    TEST_ASSERT_EQUAL_INT32(5 * 3600 + 15 * 60, WorldClockGetOffset(view));
+}
+
+// 6-No se pueden tomar más vistas que las del pool y al devolverlas se pueden volver a tomar
+void test_pool_exhaustion(void) {
+    world_clock_p views[WORLD_CLOCK_VIEWS];
+
+    for (uint32_t i = 0; i < WORLD_CLOCK_VIEWS; i++) {
+        views[i] = WorldClockCreate(clock, (int32_t)i * 3600);
+        TEST_ASSERT_NOT_NULL(views[i]);
+    }
+    TEST_ASSERT_NULL(WorldClockCreate(clock, 0));
+    WorldClockDestroy(views[2]);
+    TEST_ASSERT_TRUE(WorldClockCreate(clock, 0) == views[2]);
+}
+
+/* === End of documentation ======================================================================================== */